@@ -58,6 +58,14 @@ Value Serialize(const Array<ItemType, UserType, Validators...>& ps, formats::ser
     return vb.ExtractValue();
 }
 
+template <typename ItemType, typename UserType, typename... Validators, typename StringBuilder>
+void WriteToStream(const Array<ItemType, UserType, Validators...>& ps, StringBuilder& sw) {
+    typename StringBuilder::ArrayGuard guard{sw};
+    for (const auto& item : ps.value) {
+        WriteToStream(ItemType{item}, sw);
+    }
+}
+
 }  // namespace chaotic
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,416 @@
+#pragma once
+
+/// @file userver/chaotic/sax_parser.hpp
+/// @brief SAX parsers for the types generated by chaotic with `--generate-sax`
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <userver/chaotic/array.hpp>
+#include <userver/chaotic/primitive.hpp>
+#include <userver/chaotic/ref.hpp>
+#include <userver/chaotic/with_type.hpp>
+#include <userver/formats/json/parser/parser.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/meta.hpp>
+#include <userver/utils/numeric_cast.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// SAX parsers for the chaotic generated types
+namespace chaotic::sax {
+
+using formats::json::parser::BaseParser;
+using formats::json::parser::Subscriber;
+using formats::json::parser::TypedParser;
+
+/// Result of the generated `MakeSaxParser(formats::parse::To<T>)`
+template <typename T>
+using ParserPtr = std::unique_ptr<TypedParser<T>>;
+
+namespace impl {
+
+template <typename T>
+using SaxParserFactory = decltype(MakeSaxParser(formats::parse::To<T>{}));
+
+template <typename T>
+inline constexpr bool kHasSaxParser = meta::kIsDetected<SaxParserFactory, T>;
+
+template <typename T>
+struct BuiltinParser {
+    using Type = void;
+};
+
+template <>
+struct BuiltinParser<bool> {
+    using Type = formats::json::parser::BoolParser;
+};
+
+template <>
+struct BuiltinParser<std::int32_t> {
+    using Type = formats::json::parser::Int32Parser;
+};
+
+template <>
+struct BuiltinParser<std::int64_t> {
+    using Type = formats::json::parser::Int64Parser;
+};
+
+template <>
+struct BuiltinParser<double> {
+    using Type = formats::json::parser::DoubleParser;
+};
+
+template <>
+struct BuiltinParser<std::string> {
+    using Type = formats::json::parser::StringParser;
+};
+
+template <typename T>
+inline constexpr bool kHasBuiltinParser = !std::is_void_v<typename BuiltinParser<T>::Type>;
+
+}  // namespace impl
+
+/// @brief Proxy SAX parser for the chaotic parse type T, e.g.
+/// chaotic::Primitive or chaotic::Array.
+///
+/// The generic implementation collects the value into formats::json::Value
+/// and parses it with the DOM parser. It is used for the types that require
+/// the whole subtree to be parsed, e.g. oneOf with a discriminator, as the
+/// discriminator may be the last field of the object.
+template <typename T, typename = void>
+class Parser final : public Subscriber<formats::json::Value> {
+public:
+    using ResultType = formats::common::ParseType<formats::json::Value, T>;
+
+    void Reset() {
+        // JsonValueParser can not be reused after it has produced a value
+        value_parser_ = std::make_unique<formats::json::parser::JsonValueParser>();
+        value_parser_->Subscribe(*this);
+    }
+
+    void Subscribe(Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    TypedParser<formats::json::Value>& GetParser() {
+        if (!value_parser_) Reset();
+        return value_parser_->GetParser();
+    }
+
+private:
+    void OnSend(formats::json::Value&& value) override {
+        auto result = value.As<T>();
+        if (subscriber_) subscriber_->OnSend(std::move(result));
+    }
+
+    std::unique_ptr<formats::json::parser::JsonValueParser> value_parser_;
+    Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// SAX parser for boolean, integer, number and string with validators
+template <typename RawType, typename... Validators>
+class Parser<Primitive<RawType, Validators...>, std::enable_if_t<impl::kHasBuiltinParser<RawType>>> final
+    : public Subscriber<RawType> {
+public:
+    using ResultType = RawType;
+
+    Parser() { parser_.Subscribe(*this); }
+
+    void Reset() { parser_.Reset(); }
+
+    void Subscribe(Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    auto& GetParser() { return parser_.GetParser(); }
+
+private:
+    void OnSend(RawType&& value) override {
+        (Validators::Validate(value), ...);
+        if (subscriber_) subscriber_->OnSend(std::move(value));
+    }
+
+    typename impl::BuiltinParser<RawType>::Type parser_;
+    Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// SAX parser for a generated type, created lazily to support recursive types
+template <typename RawType>
+class Parser<Primitive<RawType>, std::enable_if_t<!impl::kHasBuiltinParser<RawType> && impl::kHasSaxParser<RawType>>>
+    final : public Subscriber<RawType> {
+public:
+    using ResultType = RawType;
+
+    void Reset() { GetParser().Reset(); }
+
+    void Subscribe(Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    TypedParser<RawType>& GetParser() {
+        if (!parser_) {
+            parser_ = MakeSaxParser(formats::parse::To<RawType>{});
+            parser_->Subscribe(*this);
+        }
+        return parser_->GetParser();
+    }
+
+private:
+    void OnSend(RawType&& value) override {
+        if (subscriber_) subscriber_->OnSend(std::move(value));
+    }
+
+    ParserPtr<RawType> parser_;
+    Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// SAX parser for x-usrv-cpp-type
+template <typename RawType, typename UserType>
+class Parser<WithType<RawType, UserType>> final : public Subscriber<typename Parser<RawType>::ResultType> {
+public:
+    using ResultType = UserType;
+
+    Parser() { parser_.Subscribe(*this); }
+
+    void Reset() { parser_.Reset(); }
+
+    void Subscribe(Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    auto& GetParser() { return parser_.GetParser(); }
+
+private:
+    void OnSend(typename Parser<RawType>::ResultType&& value) override {
+        auto result = Convert(value, convert::To<UserType>{});
+        if (subscriber_) subscriber_->OnSend(std::move(result));
+    }
+
+    Parser<RawType> parser_;
+    Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// SAX parser for arrays with validators
+template <typename ItemType, typename UserType, typename... Validators>
+class Parser<Array<ItemType, UserType, Validators...>> final : public Subscriber<UserType> {
+public:
+    using ResultType = UserType;
+
+    Parser() { array_parser_.Subscribe(*this); }
+
+    void Reset() { array_parser_.Reset(); }
+
+    void Subscribe(Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    auto& GetParser() { return array_parser_.GetParser(); }
+
+private:
+    void OnSend(UserType&& value) override {
+        (Validators::Validate(value), ...);
+        if (subscriber_) subscriber_->OnSend(std::move(value));
+    }
+
+    using ItemParser = Parser<ItemType>;
+
+    ItemParser item_parser_;
+    formats::json::parser::ArrayParser<typename ItemParser::ResultType, ItemParser, UserType> array_parser_{
+        item_parser_};
+    Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// SAX parser for indirect references, created lazily to support recursive
+/// types
+template <typename T>
+class Parser<Ref<T>> final : public Subscriber<typename Parser<T>::ResultType> {
+public:
+    using ResultType = utils::Box<typename Parser<T>::ResultType>;
+
+    void Reset() { GetImpl().Reset(); }
+
+    void Subscribe(Subscriber<ResultType>& subscriber) { subscriber_ = &subscriber; }
+
+    auto& GetParser() { return GetImpl().GetParser(); }
+
+private:
+    Parser<T>& GetImpl() {
+        if (!parser_) {
+            parser_ = std::make_unique<Parser<T>>();
+            parser_->Subscribe(*this);
+        }
+        return *parser_;
+    }
+
+    void OnSend(typename Parser<T>::ResultType&& value) override {
+        if (subscriber_) subscriber_->OnSend(ResultType{std::move(value)});
+    }
+
+    std::unique_ptr<Parser<T>> parser_;
+    Subscriber<ResultType>* subscriber_{nullptr};
+};
+
+/// SAX parser for optional fields, `null` is parsed as std::nullopt
+template <typename T>
+class Parser<std::optional<T>> final : public TypedParser<std::optional<typename Parser<T>::ResultType>>,
+                                       public Subscriber<typename Parser<T>::ResultType> {
+public:
+    using ValueType = typename Parser<T>::ResultType;
+    using ResultType = std::optional<ValueType>;
+
+    Parser() { parser_.Subscribe(*this); }
+
+private:
+    void Null() override { this->SetResult(std::nullopt); }
+    void Bool(bool value) override { PushParser().Bool(value); }
+    void Int64(std::int64_t value) override { PushParser().Int64(value); }
+    void Uint64(std::uint64_t value) override { PushParser().Uint64(value); }
+    void Double(double value) override { PushParser().Double(value); }
+    void String(std::string_view value) override { PushParser().String(value); }
+    void StartObject() override { PushParser().StartObject(); }
+    void StartArray() override { PushParser().StartArray(); }
+
+    void OnSend(ValueType&& value) override { this->SetResult(ResultType{std::move(value)}); }
+
+    BaseParser& PushParser() {
+        parser_.Reset();
+        auto& parser = parser_.GetParser();
+        this->parser_state_->PushParser(parser);
+        return parser;
+    }
+
+    std::string Expected() const override { return "value"; }
+    std::string GetPathItem() const override { return {}; }
+
+    Parser<T> parser_;
+};
+
+/// Skips the value of an unknown object property
+class SkipParser final : public BaseParser {
+public:
+    void Null() override { MaybePopSelf(); }
+    void Bool(bool) override { MaybePopSelf(); }
+    void Int64(std::int64_t) override { MaybePopSelf(); }
+    void Uint64(std::uint64_t) override { MaybePopSelf(); }
+    void Double(double) override { MaybePopSelf(); }
+    void String(std::string_view) override { MaybePopSelf(); }
+    void StartObject() override { ++level_; }
+    void Key(std::string_view) override {}
+    void EndObject() override { EndContainer(); }
+    void StartArray() override { ++level_; }
+    void EndArray() override { EndContainer(); }
+
+    std::string GetPathItem() const override { return {}; }
+
+private:
+    void EndContainer() {
+        --level_;
+        MaybePopSelf();
+    }
+
+    void MaybePopSelf() {
+        if (level_ == 0) parser_state_->PopMe(*this);
+    }
+
+    std::string Expected() const override { return "anything"; }
+
+    std::size_t level_{0};
+};
+
+/// Parses a value of the struct field and stores it into the field.
+/// Fields with a default value keep it if the value is `null`.
+template <typename T, typename Field>
+class FieldParser final : public Subscriber<typename Parser<T>::ResultType> {
+public:
+    using ValueType = typename Parser<T>::ResultType;
+
+    explicit FieldParser(Field& field) : field_(field) { parser_.Subscribe(*this); }
+
+    /// Resets the parser and returns the parser to push onto the stack
+    BaseParser& Start() {
+        parser_.Reset();
+        return parser_.GetParser();
+    }
+
+private:
+    void OnSend(ValueType&& value) override {
+        if constexpr (meta::kIsOptional<ValueType> && !meta::kIsOptional<Field>) {
+            if (value) field_ = std::move(*value);
+        } else {
+            field_ = std::move(value);
+        }
+    }
+
+    Parser<T> parser_;
+    Field& field_;
+};
+
+/// @brief Parses values of additionalProperties into the `extra` container.
+///
+/// Reset() is called before parsing of each object, Finish() after it.
+template <typename T, typename Map>
+class AdditionalPropertiesParser final : public Subscriber<typename Parser<T>::ResultType> {
+public:
+    explicit AdditionalPropertiesParser(Map& extra) : extra_(extra) { parser_.Subscribe(*this); }
+
+    void Reset() {}
+
+    BaseParser& Start(std::string_view key) {
+        key_ = key;
+        parser_.Reset();
+        return parser_.GetParser();
+    }
+
+    void Finish() {}
+
+private:
+    void OnSend(typename Parser<T>::ResultType&& value) override {
+        extra_.emplace(std::move(key_), std::move(value));
+    }
+
+    Parser<T> parser_;
+    Map& extra_;
+    std::string key_;
+};
+
+/// Collects `additionalProperties: true` into formats::json::Value
+template <>
+class AdditionalPropertiesParser<formats::json::Value, formats::json::Value> final
+    : public Subscriber<formats::json::Value> {
+public:
+    explicit AdditionalPropertiesParser(formats::json::Value& extra) : extra_(extra) {}
+
+    void Reset() { builder_ = formats::json::ValueBuilder{formats::common::Type::kObject}; }
+
+    BaseParser& Start(std::string_view key) {
+        key_ = key;
+        // JsonValueParser can not be reused after it has produced a value
+        value_parser_ = std::make_unique<formats::json::parser::JsonValueParser>();
+        value_parser_->Subscribe(*this);
+        return *value_parser_;
+    }
+
+    void Finish() { extra_ = builder_.ExtractValue(); }
+
+private:
+    void OnSend(formats::json::Value&& value) override { builder_[key_] = std::move(value); }
+
+    std::unique_ptr<formats::json::parser::JsonValueParser> value_parser_;
+    formats::json::ValueBuilder builder_{formats::common::Type::kObject};
+    formats::json::Value& extra_;
+    std::string key_;
+};
+
+/// @brief Parses JSON string into the generated type T without building
+/// formats::json::Value.
+///
+/// @throws formats::json::parser::ParseError on invalid JSON or if the
+/// document does not match the schema.
+template <typename T>
+T ParseToType(std::string_view json) {
+    static_assert(impl::kHasSaxParser<T>, "SAX parser for T was not generated, use chaotic-gen --generate-sax");
+
+    auto parser = MakeSaxParser(formats::parse::To<T>{});
+    return formats::json::parser::impl::ParseSingle(*parser, json);
+}
+
+}  // namespace chaotic::sax
+
+USERVER_NAMESPACE_END
@@ -47,6 +47,16 @@ Value Serialize(const Variant<T...>& var, formats::serialize::To<Value>) {
     );
 }
 
+template <typename... T, typename StringBuilder>
+void WriteToStream(const Variant<T...>& var, StringBuilder& sw) {
+    std::visit(
+        utils::Overloaded{[&sw](const formats::common::ParseType<formats::json::Value, T>& item) {
+            WriteToStream(T{item}, sw);
+        }...},
+        var.value
+    );
+}
+
 }  // namespace chaotic
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <userver/chaotic/sax_parser.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+#include <schemas/object_single_field.hpp>
+#include <schemas/recursion.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string MakeRecursiveObject(std::size_t width, std::size_t depth) {
+    std::string json = R"({"data": "node")";
+    if (depth != 0) {
+        json += R"(, "next": [)";
+        for (std::size_t i = 0; i < width; ++i) {
+            if (i != 0) json += ',';
+            json += MakeRecursiveObject(width, depth - 1);
+        }
+        json += ']';
+    }
+    json += '}';
+    return json;
+}
+
+const std::string& GetRecursiveObject() {
+    static const auto json = MakeRecursiveObject(4, 6);
+    return json;
+}
+
+constexpr std::string_view kObjectTypes = R"({"boolean": true, "integer": 42, "number": 1.5,)"
+                                          R"( "string": "some text to parse", "object": {}, "array": [1, 2, 3, 4, 5],)"
+                                          R"( "int-enum": 2, "string-enum": "bar"})";
+
+}  // namespace
+
+void ChaoticParseDom(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(formats::json::FromString(kObjectTypes).As<ns::ObjectTypes>());
+    }
+}
+BENCHMARK(ChaoticParseDom);
+
+void ChaoticParseSax(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(chaotic::sax::ParseToType<ns::ObjectTypes>(kObjectTypes));
+    }
+}
+BENCHMARK(ChaoticParseSax);
+
+void ChaoticParseRecursiveDom(benchmark::State& state) {
+    const auto& json = GetRecursiveObject();
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(formats::json::FromString(json).As<ns::RecursiveObject>());
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(ChaoticParseRecursiveDom);
+
+void ChaoticParseRecursiveSax(benchmark::State& state) {
+    const auto& json = GetRecursiveObject();
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(chaotic::sax::ParseToType<ns::RecursiveObject>(json));
+    }
+    state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(ChaoticParseRecursiveSax);
+
+void ChaoticSerializeDom(benchmark::State& state) {
+    const auto value = chaotic::sax::ParseToType<ns::RecursiveObject>(GetRecursiveObject());
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(formats::json::ToString(formats::json::ValueBuilder{value}.ExtractValue()));
+    }
+}
+BENCHMARK(ChaoticSerializeDom);
+
+void ChaoticSerializeSax(benchmark::State& state) {
+    const auto value = chaotic::sax::ParseToType<ns::RecursiveObject>(GetRecursiveObject());
+    for ([[maybe_unused]] auto _ : state) {
+        formats::json::StringBuilder sb;
+        WriteToStream(value, sb);
+        benchmark::DoNotOptimize(sb.GetStringView());
+    }
+}
+BENCHMARK(ChaoticSerializeSax);
+
+USERVER_NAMESPACE_END
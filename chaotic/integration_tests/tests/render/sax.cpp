@@ -0,0 +1,152 @@
+#include <userver/utest/assert_macros.hpp>
+
+#include <userver/chaotic/sax_parser.hpp>
+#include <userver/formats/json/parser/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value_builder.hpp>
+
+#include <schemas/int_minmax.hpp>
+#include <schemas/object_single_field.hpp>
+#include <schemas/one_of.hpp>
+#include <schemas/recursion.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+T ParseDom(std::string_view json) {
+    return formats::json::FromString(json).As<T>();
+}
+
+template <typename T>
+std::string WriteSax(const T& value) {
+    formats::json::StringBuilder sb;
+    WriteToStream(value, sb);
+    return sb.GetString();
+}
+
+template <typename T>
+std::string WriteDom(const T& value) {
+    return formats::json::ToString(formats::json::ValueBuilder{value}.ExtractValue());
+}
+
+}  // namespace
+
+TEST(Sax, Simple) {
+    constexpr std::string_view kJson = R"({"integer": 3, "int": 5, "int3": 7})";
+
+    const auto obj = chaotic::sax::ParseToType<ns::SimpleObject>(kJson);
+    EXPECT_EQ(obj, ParseDom<ns::SimpleObject>(kJson));
+    EXPECT_EQ(obj.integer, 3);
+    EXPECT_EQ(obj.int_, 5);
+    EXPECT_EQ(obj.int3, 7);
+
+    EXPECT_EQ(WriteSax(obj), WriteDom(obj));
+}
+
+TEST(Sax, DefaultAndOptional) {
+    for (const std::string_view json : {R"({"int3": 1})", R"({"int3": 1, "int": null, "integer": null})"}) {
+        const auto obj = chaotic::sax::ParseToType<ns::SimpleObject>(json);
+        EXPECT_EQ(obj, ParseDom<ns::SimpleObject>(json)) << json;
+        EXPECT_EQ(obj.int_, 1);
+        EXPECT_EQ(obj.integer, std::nullopt);
+        EXPECT_EQ(WriteSax(obj), WriteDom(obj));
+    }
+}
+
+TEST(Sax, Errors) {
+    using ParseError = formats::json::parser::ParseError;
+
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::SimpleObject>(R"({"int": 2})"), ParseError, "Field 'int3' is missing"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::SimpleObject>(R"({"int3": 1, "int": 11})"),
+        ParseError,
+        "path 'int': Invalid value, maximum=10, given=11"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::SimpleObject>(R"({"int3": "1"})"),
+        ParseError,
+        "path 'int3': integer was expected, but string found"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::ObjectWithAdditionalPropertiesFalseStrict>(R"({"foo": 1, "bar": 2})"),
+        ParseError,
+        "Unknown property 'bar'"
+    );
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::IntegerObject>(R"({"zoo": [1]})"),
+        ParseError,
+        "path 'zoo': Too short array, minimum length=2, given=1"
+    );
+}
+
+TEST(Sax, Types) {
+    constexpr std::string_view kJson = R"({
+        "boolean": true, "integer": 1, "number": 1.5, "string": "foo", "object": {}, "array": [1, 2, 3],
+        "int-enum": 3, "string-enum": "bar"
+    })";
+
+    const auto obj = chaotic::sax::ParseToType<ns::ObjectTypes>(kJson);
+    EXPECT_EQ(obj, ParseDom<ns::ObjectTypes>(kJson));
+    EXPECT_EQ(obj.int_enum, ns::ObjectTypes::Int_Enum::k3);
+    EXPECT_EQ(obj.string_enum, ns::ObjectTypes::String_Enum::kBar);
+    EXPECT_EQ(WriteSax(obj), WriteDom(obj));
+
+    UEXPECT_THROW_MSG(
+        chaotic::sax::ParseToType<ns::ObjectTypes>(R"({"int-enum": 4})"),
+        formats::json::parser::ParseError,
+        "Invalid enum value (4)"
+    );
+}
+
+TEST(Sax, AdditionalProperties) {
+    {
+        constexpr std::string_view kJson = R"({"one": 2, "two": 3, "three": 4})";
+        const auto obj = chaotic::sax::ParseToType<ns::ObjectWithAdditionalPropertiesInt>(kJson);
+        EXPECT_EQ(obj, ParseDom<ns::ObjectWithAdditionalPropertiesInt>(kJson));
+        EXPECT_EQ(obj.extra.size(), 2);
+        EXPECT_EQ(formats::json::FromString(WriteSax(obj)), formats::json::FromString(WriteDom(obj)));
+    }
+    {
+        constexpr std::string_view kJson = R"({"one": 2, "two": {"x": [1, 2]}, "three": null})";
+        const auto obj = chaotic::sax::ParseToType<ns::ObjectWithAdditionalPropertiesTrue>(kJson);
+        EXPECT_EQ(obj, ParseDom<ns::ObjectWithAdditionalPropertiesTrue>(kJson));
+        EXPECT_EQ(WriteSax(obj), WriteDom(obj));
+    }
+    {
+        constexpr std::string_view kJson = R"({"foo": "a", "bar": {"bar": "b"}, "baz": {}})";
+        const auto obj = chaotic::sax::ParseToType<ns::ObjectWithAdditionalProperties>(kJson);
+        EXPECT_EQ(obj, ParseDom<ns::ObjectWithAdditionalProperties>(kJson));
+        EXPECT_EQ(WriteSax(obj), WriteDom(obj));
+    }
+}
+
+TEST(Sax, SkipUnknown) {
+    constexpr std::string_view kJson = R"({"unknown": {"a": [1, {"b": null}, []]}, "one": 2, "two": [[{}]]})";
+
+    const auto obj = chaotic::sax::ParseToType<ns::ObjectWithAdditionalPropertiesTrueExtraMemberFalse>(kJson);
+    EXPECT_EQ(obj, ParseDom<ns::ObjectWithAdditionalPropertiesTrueExtraMemberFalse>(kJson));
+    EXPECT_EQ(obj.one, 2);
+}
+
+TEST(Sax, OneOf) {
+    constexpr std::string_view kJson = R"({"oneof": {"foo": 1, "type": "ObjectFoo"}})";
+
+    const auto obj = chaotic::sax::ParseToType<ns::ObjectOneOfWithDiscriminator>(kJson);
+    EXPECT_EQ(obj, ParseDom<ns::ObjectOneOfWithDiscriminator>(kJson));
+    EXPECT_EQ(WriteSax(obj), WriteDom(obj));
+}
+
+TEST(Sax, Recursion) {
+    constexpr std::string_view kJson = R"({"data": "1", "next": [{"data": "2", "next": [{"data": "3"}]}, {}]})";
+
+    const auto obj = chaotic::sax::ParseToType<ns::RecursiveObject>(kJson);
+    EXPECT_EQ(obj, ParseDom<ns::RecursiveObject>(kJson));
+    EXPECT_EQ(WriteSax(obj), WriteDom(obj));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,29 @@
+option(USERVER_DOWNLOAD_PACKAGE_SIMDJSON "Download and setup simdjson if no simdjson matching version was found" ${USERVER_DOWNLOAD_PACKAGES})
+option(USERVER_FORCE_DOWNLOAD_SIMDJSON "Download simdjson even if it exists in a system" ${USERVER_FORCE_DOWNLOAD_PACKAGES})
+
+if(NOT USERVER_FORCE_DOWNLOAD_SIMDJSON)
+  if(USERVER_DOWNLOAD_PACKAGE_SIMDJSON)
+    find_package(simdjson QUIET)
+  else()
+    find_package(simdjson REQUIRED)
+  endif()
+
+  if(simdjson_FOUND)
+    return()
+  endif()
+endif()
+
+include(DownloadUsingCPM)
+
+CPMAddPackage(
+    NAME simdjson
+    VERSION 3.10.1
+    GITHUB_REPOSITORY simdjson/simdjson
+    SYSTEM
+    OPTIONS
+    "SIMDJSON_DEVELOPER_MODE OFF"
+    "SIMDJSON_ENABLE_THREADS OFF"
+)
+
+mark_targets_as_system("${simdjson_SOURCE_DIR}")
+write_package_stub(simdjson)
@@ -39,6 +39,10 @@ find_package(cryptopp REQUIRED)
 find_package(zstd REQUIRED)
 find_package(yaml-cpp REQUIRED)
 
+if (USERVER_IMPL_FEATURE_SIMDJSON)
+  find_package(simdjson REQUIRED)
+endif()
+
 if (USERVER_CONAN)
   find_package(RapidJSON REQUIRED)
 endif()
@@ -13,7 +13,11 @@ def _normalize_metrics(metrics: str) -> str:
         if sys.platform == 'darwin' and left.startswith('io_'):
             # MacOS does not provide some of the io_* metrics
             continue
+        if sys.platform == 'darwin' and left.startswith('server.acceptors.accept-queue-'):
+            # Accept queue of a listening socket is reported only on Linux
+            continue
         left = re.sub('localhost:\\d+', 'localhost:00000', left + '\t' + '0')
+        left = re.sub('address=\\[([^\\]]*)\\]:\\d+', 'address=[\\1]:00000', left)
         result.append(left)
     result.sort()
     return '\n'.join(result) + '\n'
@@ -0,0 +1,58 @@
+#pragma once
+
+/// @file userver/clients/http/body_compression.hpp
+/// @brief @copybrief clients::http::BodyCompression
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::zstd {
+class Dictionary;
+}  // namespace compression::zstd
+
+namespace clients::http {
+
+/// Content codings that the HTTP client is able to apply to request bodies
+enum class ContentCoding {
+    kGzip,
+    kZstd,
+};
+
+/// @returns Content-Encoding header value for the coding
+std::string_view ToString(ContentCoding coding);
+
+/// @brief Request body compression settings, see Request::compress_body()
+struct BodyCompression final {
+    ContentCoding coding{ContentCoding::kZstd};
+
+    /// Compression level, the default one of the coding is used if not set.
+    /// Ignored if the `dictionary` is set, its own level is used.
+    std::optional<int> level{};
+
+    /// @brief Trained zstd dictionary, only for ContentCoding::kZstd.
+    ///
+    /// The receiver must know the dictionary to decode the body. The
+    /// responses to such requests are decoded by the client itself, so that
+    /// the replies compressed with the same dictionary are decoded as well.
+    std::shared_ptr<const compression::zstd::Dictionary> dictionary{};
+
+    /// Bodies smaller than this are sent as is
+    std::size_t min_size{0};
+};
+
+/// Request body compression for all the requests with URLs starting with
+/// `url_prefix`, see `request-body-compression` static config option of
+/// components::HttpClient
+struct BodyCompressionRule final {
+    std::string url_prefix;
+    BodyCompression compression;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
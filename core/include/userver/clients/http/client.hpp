@@ -124,7 +124,18 @@ public:
     /// (most likely getaddrinfo).
     void SetDnsResolver(clients::dns::Resolver* resolver);
 
+    /// @brief Opens connections to the `urls` in advance, so that the first
+    /// requests to them do not wait for TCP and TLS handshakes.
+    ///
+    /// A HEAD request is sent to each of the URLs from each of the IO threads,
+    /// as connections are not shared between those. Failures are logged and
+    /// ignored.
+    void PrewarmConnections(const std::vector<std::string>& urls, std::chrono::milliseconds timeout);
+
 private:
+    Request CreateBoundRequest(std::size_t multi_index);
+    void ApplyRequestDefaults(Request& request);
+
     void ReinitEasy();
 
     InstanceStatistics GetMultiStatistics(size_t n) const;
@@ -168,6 +179,8 @@ private:
     std::shared_ptr<const TestsuiteConfig> testsuite_config_;
     rcu::Variable<std::vector<std::string>> allowed_urls_extra_;
 
+    std::shared_ptr<const std::vector<BodyCompressionRule>> body_compression_rules_;
+
     std::shared_ptr<curl::ConnectRateLimiter> connect_rate_limiter_;
 
     clients::dns::Resolver* resolver_{nullptr};
@@ -48,6 +48,21 @@ namespace components {
 /// set-deadline-propagation-header | whether to set http::common::kXYaTaxiClientTimeoutMs request header, see @ref scripts/docs/en/userver/deadline_propagation.md | true
 /// plugins | Plugin names to apply. A plugin component is called "http-client-plugin-" plus the plugin name. | []
 /// cancellation-policy | Cancellation policy for new requests. | cancel
+/// http2-multiplexing | whether to send concurrent requests to the same host over a single HTTP/2 connection | true
+/// http2-max-concurrent-streams | max number of concurrent streams over a single HTTP/2 connection | 100
+/// max-host-connections | max number of connections to a single host per IO thread, 0 for no limit. The same limit applies to every host separately, per-destination values are not supported | 0
+/// prewarm-urls | URLs to open connections to from each of the IO threads at component start, see clients::http::Client::PrewarmConnections() | []
+/// prewarm-timeout | timeout for each of the prewarm requests | 1s
+/// request-body-compression | list of request body compression rules, the first one with `url-prefix` matching the request URL is used, see clients::http::BodyCompressionRule | []
+/// request-body-compression.[].url-prefix | URL prefix of the requests to compress | -
+/// request-body-compression.[].coding | content coding of the bodies, `gzip` or `zstd` | -
+/// request-body-compression.[].level | compression level | default one of the coding
+/// request-body-compression.[].zstd-dictionary | path to a trained zstd dictionary, known to the receiver | -
+/// request-body-compression.[].min-size | bodies smaller than this are sent as is | 0
+///
+/// The `connections`, `sockets/open` and `http2` client metrics are reported
+/// both for the whole client and for each destination with the
+/// `http_destination` label, see `destination-metrics-auto-max-size`.
 ///
 /// ## Static configuration example:
 ///
@@ -2,7 +2,9 @@
 
 #include <chrono>
 #include <string>
+#include <vector>
 
+#include <userver/clients/http/body_compression.hpp>
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
@@ -33,6 +35,12 @@ struct ClientSettings final {
     DeadlinePropagationConfig deadline_propagation{};
     const tracing::TracingManagerBase* tracing_manager{nullptr};
     CancellationPolicy cancellation_policy{CancellationPolicy::kCancel};
+    bool http2_multiplexing{true};
+    /// 0 means no limit
+    size_t max_host_connections{0};
+    size_t http2_max_concurrent_streams{100};
+    /// the first matching rule is used
+    std::vector<BodyCompressionRule> body_compression_rules{};
 };
 
 ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSettings>);
@@ -4,10 +4,12 @@
 /// @brief @copybrief clients::http::Request
 
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
+#include <userver/clients/http/body_compression.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/plugin.hpp>
 #include <userver/clients/http/response.hpp>
@@ -29,6 +31,7 @@ namespace clients::http {
 
 class RequestState;
 class StreamedResponse;
+class StreamedRequestBody;
 class ConnectTo;
 class Form;
 struct DeadlinePropagationConfig;
@@ -151,6 +154,19 @@ public:
     /// form for POST request
     Request& form(Form&& form) &;
     Request form(Form&& form) &&;
+    /// @brief Request body that is sent by chunks while it is being produced,
+    /// `content_length` is sent if known, chunked transfer encoding is used
+    /// otherwise. A request with a streamed body is never retried.
+    /// @see clients::http::StreamedRequestBody
+    Request& data_stream(StreamedRequestBody& body, std::optional<std::size_t> content_length = {}) &;
+    Request data_stream(StreamedRequestBody& body, std::optional<std::size_t> content_length = {}) &&;
+    /// @brief Compress the body set by data() before sending and set the
+    /// Content-Encoding header. Overrides the per-destination settings from
+    /// the `request-body-compression` static config option of
+    /// components::HttpClient. Forms and streamed bodies are sent as is.
+    /// @see clients::http::BodyCompression
+    Request& compress_body(BodyCompression compression) &;
+    Request compress_body(BodyCompression compression) &&;
     /// Headers for request as map
     Request& headers(const Headers& headers) &;
     Request headers(const Headers& headers) &&;
@@ -262,6 +278,8 @@ public:
 
     void SetAllowedUrlsExtra(const std::vector<std::string>& urls) &;
 
+    void SetBodyCompressionRules(std::shared_ptr<const std::vector<BodyCompressionRule>> rules) &;
+
     // Set deadline propagation settings. For internal use only.
     void SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config) &;
     /// @endcond
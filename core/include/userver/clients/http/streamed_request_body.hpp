@@ -0,0 +1,74 @@
+#pragma once
+
+/// @file userver/clients/http/streamed_request_body.hpp
+/// @brief @copybrief clients::http::StreamedRequestBody
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+class RequestState;
+
+namespace impl {
+class RequestBodyStream;
+}  // namespace impl
+
+/// @brief HTTP request body that is sent while it is being produced.
+///
+/// Pass it to Request::data_stream() and push the body by chunks after
+/// the request is started. The body ends on Finish() or on destruction.
+/// You can use it for proxying large uploads without buffering them in memory.
+///
+/// Not more than `max_buffered_bytes` are kept in memory, Push() waits for
+/// the request to send the previous chunks if there are more.
+///
+/// @note The object is not thread-safe, use it from a single task.
+///
+/// ## Example usage:
+///
+/// @snippet clients/http/client_test.cpp  Sample HTTP Client streamed request body
+class StreamedRequestBody final {
+public:
+    using Queue = concurrent::StringStreamQueue;
+
+    static constexpr std::size_t kDefaultMaxBufferedBytes = 1024 * 1024;
+
+    explicit StreamedRequestBody(std::size_t max_buffered_bytes = kDefaultMaxBufferedBytes);
+
+    StreamedRequestBody(StreamedRequestBody&&) noexcept;
+    StreamedRequestBody& operator=(StreamedRequestBody&&) noexcept;
+    StreamedRequestBody(const StreamedRequestBody&) = delete;
+    StreamedRequestBody& operator=(const StreamedRequestBody&) = delete;
+
+    ~StreamedRequestBody();
+
+    /// @brief Pushes the next part of the body.
+    /// @note may suspend the coroutine while too much data is not sent yet.
+    /// @returns false if the deadline has expired or the request does not
+    /// read the body anymore, e.g. it has failed.
+    [[nodiscard]] bool Push(std::string chunk, engine::Deadline deadline = {});
+
+    /// Marks the end of the body
+    void Finish();
+
+private:
+    friend class RequestState;
+
+    bool PushChunk(std::string&& chunk, engine::Deadline deadline);
+    void NotifyStream() noexcept;
+
+    std::shared_ptr<Queue> queue_;
+    std::optional<Queue::Producer> producer_;
+    std::weak_ptr<impl::RequestBodyStream> stream_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -29,6 +30,10 @@ namespace components {
 /// ## LoggingConfigurator Dynamic config
 /// * @ref USERVER_LOG_DYNAMIC_DEBUG
 /// * @ref USERVER_NO_LOG_SPANS
+/// * @ref USERVER_TRACING_SAMPLING
+///
+/// Writes the `tracing.sampling.tail.buffered-spans` and
+/// `tracing.sampling.tail.dropped-by-budget` metrics of the tail sampling.
 ///
 /// ## Static options:
 /// Name | Description | Default value
@@ -58,6 +63,7 @@ private:
 
     concurrent::AsyncEventSubscriberScope config_subscription_;
     rcu::Variable<logging::DynamicDebugConfig> dynamic_debug_;
+    utils::statistics::Entry statistics_holder_;
 };
 
 /// }@
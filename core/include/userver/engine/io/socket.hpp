@@ -5,6 +5,7 @@
 
 #include <sys/socket.h>
 
+#include <cstdint>
 #include <initializer_list>
 
 #include <userver/engine/deadline.hpp>
@@ -112,6 +113,29 @@ public:
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+    /// @brief Sends exactly list_size IoData to the socket using MSG_ZEROCOPY
+    /// and waits for the kernel to release the buffers before returning.
+    ///
+    /// The kernel pins the pages of the buffers instead of copying them into
+    /// the socket buffer, which pays off only for big payloads (hundreds of
+    /// kilobytes and more). Falls back to SendAll if zero-copy is not supported
+    /// for the socket or if the kernel reports that it had to copy the data
+    /// anyway (e.g. for loopback).
+    ///
+    /// If the peer does not acknowledge the data before the deadline or the task
+    /// is cancelled, the connection is reset to release the buffers, and
+    /// IoTimeout or IoCancelled is thrown.
+    /// @note Can return less than len if socket is closed by peer.
+    [[nodiscard]] size_t SendAllZeroCopy(const IoData* list, std::size_t list_size, Deadline deadline);
+
+    /// @brief Sends exactly len bytes of the file starting from offset to the
+    /// socket with sendfile(2), without copying the data into userspace.
+    /// @note Can return less than len if socket is closed by peer or the file
+    /// is shorter than expected.
+    /// @warning sendfile(2) may block on disk I/O if the file data is not in the
+    /// page cache, call it from a task processor for blocking operations.
+    [[nodiscard]] size_t SendFile(int in_fd, std::size_t offset, std::size_t len, Deadline deadline);
+
     /// @brief Accepts a connection from a listening socket.
     /// @see engine::io::Listen
     [[nodiscard]] Socket Accept(Deadline);
@@ -180,11 +204,24 @@ public:
     }
 
 private:
+    enum class ZeroCopyState : std::uint8_t {
+        kUnknown,
+        kEnabled,
+        kDisabled,
+    };
+
+    void WaitZeroCopyCompletions(Deadline deadline);
+    void AbortZeroCopy();
+
     AddrDomain domain_{AddrDomain::kUnspecified};
 
     impl::FdControlHolder fd_control_;
     Sockaddr peername_;
     Sockaddr sockname_;
+
+    ZeroCopyState zerocopy_state_{ZeroCopyState::kUnknown};
+    std::uint32_t zerocopy_sends_{0};
+    std::uint32_t zerocopy_completions_{0};
 };
 
 }  // namespace engine::io
@@ -3,7 +3,10 @@
 /// @file userver/fs/fs_cache_client.hpp
 /// @brief @copybref fs::FsCacheClient
 
+#include <optional>
+
 #include <userver/engine/io/sys_linux/inotify.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/read.hpp>
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/periodic_task.hpp>
@@ -31,9 +34,20 @@ public:
     /// on FS
     FileInfoWithDataConstPtr TryGetFile(std::string_view path) const;
 
+    /// @brief open the cached file on FS for reading, e.g. to send it with
+    /// sendfile(2) without copying
+    /// @param path to file, the same as for `TryGetFile`
+    /// @return opened file ; `std::nullopt` if no file with specified name in
+    /// cache or it could not be opened
+    std::optional<fs::blocking::FileDescriptor> TryOpenFile(std::string_view path) const;
+
     /// @brief Concurrency-safe cache update
     void UpdateCache();
 
+    /// @brief task processor to do blocking filesystem operations on, e.g. to
+    /// read the files opened with `TryOpenFile`
+    engine::TaskProcessor& GetTaskProcessor() const noexcept { return tp_; }
+
 private:
 #ifdef __linux__
     void InotifyWork();
@@ -43,10 +43,11 @@ namespace components {
 /// ---- | ----------- | -------------
 /// file_path | path to the log file | -
 /// level | log verbosity | info
-/// format | log output format, one of `tskv`, `ltsv`, `json`, `json_yadeploy` | tskv
+/// format | log output format, one of `tskv`, `ltsv`, `json`, `json_yadeploy`, `binary`. The `binary` one is written only to files, use `userver-tool-log-decoder` to read it | tskv
 /// flush_level | messages of this and higher levels get flushed to the file immediately | warning
 /// message_queue_size | the size of internal message queue, must be a power of 2 | 65536
 /// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue | discard
+/// batching-max-latency | if set, log records are collected in per-thread buffers and written to the sinks in batches, a record waits in a buffer for no longer than this time, e.g. `10ms` | batching is disabled
 /// testsuite-capture | if exists, setups additional TCP log sink for testing purposes | {}
 /// fs-task-processor | task processor for disk I/O operations for this logger | fs-task-processor of the loggers component
 ///
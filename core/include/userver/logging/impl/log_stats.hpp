@@ -18,6 +18,12 @@ struct LogStatistics final {
 
     std::array<Counter, kLevelMax + 1> by_level{};
     std::atomic<bool> has_reopening_error{false};
+
+    // Batching mode only
+    Counter batches{};
+    // Total time the oldest record of each batch spent in the thread buffers,
+    // divide its rate by the rate of `batches` to get the average delay
+    Counter batch_delay_us{};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const LogStatistics& stats);
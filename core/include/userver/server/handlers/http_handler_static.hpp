@@ -3,6 +3,8 @@
 /// @file userver/server/handlers/http_handler_static.hpp
 /// @brief @copybrief server::handlers::HttpHandlerStatic
 
+#include <optional>
+
 #include <userver/components/fs_cache.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/fs/fs_cache_client.hpp>
@@ -28,10 +30,14 @@ namespace server::handlers {
 /// Inherits all the options from server::handlers::HttpHandlerBase and adds the
 /// following ones:
 ///
-/// Name               | Description                   | Default value
-/// ------------------ | ----------------------------- | -------------
-/// fs-cache-component | Name of the FsCache component | fs-cache-component
-/// expires            | Cache age in seconds          | 600
+/// Name                | Description                   | Default value
+/// ------------------- | ----------------------------- | -------------
+/// fs-cache-component  | Name of the FsCache component | fs-cache-component
+/// expires             | Cache age in seconds          | 600
+/// zero-copy-threshold | Files of this size in bytes and bigger are sent via sendfile(2) directly from the file system, without copying into userspace | disabled
+///
+/// Single range `Range: bytes=...` requests are supported and answered with
+/// HTTP 206 (or 416 if the range is not satisfiable).
 ///
 /// ## Example usage:
 ///
@@ -57,6 +63,7 @@ private:
     dynamic_config::Source config_;
     const fs::FsCacheClient& storage_;
     const std::chrono::seconds cache_age_;
+    const std::optional<std::size_t> zero_copy_threshold_;
 };
 
 }  // namespace server::handlers
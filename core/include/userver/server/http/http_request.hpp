@@ -4,6 +4,7 @@
 /// @brief @copybrief server::http::HttpRequest
 
 #include <chrono>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -13,6 +14,7 @@
 #include <userver/server/http/form_data_arg.hpp>
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_response.hpp>
+#include <userver/utils/arena.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
 #include <userver/utils/impl/internal_tag.hpp>
 #include <userver/utils/impl/transparent_hash.hpp>
@@ -28,6 +30,10 @@ class HttpHandlerBase;
 /// Server parts of the HTTP protocol implementation.
 namespace server::http {
 
+namespace impl {
+class RequestArenaPool;
+}  // namespace impl
+
 /// @brief HTTP Request data.
 /// @note do not create HttpRequest by hand in tests,
 ///       use HttpRequestBuilder instead.
@@ -43,6 +49,12 @@ public:
 
     /// @cond
     explicit HttpRequest(request::ResponseDataAccounter& data_accounter, utils::impl::InternalTag);
+
+    HttpRequest(
+        request::ResponseDataAccounter& data_accounter,
+        std::shared_ptr<impl::RequestArenaPool> arena_pool,
+        utils::impl::InternalTag
+    );
     /// @endcond
 
     HttpRequest(HttpRequest&&) = delete;
@@ -160,6 +172,10 @@ public:
 
     /// @return Value of the header with case insensitive name header_name, or an
     /// empty string if no such header.
+    /// @note Const header accessors may be called concurrently, e.g. from the
+    /// subtasks of a handler. In the handler-defaults.copy_headers_on_access
+    /// mode the headers are copied on first access under a lock. RemoveHeader()
+    /// must not be called concurrently with any of them.
     const std::string& GetHeader(std::string_view header_name) const;
 
     /// @overload
@@ -231,6 +247,14 @@ public:
     /// Get approximate time point of request handling start
     std::chrono::steady_clock::time_point GetStartTime() const;
 
+    /// @brief Per-request memory arena for scratch allocations of the handler,
+    /// e.g. with utils::ArenaAllocator.
+    ///
+    /// The memory is released at once with the request after the response is
+    /// sent, and the arena is reused by the next requests of the connection.
+    /// The arena is not thread-safe, use it from the handler task only.
+    utils::Arena& GetArena() const;
+
     /// @cond
     void MarkAsInternalServerError() const;
 
@@ -288,7 +312,7 @@ private:
     friend class HttpRequestHandler;
 
     struct Impl;
-    utils::FastPimpl<Impl, 1648, 16> pimpl_;
+    utils::FastPimpl<Impl, 1920, 16> pimpl_;
 };
 
 }  // namespace server::http
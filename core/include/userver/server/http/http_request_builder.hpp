@@ -16,6 +16,11 @@ class HttpRequestBuilder final {
 public:
     /// @cond
     explicit HttpRequestBuilder(request::ResponseDataAccounter& data_accounter);
+
+    HttpRequestBuilder(
+        request::ResponseDataAccounter& data_accounter,
+        std::shared_ptr<impl::RequestArenaPool> arena_pool
+    );
     /// @endcond
 
     HttpRequestBuilder();
@@ -51,6 +56,10 @@ public:
         utils::impl::TransparentMap<std::string, std::vector<FormDataArg>, utils::StrCaseHash>&& form_data_args
     );
 
+    // The header is kept in the request buffer and is copied into the
+    // HeadersMap on the first access
+    HttpRequestBuilder& AddRawHeader(std::string_view header, std::string_view value);
+
     HttpRequestBuilder& SetHttpHandler(const handlers::HttpHandlerBase& handler);
 
     HttpRequestBuilder& SetTaskProcessor(engine::TaskProcessor& task_processor);
@@ -4,6 +4,8 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 
@@ -20,6 +22,14 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine {
+class TaskProcessor;
+}  // namespace engine
+
+namespace fs::blocking {
+class FileDescriptor;
+}  // namespace fs::blocking
+
 namespace server::http {
 
 // RFC 9110 states that in case of missing Content-Type it may be assumed to be
@@ -34,6 +44,8 @@ class Http2ResponseWriter;
 
 namespace impl {
 
+class ResponseBodyCompressor;
+
 void OutputHeader(USERVER_NAMESPACE::http::headers::HeadersString& header, std::string_view key, std::string_view val);
 
 }  // namespace impl
@@ -124,9 +136,44 @@ public:
     /// empty string if no such cookie exists.
     const Cookie& GetCookie(std::string_view cookie_name) const;
 
+    /// @brief Use `size` bytes of the `file` starting from `offset` as the
+    /// response body.
+    ///
+    /// For HTTP/1.x over plain TCP the data is transferred with sendfile(2)
+    /// straight from the page cache, without copying it into userspace.
+    /// Otherwise the range is read from the file and sent as a usual body.
+    /// Both sendfile(2) and the reads are done on `fs_task_processor`, as they
+    /// block on disk I/O if the data is not in the page cache.
+    /// @note The file body is ignored if non-empty data is set for the response
+    /// (e.g. an error message).
+    void SetBodyFile(
+        fs::blocking::FileDescriptor file,
+        std::size_t offset,
+        std::size_t size,
+        engine::TaskProcessor& fs_task_processor
+    );
+
     /// @cond
     // TODO: server internals. remove from public interface
     void SendResponse(engine::io::RwBase& socket) override;
+
+    // Part of BytesSent() that was transferred without copying into userspace
+    // or into the kernel socket buffers
+    std::size_t BytesSentZeroCopy() const { return bytes_sent_zero_copy_; }
+
+    // Bodies of this size and bigger are sent with MSG_ZEROCOPY, the connection
+    // is reset if the peer does not acknowledge them within the timeout
+    void SetZeroCopyThreshold(std::optional<std::size_t> threshold, std::chrono::milliseconds timeout) {
+        zerocopy_threshold_ = threshold;
+        zerocopy_timeout_ = timeout;
+    }
+
+    // Chunks of a streamed body are compressed with the compressor, unless the
+    // response turns out to be not compressible by the end of headers: a reply
+    // to HEAD, a bodiless status, partial content or Content-Encoding set by
+    // the handler
+    void SetBodyStreamCompressor(std::unique_ptr<impl::ResponseBodyCompressor> compressor);
+    std::unique_ptr<impl::ResponseBodyCompressor> ExtractBodyStreamCompressor();
     /// @endcond
 
     void SetStatusServiceUnavailable() override { SetStatus(HttpStatus::kServiceUnavailable); }
@@ -153,6 +200,16 @@ private:
     // Returns total size of the response
     std::size_t SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
 
+    // Returns total size of the response
+    std::size_t SetBodyFromFile(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
+
+    // Returns total size of the response
+    std::size_t SetBodyFromChain(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
+
+    // Reads the whole file range set by SetBodyFile() into memory on the fs task
+    // processor
+    std::string ReadBodyFile();
+
     const HttpRequest& request_;
     HttpStatus status_ = HttpStatus::kOk;
     HeadersMap headers_;
@@ -162,6 +219,15 @@ private:
     std::optional<Queue::Consumer> body_stream_;
     Producer body_stream_producer_;
     bool is_stream_body_{false};
+
+    std::unique_ptr<fs::blocking::FileDescriptor> body_file_;
+    std::size_t body_file_offset_{0};
+    std::size_t body_file_size_{0};
+    engine::TaskProcessor* body_file_task_processor_{nullptr};
+    std::size_t bytes_sent_zero_copy_{0};
+    std::optional<std::size_t> zerocopy_threshold_;
+    std::chrono::milliseconds zerocopy_timeout_{};
+    std::unique_ptr<impl::ResponseBodyCompressor> body_stream_compressor_;
 };
 
 void SetThrottleReason(http::HttpResponse& http_response, std::string log_reason, std::string http_header_reason);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include <userver/server/http/http_response.hpp>
@@ -15,7 +16,7 @@ namespace server::http {
 
 class ResponseBodyStream final {
 public:
-    ResponseBodyStream(ResponseBodyStream&&) = default;
+    ResponseBodyStream(ResponseBodyStream&&);
     ~ResponseBodyStream();
 
     // Send a chunk of response data. It may NOT generate
@@ -40,6 +41,7 @@ private:
     bool headers_ended_{false};
     HttpResponse::Producer queue_producer_;
     HttpResponse& http_response_;
+    std::unique_ptr<impl::ResponseBodyCompressor> compressor_;
 };
 
 }  // namespace server::http
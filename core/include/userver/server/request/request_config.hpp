@@ -23,6 +23,8 @@ struct HttpRequestConfig {
     bool set_tracing_headers = true;
     bool deadline_propagation_enabled = true;
     http::HttpStatus deadline_expired_status_code = http::HttpStatus{498};
+    bool http1_fast_path_enabled = false;
+    bool copy_headers_on_access = false;
 };
 
 HttpRequestConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<HttpRequestConfig>);
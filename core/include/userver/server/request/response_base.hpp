@@ -11,6 +11,7 @@
 #include <userver/concurrent/striped_counter.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/impl/buffer_chain.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -82,8 +83,18 @@ public:
     virtual ~ResponseBase() noexcept;
 
     void SetData(std::string data);
-    const std::string& GetData() const { return data_; }
-    std::string&& ExtractData() { return std::move(data_); }
+
+    /// @note A body set as a chain of buffers is glued into a single string on
+    /// the first call
+    const std::string& GetData() const {
+        if (!body_chain_.IsEmpty()) FlattenBodyChain();
+        return data_;
+    }
+
+    std::string&& ExtractData() {
+        if (!body_chain_.IsEmpty()) FlattenBodyChain();
+        return std::move(data_);
+    }
 
     virtual bool IsBodyStreamed() const = 0;
     virtual bool WaitForHeadersEnd() = 0;
@@ -107,6 +118,13 @@ public:
     virtual void SetStatusOk() = 0;
     virtual void SetStatusNotFound() = 0;
 
+    // Chunks of the body are sent with writev right from the chain, without
+    // gluing them into a single string, unless the body is accessed with
+    // GetData(). The chain is ignored if non-empty data is set for the response
+    // (e.g. an error message).
+    void SetBodyChain(utils::impl::BufferChain body);
+    bool HasBodyChain() const noexcept { return !body_chain_.IsEmpty(); }
+
     // HTTP/2.0 only
     void SetStreamId(std::int32_t stream_id);
     std::optional<std::int32_t> GetStreamId() const { return stream_id_; }
@@ -119,7 +137,16 @@ protected:
 
     void SetSent(std::size_t bytes_sent, std::chrono::steady_clock::time_point sent_time);
 
+    // Accounts the body of `size` bytes, including the ones kept out of the data
+    void AccountData(std::size_t size);
+
+    // Unlike GetData() do not flatten the body chain
+    bool IsDataEmpty() const noexcept { return data_.empty(); }
+    const utils::impl::BufferChain& GetBodyChain() const noexcept { return body_chain_; }
+
 private:
+    void FlattenBodyChain() const;
+
     class Guard final {
     public:
         Guard(ResponseDataAccounter& accounter, std::chrono::steady_clock::time_point create_time, size_t size)
@@ -137,7 +164,10 @@ private:
 
     ResponseDataAccounter& accounter_;
     std::optional<Guard> guard_;
-    std::string data_;
+    // Flattened lazily by the const GetData(), a response is accessed by one
+    // task at a time
+    mutable std::string data_;
+    mutable utils::impl::BufferChain body_chain_;
     std::chrono::steady_clock::time_point create_time_;
     std::chrono::steady_clock::time_point ready_time_;
     std::chrono::steady_clock::time_point sent_time_;
@@ -25,6 +25,9 @@ public:
     void SetSpanId(std::string span_id);
     void SetParentSpanId(std::string parent_span_id);
     void SetParentLink(std::string parent_link);
+    /// Sampling decision of the upstream service, overrides the local head
+    /// sampling of @ref USERVER_TRACING_SAMPLING
+    void SetSampled(bool sampled);
     void AddTagFrozen(std::string key, logging::LogExtra::Value value);
     void AddNonInheritableTag(std::string key, logging::LogExtra::Value value);
     Span Build() &&;
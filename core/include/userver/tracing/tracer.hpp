@@ -15,12 +15,15 @@ class TagWriter;
 namespace tracing {
 
 struct NoLogSpans;
+struct SamplingConfig;
 
 class Tracer : public std::enable_shared_from_this<Tracer> {
 public:
     static void SetNoLogSpans(NoLogSpans&& spans);
     static bool IsNoLogSpan(const std::string& name);
 
+    static void SetSamplingConfig(SamplingConfig&& config);
+
     static void SetTracer(TracerPtr tracer);
 
     static TracerPtr GetTracer();
@@ -0,0 +1,22 @@
+#include <userver/clients/http/body_compression.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+std::string_view ToString(ContentCoding coding) {
+    switch (coding) {
+        case ContentCoding::kGzip:
+            return "gzip";
+        case ContentCoding::kZstd:
+            return "zstd";
+    }
+
+    UINVARIANT(false, "Unexpected content coding");
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
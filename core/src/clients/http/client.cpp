@@ -53,6 +53,11 @@ Client::Client(
       statistics_(settings.io_threads),
       fs_task_processor_(fs_task_processor),
       user_agent_(utils::GetUserverIdentifier()),
+      body_compression_rules_(
+          settings.body_compression_rules.empty()
+              ? nullptr
+              : std::make_shared<const std::vector<BodyCompressionRule>>(std::move(settings.body_compression_rules))
+      ),
       connect_rate_limiter_(std::make_shared<curl::ConnectRateLimiter>()),
       tracing_manager_(GetTracingManager(settings)),
       plugin_pipeline_(std::move(plugin_pipeline)) {
@@ -79,6 +84,14 @@ Client::Client(
         }
     }).Get();
 
+    SetMultiplexingEnabled(settings.http2_multiplexing);
+    if (settings.max_host_connections > 0) {
+        SetMaxHostConnections(settings.max_host_connections);
+    }
+    for (auto& multi : multis_) {
+        multi->SetMaxConcurrentStreams(ClampToLong(settings.http2_max_concurrent_streams));
+    }
+
     easy_reinit_task_.Start("http_easy_reinit", utils::PeriodicTask::Settings(kEasyReinitPeriod), [this] {
         ReinitEasy();
     });
@@ -124,33 +137,45 @@ Request Client::CreateRequest() {
                 plugin_pipeline_,
                 *tracing_manager_.GetBase()};
         } else {
-            auto i = utils::RandRange(multis_.size());
-            auto& multi = multis_[i];
-
-            try {
-                auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
-                                   return impl::EasyWrapper{easy_.Get()->GetBoundBlocking(*multi), *this};
-                               }).Get();
-                return Request{
-                    std::move(wrapper),
-                    statistics_[i].CreateRequestStats(),
-                    destination_statistics_,
-                    resolver_,
-                    plugin_pipeline_,
-                    *tracing_manager_.GetBase()};
-            } catch (engine::WaitInterruptedException&) {
-                throw clients::http::CancelException("wait interrupted", {}, ErrorKind::kCancel);
-            } catch (engine::TaskCancelledException&) {
-                throw clients::http::CancelException("task cancelled", {}, ErrorKind::kCancel);
-            }
+            return CreateBoundRequest(utils::RandRange(multis_.size()));
         }
     }();
 
+    ApplyRequestDefaults(request);
+    return request;
+}
+
+Request Client::CreateBoundRequest(std::size_t multi_index) {
+    UASSERT(multi_index < multis_.size());
+    auto& multi = multis_[multi_index];
+
+    try {
+        auto wrapper = engine::AsyncNoSpan(fs_task_processor_, [this, &multi] {
+                           return impl::EasyWrapper{easy_.Get()->GetBoundBlocking(*multi), *this};
+                       }).Get();
+        return Request{
+            std::move(wrapper),
+            statistics_[multi_index].CreateRequestStats(),
+            destination_statistics_,
+            resolver_,
+            plugin_pipeline_,
+            *tracing_manager_.GetBase()};
+    } catch (engine::WaitInterruptedException&) {
+        throw clients::http::CancelException("wait interrupted", {}, ErrorKind::kCancel);
+    } catch (engine::TaskCancelledException&) {
+        throw clients::http::CancelException("task cancelled", {}, ErrorKind::kCancel);
+    }
+}
+
+void Client::ApplyRequestDefaults(Request& request) {
     if (testsuite_config_) {
         request.SetTestsuiteConfig(testsuite_config_);
     }
     auto urls = allowed_urls_extra_.Read();
     request.SetAllowedUrlsExtra(*urls);
+    if (body_compression_rules_) {
+        request.SetBodyCompressionRules(body_compression_rules_);
+    }
 
     if (user_agent_) {
         request.user_agent(*user_agent_);
@@ -164,8 +189,32 @@ Request Client::CreateRequest() {
     }
     request.SetDeadlinePropagationConfig(deadline_propagation_config_);
     request.SetCancellationPolicy(cancellation_policy_);
+}
 
-    return request;
+void Client::PrewarmConnections(const std::vector<std::string>& urls, std::chrono::milliseconds timeout) {
+    std::vector<std::pair<std::string_view, ResponseFuture>> futures;
+    futures.reserve(urls.size() * multis_.size());
+
+    for (const auto& url : urls) {
+        for (std::size_t i = 0; i < multis_.size(); ++i) {
+            auto request = CreateBoundRequest(i);
+            ApplyRequestDefaults(request);
+            request.head(url).timeout(timeout);
+            futures.emplace_back(url, request.async_perform());
+        }
+    }
+
+    std::size_t failed = 0;
+    for (auto& [url, future] : futures) {
+        try {
+            future.Get();
+        } catch (const std::exception& e) {
+            ++failed;
+            LOG_WARNING() << "Failed to prewarm connection to " << url << ": " << e;
+        }
+    }
+    LOG_INFO() << "Prewarmed " << (futures.size() - failed) << " of " << futures.size()
+               << " HTTP client connections";
 }
 
 void Client::SetMultiplexingEnabled(bool enabled) {
@@ -7,11 +7,15 @@
 #include <boost/algorithm/string/trim.hpp>
 
 #include <clients/http/client_utils_test.hpp>
+#include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
+#include <compression/gzip.hpp>
 #include <engine/task/task_processor.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
+#include <userver/clients/http/streamed_request_body.hpp>
 #include <userver/clients/http/streamed_response.hpp>
+#include <userver/compression/zstd.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/crypto/certificate.hpp>
 #include <userver/crypto/private_key.hpp>
@@ -25,6 +29,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/tracing/tracing.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/text_light.hpp>
 #include <userver/utils/userver_info.hpp>
 
 #include <userver/utest/http_client.hpp>
@@ -276,6 +281,12 @@ HttpResponse sleep_callback_1s(const HttpRequest& request) {
     return sleep_callback_base(request, std::chrono::seconds(1));
 }
 
+HttpResponse keep_alive_callback(const HttpRequest& request) {
+    LOG_INFO() << "HTTP Server receive: " << request;
+
+    return {"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndContinue};
+}
+
 HttpResponse huge_data_callback(const HttpRequest& request) {
     LOG_INFO() << "HTTP Server receive: " << request;
 
@@ -630,6 +641,32 @@ UTEST(HttpClient, StatsOnTimeout) {
     }
 }
 
+UTEST(HttpClient, PrewarmConnections) {
+    const utest::SimpleServer http_server{&keep_alive_callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    const auto connections_reused = [&http_client_ptr] {
+        utils::statistics::Rate result;
+        for (const auto& stats : http_client_ptr->GetPoolStatistics().multi) {
+            result += stats.connections_reused;
+        }
+        return result;
+    };
+
+    http_client_ptr->PrewarmConnections({http_server.GetBaseUrl()}, kTimeout);
+    EXPECT_EQ(connections_reused(), utils::statistics::Rate{0});
+
+    for (unsigned i = 0; i < kFewRepetitions; ++i) {
+        auto response = http_client_ptr->CreateRequest()
+                            .get(http_server.GetBaseUrl())
+                            .http_version(USERVER_NAMESPACE::http::HttpVersion::k11)
+                            .timeout(kTimeout)
+                            .perform();
+        EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+    }
+    EXPECT_EQ(connections_reused(), utils::statistics::Rate{kFewRepetitions});
+}
+
 UTEST(HttpClient, CancelPre) {
     auto task = utils::Async("test", [] {
         const utest::SimpleServer http_server{EchoCallback{}};
@@ -1180,6 +1217,276 @@ UTEST(HttpClient, GetWithBody) {
     EXPECT_EQ(another_response->headers()[std::string_view{"XXX"}], "good");
 }
 
+UTEST(HttpClient, StreamedRequestBody) {
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    auto received = std::make_shared<std::string>();
+    const utest::SimpleServer http_server{[received](const HttpRequest& request) -> HttpResponse {
+        if (!utils::text::EndsWith(request, "\r\n0\r\n\r\n")) return {{}, HttpResponse::kTryReadMore};
+
+        *received = request;
+        return {"HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndClose};
+    }};
+
+    /// [Sample HTTP Client streamed request body]
+    clients::http::StreamedRequestBody body;
+    auto future = http_client_ptr->CreateRequest()
+                      .put(http_server.GetBaseUrl())
+                      .data_stream(body)
+                      .http_version(USERVER_NAMESPACE::http::HttpVersion::k11)
+                      .timeout(kTimeout)
+                      .async_perform();
+
+    for (unsigned i = 0; i < kFewRepetitions; ++i) {
+        ASSERT_TRUE(body.Push(fmt::format("chunk{};", i)));
+        engine::SleepFor(std::chrono::milliseconds{10});
+    }
+    body.Finish();
+
+    const auto response = future.Get();
+    /// [Sample HTTP Client streamed request body]
+    EXPECT_TRUE(response->IsOk());
+
+    EXPECT_NE(received->find("PUT / HTTP/1.1\r\n"), std::string::npos) << *received;
+    EXPECT_NE(received->find("Transfer-Encoding: chunked\r\n"), std::string::npos) << *received;
+    std::size_t pos = 0;
+    for (unsigned i = 0; i < kFewRepetitions; ++i) {
+        pos = received->find(fmt::format("chunk{};", i), pos);
+        EXPECT_NE(pos, std::string::npos) << *received;
+    }
+}
+
+UTEST(HttpClient, StreamedRequestBodyContentLength) {
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    constexpr std::size_t kMaxBufferedBytes = 16;
+    const std::string data(kMaxBufferedBytes * 10 + 1, '@');
+
+    auto received = std::make_shared<std::string>();
+    const utest::SimpleServer http_server{[received, &data](const HttpRequest& request) -> HttpResponse {
+        if (!utils::text::EndsWith(request, "\r\n\r\n" + data)) return {{}, HttpResponse::kTryReadMore};
+
+        *received = request;
+        return {"HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndClose};
+    }};
+
+    clients::http::StreamedRequestBody body{kMaxBufferedBytes};
+    auto future = http_client_ptr->CreateRequest()
+                      .post(http_server.GetBaseUrl())
+                      .data_stream(body, data.size())
+                      .timeout(kTimeout)
+                      .async_perform();
+
+    // Bigger than the buffer, is sent in parts
+    ASSERT_TRUE(body.Push(data));
+    body.Finish();
+
+    EXPECT_TRUE(future.Get()->IsOk());
+    EXPECT_NE(received->find(fmt::format("Content-Length: {}\r\n", data.size())), std::string::npos) << *received;
+}
+
+UTEST(HttpClient, StreamedRequestBodyEarlyResponse) {
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    // Responds without reading the body and closes the connection
+    const utest::SimpleServer http_server{[](const HttpRequest&) -> HttpResponse {
+        return {
+            "HTTP/1.1 413 Payload Too Large\r\nConnection: close\r\nContent-Length: 0\r\n\r\n",
+            HttpResponse::kWriteAndClose};
+    }};
+
+    constexpr std::size_t kMaxBufferedBytes = 16;
+    clients::http::StreamedRequestBody body{kMaxBufferedBytes};
+    auto future = http_client_ptr->CreateRequest()
+                      .post(http_server.GetBaseUrl())
+                      .data_stream(body)
+                      .timeout(kTimeout)
+                      .async_perform();
+
+    // Would wait forever if the finished request kept the body queue
+    const std::string chunk(kMaxBufferedBytes, '@');
+    while (body.Push(chunk)) {
+    }
+
+    try {
+        EXPECT_EQ(future.Get()->status_code(), clients::http::Status::kPayloadTooLarge);
+    } catch (const clients::http::BaseException& e) {
+        // The connection may be reset while the body is being sent
+        LOG_INFO() << "Request failed: " << e;
+    }
+}
+
+namespace {
+
+// Returns the body of a complete request with Content-Length, std::nullopt
+// if the request is not fully read yet
+std::optional<std::string> FindRequestBody(const std::string& request) {
+    const auto headers_end = request.find("\r\n\r\n");
+    if (headers_end == std::string::npos) return std::nullopt;
+
+    constexpr std::string_view kContentLength = "Content-Length: ";
+    const auto length_pos = request.find(kContentLength);
+    if (length_pos == std::string::npos || length_pos > headers_end) return std::nullopt;
+    const auto length = std::stoul(request.substr(length_pos + kContentLength.size()));
+
+    const auto body_begin = headers_end + 4;
+    if (request.size() < body_begin + length) return std::nullopt;
+    return request.substr(body_begin, length);
+}
+
+std::string MakeCompressibleBody() {
+    std::string result;
+    for (unsigned i = 0; i < 1000; ++i) {
+        result += fmt::format(R"({{"id": {}, "name": "item", "tags": ["a", "b"]}},)", i);
+    }
+    return result;
+}
+
+}  // namespace
+
+UTEST(HttpClient, CompressedRequestBody) {
+    auto http_client_ptr = utest::CreateHttpClient();
+    const auto data = MakeCompressibleBody();
+
+    auto received = std::make_shared<std::string>();
+    const utest::SimpleServer http_server{[received](const HttpRequest& request) -> HttpResponse {
+        if (!FindRequestBody(request)) return {{}, HttpResponse::kTryReadMore};
+
+        *received = request;
+        return {"HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndClose};
+    }};
+
+    for (const auto coding : {clients::http::ContentCoding::kGzip, clients::http::ContentCoding::kZstd}) {
+        const auto response = http_client_ptr->CreateRequest()
+                                  .post(http_server.GetBaseUrl(), data)
+                                  .compress_body({coding})
+                                  .timeout(kTimeout)
+                                  .perform();
+        EXPECT_TRUE(response->IsOk());
+
+        EXPECT_NE(
+            received->find(fmt::format("Content-Encoding: {}\r\n", clients::http::ToString(coding))),
+            std::string::npos
+        ) << *received;
+        const auto body = FindRequestBody(*received);
+        ASSERT_TRUE(body);
+        EXPECT_LT(body->size(), data.size());
+        if (coding == clients::http::ContentCoding::kZstd) {
+            EXPECT_EQ(compression::zstd::Decompress(*body, data.size()), data);
+        }
+    }
+
+    // Small bodies are not worth compressing
+    const auto response = http_client_ptr->CreateRequest()
+                              .post(http_server.GetBaseUrl(), "small")
+                              .compress_body({clients::http::ContentCoding::kZstd, {}, {}, 100})
+                              .timeout(kTimeout)
+                              .perform();
+    EXPECT_TRUE(response->IsOk());
+    EXPECT_EQ(received->find("Content-Encoding"), std::string::npos) << *received;
+    EXPECT_EQ(FindRequestBody(*received), "small");
+}
+
+UTEST(HttpClient, CompressedRequestBodyDictionary) {
+    auto http_client_ptr = utest::CreateHttpClient();
+    const auto data = MakeCompressibleBody();
+    const auto dictionary = std::make_shared<const compression::zstd::Dictionary>(data.substr(0, 1024));
+
+    auto received = std::make_shared<std::string>();
+    const utest::SimpleServer http_server{[received, dictionary, &data](const HttpRequest& request) -> HttpResponse {
+        if (!FindRequestBody(request)) return {{}, HttpResponse::kTryReadMore};
+
+        *received = request;
+        const auto reply = compression::zstd::Compress(data, *dictionary);
+        return {
+            fmt::format(
+                "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Encoding: zstd\r\nContent-Length: {}\r\n\r\n{}",
+                reply.size(),
+                reply
+            ),
+            HttpResponse::kWriteAndClose};
+    }};
+
+    const auto response = http_client_ptr->CreateRequest()
+                              .post(http_server.GetBaseUrl(), data)
+                              .compress_body({clients::http::ContentCoding::kZstd, {}, dictionary})
+                              .timeout(kTimeout)
+                              .perform();
+    EXPECT_TRUE(response->IsOk());
+    EXPECT_EQ(response->body_view(), data);
+
+    EXPECT_NE(received->find("Content-Encoding: zstd\r\n"), std::string::npos) << *received;
+    EXPECT_NE(received->find("Accept-Encoding: zstd, gzip\r\n"), std::string::npos) << *received;
+    const auto body = FindRequestBody(*received);
+    ASSERT_TRUE(body);
+    EXPECT_LT(body->size(), compression::zstd::Compress(data).size());
+    EXPECT_EQ(compression::zstd::Decompress(*body, data.size(), *dictionary), data);
+}
+
+UTEST(HttpClient, CompressedRequestBodyDictionaryMalformedReply) {
+    auto http_client_ptr = utest::CreateHttpClient();
+    const auto data = MakeCompressibleBody();
+    const auto dictionary = std::make_shared<const compression::zstd::Dictionary>(data.substr(0, 1024));
+
+    const utest::SimpleServer http_server{[](const HttpRequest& request) -> HttpResponse {
+        if (!FindRequestBody(request)) return {{}, HttpResponse::kTryReadMore};
+
+        constexpr std::string_view kReply = "not a zstd frame";
+        return {
+            fmt::format(
+                "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Encoding: zstd\r\nContent-Length: {}\r\n\r\n{}",
+                kReply.size(),
+                kReply
+            ),
+            HttpResponse::kWriteAndClose};
+    }};
+
+    auto request = http_client_ptr->CreateRequest()
+                       .post(http_server.GetBaseUrl(), data)
+                       .compress_body({clients::http::ContentCoding::kZstd, {}, dictionary})
+                       .timeout(kTimeout);
+    UEXPECT_THROW([[maybe_unused]] auto response = request.perform(), clients::http::TechnicalError);
+}
+
+UTEST(HttpClient, CompressedRequestBodyDictionaryStreamedReply) {
+    auto http_client_ptr = utest::CreateHttpClient();
+    const auto data = MakeCompressibleBody();
+    const auto dictionary = std::make_shared<const compression::zstd::Dictionary>(data.substr(0, 1024));
+
+    auto received = std::make_shared<std::string>();
+    const utest::SimpleServer http_server{[received, &data](const HttpRequest& request) -> HttpResponse {
+        if (!FindRequestBody(request)) return {{}, HttpResponse::kTryReadMore};
+
+        *received = request;
+        const auto reply = compression::gzip::Compress(data);
+        return {
+            fmt::format(
+                "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Encoding: gzip\r\nContent-Length: {}\r\n\r\n{}",
+                reply.size(),
+                reply
+            ),
+            HttpResponse::kWriteAndClose};
+    }};
+
+    auto queue = concurrent::StringStreamQueue::Create();
+    auto stream_response = http_client_ptr->CreateRequest()
+                               .post(http_server.GetBaseUrl(), data)
+                               .compress_body({clients::http::ContentCoding::kZstd, {}, dictionary})
+                               .timeout(kTimeout)
+                               .async_perform_stream_body(queue);
+    EXPECT_EQ(stream_response.StatusCode(), clients::http::Status::kOk);
+
+    // Streamed replies are decoded by cURL, not handed out compressed
+    std::string body;
+    std::string body_part;
+    const auto deadline = engine::Deadline::FromDuration(kTimeout);
+    while (stream_response.ReadChunk(body_part, deadline)) {
+        body += body_part;
+    }
+    EXPECT_EQ(body, data);
+    EXPECT_EQ(received->find("Accept-Encoding: zstd, gzip\r\n"), std::string::npos) << *received;
+}
+
 // Make sure that cURL was build with the fix:
 // https://github.com/curl/curl/commit/a12a16151aa33dfd5e7627d4bfc2dc1673a7bf8e
 UTEST(HttpClient, RedirectHeaders) {
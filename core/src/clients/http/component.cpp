@@ -25,6 +25,7 @@ namespace components {
 namespace {
 
 constexpr size_t kDestinationMetricsAutoMaxSizeDefault = 100;
+constexpr std::chrono::milliseconds kPrewarmTimeoutDefault{1000};
 constexpr std::string_view kHttpClientPluginPrefix = "http-client-plugin-";
 
 clients::http::ClientSettings
@@ -127,6 +128,13 @@ HttpClient::HttpClient(const ComponentConfig& component_config, const ComponentC
     statistics_holder_ = storage.RegisterWriter(std::move(stats_name), [this](utils::statistics::Writer& writer) {
         return WriteStatistics(writer);
     });
+
+    const auto prewarm_urls = component_config["prewarm-urls"].As<std::vector<std::string>>({});
+    if (!prewarm_urls.empty()) {
+        http_client_.PrewarmConnections(
+            prewarm_urls, component_config["prewarm-timeout"].As<std::chrono::milliseconds>(kPrewarmTimeoutDefault)
+        );
+    }
 }
 
 std::vector<utils::NotNull<clients::http::Plugin*>>
@@ -231,6 +239,62 @@ properties:
         enum:
           - cancel
           - ignore
+    http2-multiplexing:
+        type: boolean
+        description: whether to send concurrent requests to the same host over a single HTTP/2 connection
+        defaultDescription: true
+    http2-max-concurrent-streams:
+        type: integer
+        description: max number of concurrent streams over a single HTTP/2 connection
+        defaultDescription: 100
+        minimum: 1
+    max-host-connections:
+        type: integer
+        description: |
+            max number of connections to a single host per IO thread, 0 for no limit;
+            the same limit applies to every host separately, per-destination values are not supported
+        defaultDescription: 0
+        minimum: 0
+    prewarm-urls:
+        type: array
+        description: URLs to open connections to from each of the IO threads at component start
+        items:
+            type: string
+            description: URL
+    prewarm-timeout:
+        type: string
+        description: timeout for each of the prewarm requests
+        defaultDescription: 1s
+    request-body-compression:
+        type: array
+        description: request body compression rules, the first one with url-prefix matching the request URL is used
+        defaultDescription: '[]'
+        items:
+            type: object
+            description: request body compression rule
+            additionalProperties: false
+            properties:
+                url-prefix:
+                    type: string
+                    description: URL prefix of the requests to compress
+                coding:
+                    type: string
+                    description: content coding of the bodies
+                    enum:
+                      - gzip
+                      - zstd
+                level:
+                    type: integer
+                    description: compression level
+                    defaultDescription: default level of the coding
+                zstd-dictionary:
+                    type: string
+                    description: path to a trained zstd dictionary, known to the receiver
+                min-size:
+                    type: integer
+                    description: bodies smaller than this are sent as is
+                    defaultDescription: 0
+                    minimum: 0
 )");
 }
 
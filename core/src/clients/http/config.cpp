@@ -2,8 +2,10 @@
 
 #include <string_view>
 
+#include <userver/compression/zstd.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/formats/json/value.hpp>
+#include <userver/fs/blocking/read.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -38,6 +40,35 @@ DeadlinePropagationConfig ParseDeadlinePropagationConfig(const yaml_config::Yaml
     return result;
 }
 
+ContentCoding ParseContentCoding(const yaml_config::YamlConfig& value) {
+    const auto str = value.As<std::string>();
+    if (str == ToString(ContentCoding::kGzip)) return ContentCoding::kGzip;
+    if (str == ToString(ContentCoding::kZstd)) return ContentCoding::kZstd;
+    throw std::runtime_error("Invalid request body content coding: " + str);
+}
+
+BodyCompressionRule ParseBodyCompressionRule(const yaml_config::YamlConfig& value) {
+    BodyCompressionRule result;
+    result.url_prefix = value["url-prefix"].As<std::string>();
+
+    auto& compression = result.compression;
+    compression.coding = ParseContentCoding(value["coding"]);
+    compression.level = value["level"].As<std::optional<int>>();
+    compression.min_size = value["min-size"].As<std::size_t>(compression.min_size);
+
+    const auto dictionary_path = value["zstd-dictionary"].As<std::optional<std::string>>();
+    if (dictionary_path) {
+        if (compression.coding != ContentCoding::kZstd) {
+            throw std::runtime_error("zstd-dictionary is set for a non-zstd coding at " + value.GetPath());
+        }
+        compression.dictionary = std::make_shared<const USERVER_NAMESPACE::compression::zstd::Dictionary>(
+            fs::blocking::ReadFileContents(*dictionary_path),
+            compression.level.value_or(USERVER_NAMESPACE::compression::zstd::kDefaultLevel)
+        );
+    }
+    return result;
+}
+
 }  // namespace
 
 CancellationPolicy Parse(yaml_config::YamlConfig value, formats::parse::To<CancellationPolicy>) {
@@ -52,6 +83,16 @@ ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<Cl
     result.thread_name_prefix = value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
     result.io_threads = value["threads"].As<size_t>(result.io_threads);
     result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+    result.http2_multiplexing = value["http2-multiplexing"].As<bool>(result.http2_multiplexing);
+    result.max_host_connections = value["max-host-connections"].As<size_t>(result.max_host_connections);
+    result.http2_max_concurrent_streams =
+        value["http2-max-concurrent-streams"].As<size_t>(result.http2_max_concurrent_streams);
+    const auto body_compression = value["request-body-compression"];
+    if (!body_compression.IsMissing()) {
+        for (const auto& rule : body_compression) {
+            result.body_compression_rules.push_back(ParseBodyCompressionRule(rule));
+        }
+    }
     return result;
 }
 
@@ -24,6 +24,12 @@ static HttpResponse Callback(int code, const HttpRequest& request) {
         HttpResponse::kWriteAndClose};
 }
 
+static HttpResponse KeepAliveCallback(const HttpRequest& request) {
+    LOG_INFO() << "HTTP Server receive: " << request;
+
+    return {"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n", HttpResponse::kWriteAndContinue};
+}
+
 UTEST(DestinationStatistics, Empty) {
     auto client = utest::CreateHttpClient();
 
@@ -117,4 +123,47 @@ UTEST(DestinationStatistics, Multiple) {
     }
 }
 
+UTEST(DestinationStatistics, ConnectionsReused) {
+    const utest::SimpleServer http_server{&KeepAliveCallback};
+    const utest::SimpleServer http_server2{&KeepAliveCallback};
+    auto client = utest::CreateHttpClient();
+
+    client->SetDestinationMetricsAutoMaxSize(100);
+
+    const auto url = http_server.GetBaseUrl();
+    const auto url2 = http_server2.GetBaseUrl();
+
+    constexpr std::size_t kRequests = 3;
+    for (std::size_t i = 0; i < kRequests; ++i) {
+        auto response = client->CreateRequest()
+                            .get(url)
+                            .http_version(USERVER_NAMESPACE::http::HttpVersion::k11)
+                            .timeout(utest::kMaxTestWaitTime)
+                            .perform();
+        EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+    }
+    auto response = client->CreateRequest()
+                        .get(url2)
+                        .http_version(USERVER_NAMESPACE::http::HttpVersion::k11)
+                        .timeout(utest::kMaxTestWaitTime)
+                        .perform();
+    EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+
+    // Connection metrics are labeled by destination, like the other ones
+    std::size_t size = 0;
+    for (const auto& [stat_url, stat_ptr] : client->GetDestinationStatistics()) {
+        ASSERT_LE(++size, 2);
+        ASSERT_NE(nullptr, stat_ptr);
+
+        const clients::http::InstanceStatistics stats{*stat_ptr};
+        if (stat_url == url) {
+            EXPECT_EQ(utils::statistics::Rate{kRequests - 1}, stats.connections_reused);
+        } else {
+            EXPECT_EQ(url2, stat_url);
+            EXPECT_EQ(utils::statistics::Rate{0}, stats.connections_reused);
+        }
+    }
+    EXPECT_EQ(size, 2);
+}
+
 USERVER_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
 #include <userver/clients/http/response_future.hpp>
+#include <userver/clients/http/streamed_request_body.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/future.hpp>
@@ -343,6 +344,7 @@ Request Request::connect_to(const ConnectTo& connect_to) && { return std::move(t
 Request& Request::data(std::string data) & {
     if (!data.empty()) pimpl_->easy().add_header(kHeaderExpect, "", curl::easy::EmptyHeaderAction::kDoNotSend);
     pimpl_->easy().set_post_fields(std::move(data));
+    pimpl_->ResetBodyCompressed();
     return *this;
 }
 Request Request::data(std::string data) && { return std::move(this->data(std::move(data))); }
@@ -354,6 +356,23 @@ Request& Request::form(Form&& form) & {
 }
 Request Request::form(Form&& form) && { return std::move(this->form(std::move(form))); }
 
+Request& Request::data_stream(StreamedRequestBody& body, std::optional<std::size_t> content_length) & {
+    pimpl_->easy().add_header(kHeaderExpect, "", curl::easy::EmptyHeaderAction::kDoNotSend);
+    pimpl_->SetBodyStream(body, content_length);
+    return *this;
+}
+Request Request::data_stream(StreamedRequestBody& body, std::optional<std::size_t> content_length) && {
+    return std::move(this->data_stream(body, content_length));
+}
+
+Request& Request::compress_body(BodyCompression compression) & {
+    pimpl_->SetBodyCompression(std::move(compression));
+    return *this;
+}
+Request Request::compress_body(BodyCompression compression) && {
+    return std::move(this->compress_body(std::move(compression)));
+}
+
 Request& Request::headers(const Headers& headers) & {
     SetHeaders(pimpl_->easy(), headers);
     return *this;
@@ -444,7 +463,7 @@ Request& Request::method(HttpMethod method) & {
         case HttpMethod::kPatch:
             pimpl_->easy().set_custom_request(ToString(method));
             // ensure a body as we should send Content-Length for this method
-            if (!pimpl_->easy().has_post_data()) data({});
+            if (!pimpl_->easy().has_post_data() && !pimpl_->HasBodyStream()) data({});
             break;
     };
     return *this;
@@ -543,6 +562,10 @@ void Request::SetTestsuiteConfig(const std::shared_ptr<const TestsuiteConfig>& c
 
 void Request::SetAllowedUrlsExtra(const std::vector<std::string>& urls) & { pimpl_->SetAllowedUrlsExtra(urls); }
 
+void Request::SetBodyCompressionRules(std::shared_ptr<const std::vector<BodyCompressionRule>> rules) & {
+    pimpl_->SetBodyCompressionRules(std::move(rules));
+}
+
 void Request::SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config) & {
     pimpl_->SetDeadlinePropagationConfig(deadline_propagation_config);
 }
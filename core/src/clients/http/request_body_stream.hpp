@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <userver/clients/http/streamed_request_body.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace curl {
+class easy;
+}  // namespace curl
+
+namespace clients::http::impl {
+
+/// Consumer side of a StreamedRequestBody, read by cURL from the event loop.
+///
+/// When there is no data yet the transfer is paused, the producer wakes it up
+/// on the next push or on the end of the body.
+class RequestBodyStream final {
+public:
+    RequestBodyStream(StreamedRequestBody::Queue::Consumer&& consumer, std::weak_ptr<curl::easy> easy);
+
+    /// CURLOPT_READFUNCTION
+    static std::size_t ReadFunction(void* ptr, std::size_t size, std::size_t nmemb, void* userdata);
+
+    /// Resumes the paused transfer, may be called from any thread
+    void Notify();
+
+    /// Stops reading the body, so that the producer is not blocked anymore.
+    /// Must not be called concurrently with cURL reading the body.
+    void Close();
+
+private:
+    std::size_t Read(char* buffer, std::size_t size);
+    bool PopChunk();
+
+    StreamedRequestBody::Queue::Consumer consumer_;
+    const std::weak_ptr<curl::easy> easy_;
+
+    std::string chunk_;
+    std::size_t chunk_offset_{0};
+    bool finished_{false};
+    std::atomic<bool> paused_{false};
+};
+
+}  // namespace clients::http::impl
+
+USERVER_NAMESPACE_END
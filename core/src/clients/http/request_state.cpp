@@ -12,10 +12,13 @@
 #include <openssl/x509.h>
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <compression/gzip.hpp>
 #include <curl-ev/error_code.hpp>
 #include <userver/baggage/baggage.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
+#include <userver/compression/error.hpp>
+#include <userver/compression/zstd.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
@@ -52,6 +55,9 @@ constexpr Status kFakeHttpErrorCode{599};
 
 constexpr std::string_view kTracingClientName = "external";
 
+/// Limits the size of the replies decoded by the client itself
+constexpr std::size_t kMaxDecodedReplySize = 1024 * 1024 * 1024;
+
 constexpr utils::TrivialBiMap kTestsuiteActions = [](auto selector) {
     return selector()
         .Case("timeout", curl::errc::EasyErrorCode::kOperationTimedout)
@@ -97,6 +103,8 @@ bool IsSetCookie(std::string_view key) {
 // Not a strict check, but OK for non-header line check
 bool IsHttpStatusLineStart(const char* ptr, size_t size) { return (size > 5 && memcmp(ptr, "HTTP/", 5) == 0); }
 
+bool IsHttp2StatusLine(const char* ptr, size_t size) { return (size > 7 && memcmp(ptr, "HTTP/2 ", 7) == 0); }
+
 char* rfind_not_space(char* ptr, size_t size) {
     for (char* p = ptr + size - 1; p >= ptr; --p) {
         const char c = *p;
@@ -388,10 +396,69 @@ void RequestState::SetTestsuiteConfig(const std::shared_ptr<const TestsuiteConfi
 
 void RequestState::SetAllowedUrlsExtra(const std::vector<std::string>& urls) { allowed_urls_extra_ = urls; }
 
-void RequestState::DisableReplyDecoding() { easy().set_accept_encoding(nullptr); }
+void RequestState::DisableReplyDecoding() {
+    easy().set_accept_encoding(nullptr);
+    is_reply_decoding_disabled_ = true;
+}
+
+void RequestState::SetBodyCompression(BodyCompression compression) {
+    UINVARIANT(
+        !compression.dictionary || compression.coding == ContentCoding::kZstd,
+        "zstd dictionary is set for a non-zstd request body compression"
+    );
+    body_compression_ = std::move(compression);
+}
+
+void RequestState::SetBodyCompressionRules(std::shared_ptr<const std::vector<BodyCompressionRule>> rules) {
+    body_compression_rules_ = std::move(rules);
+}
+
+void RequestState::DecodeResponseBody(Response& response) const {
+    if (!reply_dictionary_) return;
+
+    const auto it = response.headers().find(USERVER_NAMESPACE::http::headers::kContentEncoding);
+    if (it == response.headers().end()) return;
+
+    const auto& coding = it->second;
+    try {
+        if (coding == ToString(ContentCoding::kZstd)) {
+            response.sink_string() =
+                compression::zstd::Decompress(response.sink_string(), kMaxDecodedReplySize, *reply_dictionary_);
+        } else if (coding == ToString(ContentCoding::kGzip)) {
+            response.sink_string() = compression::gzip::Decompress(response.sink_string(), kMaxDecodedReplySize);
+        }
+    } catch (const compression::DecompressionError& ex) {
+        // The same error as cURL reports for the replies it decodes by itself
+        throw TechnicalError(
+            curl::errc::EasyErrorCode::kBadContentEncoding,
+            fmt::format("Failed to decode the response body: {}", ex.what()),
+            GetLoggedOriginalUrl(),
+            response.GetStats()
+        );
+    }
+}
 
 void RequestState::SetCancellationPolicy(CancellationPolicy cp) { cancellation_policy_ = cp; }
 
+void RequestState::SetBodyStream(StreamedRequestBody& body, std::optional<std::size_t> content_length) {
+    UINVARIANT(body.producer_, "Attempt to send a finished request body stream");
+
+    auto& easy = this->easy();
+    body_stream_ = std::make_shared<impl::RequestBodyStream>(body.queue_->GetConsumer(), easy.weak_from_this());
+    body.stream_ = body_stream_;
+
+    // Drop the data() body if any, cURL prefers it over the read function
+    easy.set_post_fields(static_cast<void*>(nullptr));
+    easy.set_post(true);
+    easy.set_post_field_size_large(content_length ? static_cast<curl::native::curl_off_t>(*content_length) : -1);
+    easy.set_read_function(&impl::RequestBodyStream::ReadFunction);
+    easy.set_read_data(body_stream_.get());
+}
+
+void RequestState::CloseBodyStream() {
+    if (body_stream_) body_stream_->Close();
+}
+
 CancellationPolicy RequestState::GetCancellationPolicy() const { return cancellation_policy_; }
 
 void RequestState::SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config) {
@@ -451,6 +518,10 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
         LOG_DEBUG() << "Stream API, status code is set (with body)";
     }
 
+    // The server may respond or the request may fail before the whole body
+    // is sent, the body producer must not wait for it forever
+    holder->CloseBodyStream();
+
     const auto status_code = static_cast<Status>(easy.get_response_code());
 
     holder->CheckResponseDeadline(err, status_code);
@@ -604,6 +675,10 @@ void RequestState::parse_header(char* ptr, size_t size) try {
     const char* col_pos = static_cast<const char*>(memchr(ptr, ':', size));
     if (col_pos == nullptr) {
         if (IsHttpStatusLineStart(ptr, size)) {
+            if (!http2_stream_active_ && IsHttp2StatusLine(ptr, size)) {
+                http2_stream_active_ = true;
+                WithRequestStats([](RequestStats& stats) { stats.AccountHttp2StreamStarted(); });
+            }
             for (auto& [k, v] : response_->headers()) LOG_INFO() << "drop header " << k << "=" << v;
             // In case of redirect drop 1st response headers
             response_->headers().clear();
@@ -651,6 +726,10 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::imp
 
     StartNewSpan(location);
     ResetDataForNewRequest();
+    if (body_stream_) {
+        // Streamed body could not be sent again
+        retry_.retries = 1;
+    }
 
     auto& span = span_storage_->Get();
     span.AddTag("stream_api", 0);
@@ -779,6 +858,8 @@ void RequestState::UpdateTimeoutHeader() {
 }
 
 void RequestState::HandleDeadlineAlreadyPassed() {
+    CloseBodyStream();
+
     auto& span = span_storage_->Get();
     span.AddTag(tracing::kAttempts, retry_.current - 1);
     span.AddTag(tracing::kErrorFlag, true);
@@ -866,6 +947,23 @@ void RequestState::AccountResponse(std::error_code err) {
         else
             stats.FinishOk(static_cast<int>(easy().get_response_code()), attempts);
     });
+
+    if (http2_stream_active_) {
+        http2_stream_active_ = false;
+        WithRequestStats([](RequestStats& stats) { stats.AccountHttp2StreamFinished(); });
+    }
+    if (err) return;
+
+    if (easy().get_num_connects() == 0) {
+        WithRequestStats([](RequestStats& stats) { stats.AccountConnectionReused(); });
+    }
+    if (easy().get_http_version() == curl::native::CURL_HTTP_VERSION_2_0) {
+        std::chrono::microseconds queue_time{0};
+#if LIBCURL_VERSION_NUM >= 0x080600
+        queue_time = std::chrono::microseconds{easy().get_queue_time_usec()};
+#endif
+        WithRequestStats([queue_time](RequestStats& stats) { stats.AccountHttp2Request(queue_time); });
+    }
 }
 
 std::exception_ptr RequestState::PrepareException(std::error_code err) {
@@ -896,6 +994,7 @@ void RequestState::ResetDataForNewRequest() {
     timeout_updated_by_deadline_ = false;
 
     ApplyTestsuiteConfig();
+    ApplyBodyCompression();
 
     // Testsuite config might have changed the timeout, so add the tag here.
     // Note: HookPerformRequest can potentially change timeout manually
@@ -970,6 +1069,64 @@ void RequestState::ApplyTestsuiteConfig() {
     easy().add_header(kTestsuiteSupportedErrorsKey, GetTestsuiteSupportedErrors());
 }
 
+const BodyCompression* RequestState::FindBodyCompression() const {
+    if (body_compression_) return &*body_compression_;
+    if (!body_compression_rules_) return nullptr;
+
+    const auto& url = easy().get_original_url();
+    for (const auto& rule : *body_compression_rules_) {
+        if (utils::text::StartsWith(url, rule.url_prefix)) return &rule.compression;
+    }
+    return nullptr;
+}
+
+void RequestState::ApplyBodyCompression() {
+    const auto* settings = FindBodyCompression();
+    if (!settings) return;
+
+    // Streamed replies never reach ResponseFuture::Get(), cURL decodes them
+    const bool is_reply_buffered = std::holds_alternative<FullBufferedData>(data_);
+    if (settings->dictionary && is_reply_buffered && !is_reply_decoding_disabled_ && !reply_dictionary_) {
+        // cURL knows nothing about the dictionary, the replies are decoded
+        // in ResponseFuture::Get()
+        easy().set_accept_encoding(nullptr);
+        easy().add_header(
+            USERVER_NAMESPACE::http::headers::kAcceptEncoding,
+            fmt::format("{}, {}", ToString(ContentCoding::kZstd), ToString(ContentCoding::kGzip)),
+            curl::easy::DuplicateHeaderAction::kReplace
+        );
+        reply_dictionary_ = settings->dictionary;
+    }
+
+    const auto& body = easy().get_post_data();
+    if (is_body_compressed_ || body.empty() || body.size() < settings->min_size) return;
+
+    std::string compressed;
+    switch (settings->coding) {
+        case ContentCoding::kGzip:
+            compressed = compression::gzip::Compress(body, settings->level.value_or(compression::gzip::kDefaultLevel));
+            break;
+        case ContentCoding::kZstd:
+            compressed = settings->dictionary
+                             ? compression::zstd::Compress(body, *settings->dictionary)
+                             : compression::zstd::Compress(
+                                   body, settings->level.value_or(compression::zstd::kDefaultLevel)
+                               );
+            break;
+    }
+    is_body_compressed_ = true;
+
+    // Incompressible data, e.g. an image, is sent as is
+    if (compressed.size() >= body.size()) return;
+
+    easy().set_post_fields(std::move(compressed));
+    easy().add_header(
+        USERVER_NAMESPACE::http::headers::kContentEncoding,
+        ToString(settings->coding),
+        curl::easy::DuplicateHeaderAction::kReplace
+    );
+}
+
 void RequestState::StartNewSpan(utils::impl::SourceLocation location) {
     UINVARIANT(!span_storage_, "Attempt to reuse request while the previous one has not finished");
 
@@ -8,6 +8,7 @@
 #include <system_error>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
+#include <userver/clients/http/body_compression.hpp>
 #include <userver/clients/http/config.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
@@ -28,6 +29,7 @@
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/request_body_stream.hpp>
 #include <clients/http/testsuite.hpp>
 #include <crypto/helpers.hpp>
 #include <engine/ev/watcher/timer_watcher.hpp>
@@ -117,8 +119,19 @@ public:
 
     void DisableReplyDecoding();
 
+    void SetBodyCompression(BodyCompression compression);
+    void SetBodyCompressionRules(std::shared_ptr<const std::vector<BodyCompressionRule>> rules);
+    void ResetBodyCompressed() noexcept { is_body_compressed_ = false; }
+
+    /// Decodes the reply, if the decoding was taken over from cURL to use
+    /// a zstd dictionary
+    void DecodeResponseBody(Response& response) const;
+
     void SetCancellationPolicy(CancellationPolicy cp);
 
+    void SetBodyStream(StreamedRequestBody& body, std::optional<std::size_t> content_length);
+    bool HasBodyStream() const noexcept { return body_stream_ != nullptr; }
+
     CancellationPolicy GetCancellationPolicy() const;
 
     void SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config);
@@ -158,6 +171,7 @@ private:
     [[nodiscard]] bool UpdateTimeoutFromDeadlineAndCheck(std::chrono::milliseconds backoff = {});
     void UpdateTimeoutHeader();
     void HandleDeadlineAlreadyPassed();
+    void CloseBodyStream();
     void CheckResponseDeadline(std::error_code& err, Status status_code);
     bool IsDeadlineExpiredResponse(Status status_code);
     bool ShouldRetryResponse();
@@ -172,6 +186,8 @@ private:
 
     void ResetDataForNewRequest();
     void ApplyTestsuiteConfig();
+    void ApplyBodyCompression();
+    const BodyCompression* FindBodyCompression() const;
     void StartNewSpan(utils::impl::SourceLocation location);
     void StartStats();
 
@@ -184,6 +200,7 @@ private:
     impl::EasyWrapper easy_;
     RequestStats stats_;
     std::shared_ptr<RequestStats> dest_req_stats_;
+    std::shared_ptr<impl::RequestBodyStream> body_stream_;
     CancellationPolicy cancellation_policy_{CancellationPolicy::kCancel};
 
     std::shared_ptr<DestinationStatistics> dest_stats_;
@@ -192,6 +209,14 @@ private:
     std::shared_ptr<const TestsuiteConfig> testsuite_config_;
     std::vector<std::string> allowed_urls_extra_;
 
+    std::optional<BodyCompression> body_compression_;
+    std::shared_ptr<const std::vector<BodyCompressionRule>> body_compression_rules_;
+    /// compression of the current body was already done by a previous perform
+    bool is_body_compressed_{false};
+    bool is_reply_decoding_disabled_{false};
+    /// replies are decoded with the dictionary instead of cURL
+    std::shared_ptr<const compression::zstd::Dictionary> reply_dictionary_;
+
     crypto::PrivateKey pkey_;
     crypto::Certificate cert_;
     crypto::Certificate ca_;
@@ -209,6 +234,8 @@ private:
     engine::Deadline deadline_;
     bool timeout_updated_by_deadline_{false};
     bool deadline_expired_{false};
+    /// an HTTP/2 response is being received by the current attempt
+    bool http2_stream_active_{false};
 
     utils::NotNull<const tracing::TracingManagerBase*> tracing_manager_;
     /// struct for reties
@@ -129,7 +129,9 @@ std::shared_ptr<Response> ResponseFuture::Get() {
             server::request::MarkTaskInheritedDeadlineExpired();
         }
         auto response = future_.get();
-        Detach();
+        const utils::FastScopeGuard detach_guard([this]() noexcept { Detach(); });
+        // Decoding happens here rather than in the event loop thread
+        request_state_->DecodeResponseBody(*response);
         return response;
     }
 
@@ -72,6 +72,28 @@ void RequestStats::AccountOpenSockets(size_t sockets) noexcept {
     stats_->socket_open_ += utils::statistics::Rate{sockets};
 }
 
+void RequestStats::AccountConnectionReused() noexcept {
+    UASSERT(stats_);
+    ++stats_->connections_reused_;
+}
+
+void RequestStats::AccountHttp2Request(std::chrono::microseconds queue_time) noexcept {
+    UASSERT(stats_);
+    ++stats_->http2_requests_;
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(queue_time).count();
+    stats_->http2_queue_wait_percentile_.GetCurrentCounter().Account(ms);
+}
+
+void RequestStats::AccountHttp2StreamStarted() noexcept {
+    UASSERT(stats_);
+    ++stats_->http2_active_streams_;
+}
+
+void RequestStats::AccountHttp2StreamFinished() noexcept {
+    UASSERT(stats_);
+    --stats_->http2_active_streams_;
+}
+
 void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
     UASSERT(stats_);
     ++stats_->timeout_updated_by_deadline_;
@@ -168,6 +190,13 @@ void DumpMetric(utils::statistics::Writer& writer, const DestinationStatisticsVi
     writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
 
     writer["sockets"]["open"] = stats.multi.socket_open;
+    writer["connections"]["reused"] = stats.connections_reused;
+
+    if (auto http2 = writer["http2"]) {
+        http2["requests"] = stats.http2_requests;
+        http2["active-streams"] = stats.http2_active_streams;
+        http2["queue-wait"] = stats.http2_queue_wait_percentile;
+    }
 }
 
 void DumpMetric(utils::statistics::Writer& writer, const InstanceStatistics& stats) {
@@ -200,6 +229,10 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
       last_time_to_start_us(other.last_time_to_start_us_.load()),
       timings_percentile(other.timings_percentile_.GetStatsForPeriod()),
       retries(other.retries_.Load()),
+      connections_reused(other.connections_reused_.Load()),
+      http2_requests(other.http2_requests_.Load()),
+      http2_active_streams(other.http2_active_streams_.load()),
+      http2_queue_wait_percentile(other.http2_queue_wait_percentile_.GetStatsForPeriod()),
       timeout_updated_by_deadline(other.timeout_updated_by_deadline_.Load()),
       cancelled_by_deadline(other.cancelled_by_deadline_.Load()),
       reply_status(other.reply_status_) {
@@ -232,6 +265,11 @@ InstanceStatistics& InstanceStatistics::operator+=(const InstanceStatistics& sta
     }
     retries += stat.retries;
 
+    connections_reused += stat.connections_reused;
+    http2_requests += stat.http2_requests;
+    http2_active_streams += stat.http2_active_streams;
+    http2_queue_wait_percentile.Add(stat.http2_queue_wait_percentile);
+
     timeout_updated_by_deadline += stat.timeout_updated_by_deadline;
     cancelled_by_deadline += stat.cancelled_by_deadline;
     reply_status += stat.reply_status;
@@ -38,6 +38,12 @@ public:
 
     void AccountOpenSockets(size_t sockets) noexcept;
 
+    void AccountConnectionReused() noexcept;
+    void AccountHttp2Request(std::chrono::microseconds queue_time) noexcept;
+
+    void AccountHttp2StreamStarted() noexcept;
+    void AccountHttp2StreamFinished() noexcept;
+
     void AccountTimeoutUpdatedByDeadline() noexcept;
     void AccountCancelledByDeadline() noexcept;
 
@@ -103,6 +109,10 @@ private:
     std::array<utils::statistics::RateCounter, kErrorGroupCount> error_count_;
     utils::statistics::RateCounter retries_;
     utils::statistics::RateCounter socket_open_{0};
+    utils::statistics::RateCounter connections_reused_;
+    utils::statistics::RateCounter http2_requests_;
+    std::atomic<std::int64_t> http2_active_streams_{0};
+    utils::statistics::RecentPeriod<Percentile, Percentile, utils::datetime::SteadyClock> http2_queue_wait_percentile_;
     utils::statistics::RateCounter timeout_updated_by_deadline_;
     utils::statistics::RateCounter cancelled_by_deadline_;
     utils::statistics::HttpCodes reply_status_;
@@ -130,6 +140,11 @@ struct InstanceStatistics {
     std::array<utils::statistics::Rate, Statistics::kErrorGroupCount> error_count;
     utils::statistics::Rate retries{0};
 
+    utils::statistics::Rate connections_reused;
+    utils::statistics::Rate http2_requests;
+    std::int64_t http2_active_streams{0};
+    Percentile http2_queue_wait_percentile;
+
     utils::statistics::Rate timeout_updated_by_deadline;
     utils::statistics::Rate cancelled_by_deadline;
     utils::statistics::HttpCodes::Snapshot reply_status;
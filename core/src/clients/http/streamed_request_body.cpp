@@ -0,0 +1,136 @@
+#include <userver/clients/http/streamed_request_body.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+#include <clients/http/request_body_stream.hpp>
+#include <curl-ev/easy.hpp>
+#include <engine/ev/thread_control.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+StreamedRequestBody::StreamedRequestBody(std::size_t max_buffered_bytes)
+    : queue_(Queue::Create(max_buffered_bytes)), producer_(queue_->GetProducer()) {
+    UINVARIANT(max_buffered_bytes > 0, "max_buffered_bytes must be positive");
+}
+
+StreamedRequestBody::StreamedRequestBody(StreamedRequestBody&&) noexcept = default;
+
+StreamedRequestBody& StreamedRequestBody::operator=(StreamedRequestBody&& other) noexcept {
+    if (this != &other) {
+        Finish();
+        queue_ = std::move(other.queue_);
+        producer_ = std::move(other.producer_);
+        stream_ = std::move(other.stream_);
+    }
+    return *this;
+}
+
+StreamedRequestBody::~StreamedRequestBody() { Finish(); }
+
+bool StreamedRequestBody::Push(std::string chunk, engine::Deadline deadline) {
+    UINVARIANT(producer_, "Push() after Finish()");
+    if (chunk.empty()) return true;
+
+    const auto max_chunk_size = queue_->GetSoftMaxSize();
+    if (chunk.size() <= max_chunk_size) return PushChunk(std::move(chunk), deadline);
+
+    // A chunk bigger than the whole buffer would never fit into the queue
+    for (std::string_view rest = chunk; !rest.empty(); rest.remove_prefix(std::min(rest.size(), max_chunk_size))) {
+        if (!PushChunk(std::string{rest.substr(0, max_chunk_size)}, deadline)) return false;
+    }
+    return true;
+}
+
+void StreamedRequestBody::Finish() {
+    if (!producer_) return;
+
+    producer_.reset();
+    NotifyStream();
+}
+
+bool StreamedRequestBody::PushChunk(std::string&& chunk, engine::Deadline deadline) {
+    if (!producer_->Push(std::move(chunk), deadline)) return false;
+    NotifyStream();
+    return true;
+}
+
+void StreamedRequestBody::NotifyStream() noexcept {
+    if (auto stream = stream_.lock()) {
+        stream->Notify();
+    }
+}
+
+namespace impl {
+
+RequestBodyStream::RequestBodyStream(StreamedRequestBody::Queue::Consumer&& consumer, std::weak_ptr<curl::easy> easy)
+    : consumer_(std::move(consumer)), easy_(std::move(easy)) {}
+
+std::size_t RequestBodyStream::ReadFunction(void* ptr, std::size_t size, std::size_t nmemb, void* userdata) {
+    auto& self = *static_cast<RequestBodyStream*>(userdata);
+    return self.Read(static_cast<char*>(ptr), size * nmemb);
+}
+
+void RequestBodyStream::Notify() {
+    if (!paused_.exchange(false)) return;
+
+    auto easy = easy_.lock();
+    if (!easy) return;
+
+    easy->GetThreadControl().RunInEvLoopAsync([easy = easy_] {
+        if (auto locked = easy.lock()) locked->unpause();
+    });
+}
+
+void RequestBodyStream::Close() {
+    // Producer sees no consumers and stops waiting in Push()
+    std::move(consumer_).Reset();
+    finished_ = true;
+    chunk_.clear();
+    chunk_offset_ = 0;
+}
+
+std::size_t RequestBodyStream::Read(char* buffer, std::size_t size) {
+    if (chunk_offset_ == chunk_.size() && !PopChunk()) {
+        if (finished_) return 0;
+
+        // The pause is published before the last check, so a concurrent Push()
+        // is either seen here or resumes the transfer
+        paused_ = true;
+        if (!PopChunk()) {
+            if (!finished_) return CURL_READFUNC_PAUSE;
+            paused_ = false;
+            return 0;
+        }
+        paused_ = false;
+    }
+
+    const auto result = std::min(size, chunk_.size() - chunk_offset_);
+    std::memcpy(buffer, chunk_.data() + chunk_offset_, result);
+    chunk_offset_ += result;
+    return result;
+}
+
+bool RequestBodyStream::PopChunk() {
+    chunk_.clear();
+    chunk_offset_ = 0;
+    if (finished_) return false;
+
+    // Producer pushes everything before it dies, so the queue must be checked
+    // after the producer
+    const bool no_more_producers = consumer_.Queue()->NoMoreProducers();
+    if (consumer_.PopNoblock(chunk_)) return true;
+
+    finished_ = no_more_producers;
+    return false;
+}
+
+}  // namespace impl
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
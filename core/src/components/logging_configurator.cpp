@@ -3,7 +3,9 @@
 #include <logging/dynamic_debug.hpp>
 #include <logging/dynamic_debug_config.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/sampling.hpp>
 #include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/tracing/tracer.hpp>
@@ -29,6 +31,14 @@ const dynamic_config::Key<tracing::NoLogSpans> kNoLogSpans{
 )"}};
 /// [key]
 
+const dynamic_config::Key<tracing::SamplingConfig> kTracingSampling{
+    "USERVER_TRACING_SAMPLING",
+    dynamic_config::DefaultAsJsonString{R"(
+  {
+    "enabled": false
+  }
+)"}};
+
 const dynamic_config::Key<logging::DynamicDebugConfig> kDynamicDebugConfig{
     "USERVER_LOG_DYNAMIC_DEBUG",
     dynamic_config::DefaultAsJsonString{R"(
@@ -47,13 +57,25 @@ LoggingConfigurator::LoggingConfigurator(const ComponentConfig& config, const Co
     config_subscription_ = context.FindComponent<components::DynamicConfig>().GetSource().UpdateAndListen(
         this, kName, &LoggingConfigurator::OnConfigUpdate
     );
+
+    auto* const statistics_storage = context.FindComponentOptional<components::StatisticsStorage>();
+    if (statistics_storage) {
+        statistics_holder_ = statistics_storage->GetStorage().RegisterWriter(
+            "tracing.sampling",
+            [](utils::statistics::Writer& writer) { tracing::impl::WriteSamplingStatistics(writer); }
+        );
+    }
 }
 
-LoggingConfigurator::~LoggingConfigurator() { config_subscription_.Unsubscribe(); }
+LoggingConfigurator::~LoggingConfigurator() {
+    statistics_holder_.Unregister();
+    config_subscription_.Unsubscribe();
+}
 
 void LoggingConfigurator::OnConfigUpdate(const dynamic_config::Snapshot& config) {
     (void)this;  // silence clang-tidy
     tracing::Tracer::SetNoLogSpans(tracing::NoLogSpans{config[kNoLogSpans]});
+    tracing::Tracer::SetSamplingConfig(tracing::SamplingConfig{config[kTracingSampling]});
 
     try {
         const auto& dd = config[kDynamicDebugConfig];
@@ -121,6 +121,21 @@ properties:
                 description: >
                     number of threads to process low level IO system calls
                     (number of ev loops to start in libev)
+            backend:
+                type: string
+                description: |
+                    kernel notification mechanism for the ev loops.
+                    `auto` lets libev pick the best recommended one (epoll).
+                    `io_uring` batches fd registrations and polls through
+                    a submission ring and saves syscalls on wakeups, requires
+                    libev and kernel support. If the backend is unavailable
+                    the default one is used.
+                defaultDescription: auto
+                enum:
+                  - auto
+                  - epoll
+                  - io_uring
+                  - linuxaio
     components:
         type: object
         description: 'dictionary of "component name": "options"'
@@ -173,6 +188,16 @@ properties:
                     enum:
                       - global-task-queue
                       - work-stealing-task-queue
+                worker-cpus:
+                    type: string
+                    description: |
+                        CPUs to pin the worker threads to in the cpuset list
+                        format, e.g. `0-7,16-23`. Worker `i` is pinned to the
+                        `i % count`-th CPU of the list. With the
+                        `work-stealing-task-queue` the workers on the same NUMA
+                        node share a global queue and prefer stealing tasks
+                        from each other.
+                    defaultDescription: workers are not pinned
                 task-trace:
                     type: object
                     description: .
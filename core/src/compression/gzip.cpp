@@ -1,44 +1,274 @@
 #include <compression/gzip.hpp>
 
-#include <boost/iostreams/filter/gzip.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
+#include <algorithm>
+#include <limits>
+
+#include <zlib.h>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::gzip {
 
 namespace {
-constexpr auto kDecompressBufferSize = 1024;
+constexpr std::size_t kDecompressBufferSize = 16 * 1024;
+constexpr std::size_t kMinCompressBufferSize = 64;
+
+// 15 is the biggest window, +16 asks zlib to write (expect) a gzip header
+// and trailer
+constexpr int kGzipWindowBits = 15 + 16;
+constexpr int kDefaultMemLevel = 8;
+
+using DeflateStream = std::unique_ptr<z_stream, impl::DeflateDeleter>;
+using InflateStream = std::unique_ptr<z_stream, impl::InflateDeleter>;
+
+// z_stream keeps pointers to itself inside the internal state, so it is
+// always allocated on heap and never moved.
+DeflateStream MakeDeflateStream(int level) {
+    auto stream = std::make_unique<z_stream>();
+    const auto ret =
+        deflateInit2(stream.get(), level, Z_DEFLATED, kGzipWindowBits, kDefaultMemLevel, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK) {
+        throw CompressionError(fmt::format("Failed to initialize gzip compression, error code {}", ret));
+    }
+    return DeflateStream{stream.release()};
 }
 
-std::string Decompress(std::string_view compressed, size_t max_size) {
-    std::string decompressed;
+InflateStream MakeInflateStream() {
+    auto stream = std::make_unique<z_stream>();
+    const auto ret = inflateInit2(stream.get(), kGzipWindowBits);
+    if (ret != Z_OK) {
+        throw DecompressionError(fmt::format("Failed to initialize gzip decompression, error code {}", ret));
+    }
+    return InflateStream{stream.release()};
+}
 
-    // A guess for "small" data chunk
-    // "-1" is required to avoid memory fragmentation
-    // (stdlibc++ allocates capacity+1 bytes).
-    decompressed.reserve(kDecompressBufferSize - 1);
+// Streams keep their state between the calls, reusing them saves a few
+// allocations (and page faults) on every call.
+struct LocalStreams final {
+    DeflateStream deflate;
+    int deflate_level{0};
+    InflateStream inflate;
+};
 
-    namespace bio = boost::iostreams;
+compiler::ThreadLocal local_streams = [] { return LocalStreams{}; };
 
-    bio::filtering_istream stream;
-    stream.push(bio::gzip_decompressor());
-    stream.push(bio::array_source(compressed.data(), compressed.size()));
+z_stream& GetDeflateStream(LocalStreams& streams, int level) {
+    if (!streams.deflate) {
+        streams.deflate = MakeDeflateStream(level);
+        streams.deflate_level = level;
+        return *streams.deflate;
+    }
+
+    deflateReset(streams.deflate.get());
+    if (level != streams.deflate_level) {
+        const auto ret = deflateParams(streams.deflate.get(), level, Z_DEFAULT_STRATEGY);
+        if (ret != Z_OK) {
+            throw CompressionError(fmt::format("Failed to set gzip compression level {}, error code {}", level, ret));
+        }
+        streams.deflate_level = level;
+    }
+    return *streams.deflate;
+}
 
-    while (stream) {
-        char buf[kDecompressBufferSize];
-        stream.read(buf, sizeof(buf));
+z_stream& GetInflateStream(LocalStreams& streams) {
+    if (!streams.inflate) {
+        streams.inflate = MakeInflateStream();
+    } else {
+        inflateReset(streams.inflate.get());
+    }
+    return *streams.inflate;
+}
+
+// zlib counts bytes in uInt, bigger buffers are processed in several steps
+uInt ClampSize(std::size_t size) { return std::min<std::size_t>(size, std::numeric_limits<uInt>::max()); }
+
+int ToZlibFlush(FlushMode mode) {
+    switch (mode) {
+        case FlushMode::kNone:
+            return Z_NO_FLUSH;
+        case FlushMode::kFlush:
+            return Z_SYNC_FLUSH;
+        case FlushMode::kFinish:
+            return Z_FINISH;
+    }
 
-        if (decompressed.size() + stream.gcount() > max_size) {
+    UINVARIANT(false, "Unexpected flush mode");
+}
+
+void SetBuffers(z_stream& stream, std::string_view input, utils::span<char> output) {
+    // zlib API is not const-correct
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = ClampSize(input.size());
+    stream.next_out = reinterpret_cast<Bytef*>(output.data());
+    stream.avail_out = ClampSize(output.size());
+}
+
+StreamResult DoDeflate(z_stream& stream, std::string_view input, utils::span<char> output, FlushMode mode) {
+    SetBuffers(stream, input, output);
+    const auto avail_in = stream.avail_in;
+    const auto avail_out = stream.avail_out;
+
+    // Z_BUF_ERROR means that no progress was possible, e.g. there is nothing
+    // left to flush
+    const auto ret = deflate(&stream, ToZlibFlush(mode));
+    if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+        throw CompressionError(fmt::format("Failed to gzip data, error code {}", ret));
+    }
+
+    StreamResult result;
+    result.consumed = avail_in - stream.avail_in;
+    result.produced = avail_out - stream.avail_out;
+    switch (mode) {
+        case FlushMode::kNone:
+            result.done = result.consumed == input.size();
+            break;
+        case FlushMode::kFlush:
+            // The flush is complete if there is some output space left
+            result.done = result.consumed == input.size() && stream.avail_out != 0;
+            break;
+        case FlushMode::kFinish:
+            result.done = ret == Z_STREAM_END;
+            break;
+    }
+    return result;
+}
+
+StreamResult DoInflate(z_stream& stream, std::string_view input, utils::span<char> output) {
+    SetBuffers(stream, input, output);
+    const auto avail_in = stream.avail_in;
+    const auto avail_out = stream.avail_out;
+
+    const auto ret = inflate(&stream, Z_NO_FLUSH);
+    if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR) {
+        throw ErrWithCode(stream.msg ? stream.msg : "failed to decompress gzip'ed data");
+    }
+
+    return {avail_in - stream.avail_in, avail_out - stream.avail_out, ret == Z_STREAM_END};
+}
+
+std::string CompressToString(Compressor& compressor, std::string_view input, FlushMode mode) {
+    std::string output;
+    while (true) {
+        const auto offset = output.size();
+        output.resize(offset + std::max(input.size(), kMinCompressBufferSize));
+
+        const auto result = compressor.Compress(input, utils::span<char>(output).subspan(offset), mode);
+        input.remove_prefix(result.consumed);
+        output.resize(offset + result.produced);
+
+        if (result.done) return output;
+    }
+}
+
+}  // namespace
+
+namespace impl {
+
+void DeflateDeleter::operator()(z_stream* stream) const noexcept {
+    deflateEnd(stream);
+    delete stream;
+}
+
+void InflateDeleter::operator()(z_stream* stream) const noexcept {
+    inflateEnd(stream);
+    delete stream;
+}
+
+}  // namespace impl
+
+std::string Decompress(std::string_view compressed, size_t max_size) {
+    auto streams = local_streams.Use();
+    auto& stream = GetInflateStream(*streams);
+
+    std::string decompressed;
+    while (true) {
+        const auto offset = decompressed.size();
+        decompressed.resize(offset + kDecompressBufferSize);
+
+        const auto result = DoInflate(stream, compressed, utils::span<char>(decompressed).subspan(offset));
+        compressed.remove_prefix(result.consumed);
+        decompressed.resize(offset + result.produced);
+
+        if (decompressed.size() > max_size) {
             throw TooBigError();
         }
 
-        decompressed.insert(decompressed.end(), buf, buf + stream.gcount());
+        if (result.done) {
+            if (compressed.empty()) return decompressed;
+
+            // The data may consist of several concatenated gzip members
+            inflateReset(&stream);
+        } else if (result.produced < kDecompressBufferSize && compressed.empty()) {
+            throw DecompressionError("failed to decompress gzip'ed data: unexpected end of data");
+        }
+    }
+}
+
+std::string Compress(std::string_view data, int level) {
+    auto streams = local_streams.Use();
+    auto& stream = GetDeflateStream(*streams, level);
+
+    // deflateBound() guarantees that a single Z_FINISH step is enough
+    std::string compressed(deflateBound(&stream, data.size()), '\0');
+    std::size_t produced = 0;
+    while (true) {
+        const auto result =
+            DoDeflate(stream, data, utils::span<char>(compressed).subspan(produced), FlushMode::kFinish);
+        data.remove_prefix(result.consumed);
+        produced += result.produced;
+
+        if (result.done) break;
+
+        // Only for the data that does not fit into uInt
+        compressed.resize(compressed.size() * 2);
     }
 
-    if (stream.bad()) throw DecompressionError("failed to decompress gzip'ed data");
+    compressed.resize(produced);
+    return compressed;
+}
+
+Compressor::Compressor(int level) : stream_(MakeDeflateStream(level)) {}
+
+Compressor::Compressor(Compressor&&) noexcept = default;
+
+Compressor& Compressor::operator=(Compressor&&) noexcept = default;
+
+Compressor::~Compressor() = default;
+
+StreamResult Compressor::Compress(std::string_view input, utils::span<char> output, FlushMode mode) {
+    UASSERT(stream_);
+    return DoDeflate(*stream_, input, output, mode);
+}
+
+std::string Compressor::Compress(std::string_view chunk) { return CompressToString(*this, chunk, FlushMode::kFlush); }
+
+std::string Compressor::Finish() { return CompressToString(*this, {}, FlushMode::kFinish); }
+
+void Compressor::Reset() noexcept {
+    UASSERT(stream_);
+    deflateReset(stream_.get());
+}
+
+Decompressor::Decompressor() : stream_(MakeInflateStream()) {}
+
+Decompressor::Decompressor(Decompressor&&) noexcept = default;
+
+Decompressor& Decompressor::operator=(Decompressor&&) noexcept = default;
+
+Decompressor::~Decompressor() = default;
+
+StreamResult Decompressor::Decompress(std::string_view input, utils::span<char> output) {
+    UASSERT(stream_);
+    return DoInflate(*stream_, input, output);
+}
 
-    return decompressed;
+void Decompressor::Reset() noexcept {
+    UASSERT(stream_);
+    inflateReset(stream_.get());
 }
 
 }  // namespace compression::gzip
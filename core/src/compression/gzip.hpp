@@ -1,8 +1,14 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
+#include <userver/compression/stream.hpp>
+#include <userver/utils/span.hpp>
+
+struct z_stream_s;
 
 USERVER_NAMESPACE_BEGIN
 
@@ -12,6 +18,93 @@ namespace compression::gzip {
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Default compression level of zlib
+inline constexpr int kDefaultLevel = 6;
+
+/// Compresses the string into a gzip stream.
+///
+/// Deflate state is cached per thread, so calling this function does
+/// not allocate anything except the resulting string.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level = kDefaultLevel);
+
+/// @cond
+namespace impl {
+
+struct DeflateDeleter final {
+    void operator()(z_stream_s* stream) const noexcept;
+};
+
+struct InflateDeleter final {
+    void operator()(z_stream_s* stream) const noexcept;
+};
+
+}  // namespace impl
+/// @endcond
+
+/// @brief Incrementally compresses the data into a gzip stream.
+///
+/// The compressor may be reused for any number of streams, which saves
+/// allocation of the deflate state.
+class Compressor final {
+public:
+    /// @throws CompressionError
+    explicit Compressor(int level = kDefaultLevel);
+
+    Compressor(Compressor&&) noexcept;
+    Compressor& operator=(Compressor&&) noexcept;
+    ~Compressor();
+
+    /// @brief Compresses the beginning of `input` into `output`.
+    ///
+    /// Should be called with the rest of the input and with the same `mode`
+    /// until StreamResult::done is returned. After the stream is finished with
+    /// FlushMode::kFinish, the compressor should be Reset() before reuse.
+    /// @throws CompressionError
+    StreamResult Compress(std::string_view input, utils::span<char> output, FlushMode mode);
+
+    /// @returns compressed and flushed representation of `chunk`
+    /// @throws CompressionError
+    std::string Compress(std::string_view chunk);
+
+    /// @returns the end of the gzip stream
+    /// @throws CompressionError
+    std::string Finish();
+
+    /// Discards the unfinished stream, if any
+    void Reset() noexcept;
+
+private:
+    std::unique_ptr<z_stream_s, impl::DeflateDeleter> stream_;
+};
+
+/// @brief Incrementally decompresses a gzip stream.
+///
+/// The decompressor may be reused for any number of streams, which saves
+/// allocation of the inflate state.
+class Decompressor final {
+public:
+    /// @throws DecompressionError
+    Decompressor();
+
+    Decompressor(Decompressor&&) noexcept;
+    Decompressor& operator=(Decompressor&&) noexcept;
+    ~Decompressor();
+
+    /// @brief Decompresses the beginning of `input` into `output`.
+    ///
+    /// Reports StreamResult::done at the end of the gzip member, after that
+    /// the decompressor should be Reset() before reuse.
+    /// @throws DecompressionError
+    StreamResult Decompress(std::string_view input, utils::span<char> output);
+
+    /// Discards the unfinished stream, if any
+    void Reset() noexcept;
+
+private:
+    std::unique_ptr<z_stream_s, impl::InflateDeleter> stream_;
+};
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
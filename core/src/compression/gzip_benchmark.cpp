@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 
+#include <array>
 #include <chrono>
 #include <random>
 
@@ -51,4 +52,30 @@ static void GzipDecompress(benchmark::State& state) {
 }
 BENCHMARK(GzipDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
 
+static void GzipCompress(benchmark::State& state) {
+    const auto data = GenerateRandomData(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(compression::gzip::Compress(data));
+    }
+}
+BENCHMARK(GzipCompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
+
+static void GzipStreamDecompress(benchmark::State& state) {
+    const auto compressed = compression::gzip::Compress(GenerateRandomData(state.range(0)));
+    compression::gzip::Decompressor decompressor;
+    std::array<char, 4096> buffer{};
+
+    for ([[maybe_unused]] auto _ : state) {
+        decompressor.Reset();
+        std::string_view input = compressed;
+        while (true) {
+            const auto result = decompressor.Decompress(input, buffer);
+            input.remove_prefix(result.consumed);
+            if (result.done) break;
+        }
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+BENCHMARK(GzipStreamDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
+
 USERVER_NAMESPACE_END
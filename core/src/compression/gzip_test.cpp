@@ -28,4 +28,90 @@ TEST(Gzip, TestOverflow) {
     EXPECT_THROW(compression::gzip::Decompress(compressed, big_msg.size() / 2), compression::TooBigError);
 }
 
+TEST(Gzip, CompressRoundtrip) {
+    const std::string str = std::string(10'000, 'a') + "abcdefgh" + std::string(10'000, 'b');
+
+    for (const int level : {1, compression::gzip::kDefaultLevel, 9}) {
+        const auto compressed = compression::gzip::Compress(str, level);
+        EXPECT_LT(compressed.size(), str.size());
+        EXPECT_EQ(compression::gzip::Decompress(compressed, str.size()), str);
+    }
+}
+
+TEST(Gzip, CompressEmpty) {
+    const auto compressed = compression::gzip::Compress({});
+    EXPECT_FALSE(compressed.empty());
+    EXPECT_EQ(compression::gzip::Decompress(compressed, 0), "");
+}
+
+TEST(Gzip, CompressorRoundtrip) {
+    compression::gzip::Compressor compressor{1};
+
+    std::string expected;
+    std::string compressed;
+    for (int i = 0; i < 10; ++i) {
+        const auto chunk = std::to_string(i) + std::string(1000, 'a' + i);
+        compressed += compressor.Compress(chunk);
+        expected += chunk;
+    }
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::gzip::Decompress(compressed, expected.size()), expected);
+}
+
+TEST(Gzip, DecompressConcatenated) {
+    const std::string first(1000, 'a');
+    const std::string second(1000, 'b');
+    const auto compressed = compression::gzip::Compress(first) + compression::gzip::Compress(second);
+
+    EXPECT_EQ(compression::gzip::Decompress(compressed, first.size() + second.size()), first + second);
+}
+
+TEST(Gzip, DecompressTruncated) {
+    const auto compressed = compression::gzip::Compress(std::string(1000, 'a'));
+
+    EXPECT_THROW(
+        compression::gzip::Decompress(compressed.substr(0, compressed.size() - 1), 1000),
+        compression::DecompressionError
+    );
+    EXPECT_THROW(compression::gzip::Decompress("not a gzip stream", 1000), compression::DecompressionError);
+}
+
+TEST(Gzip, StreamRoundtrip) {
+    constexpr std::size_t kSmallBufferSize = 7;
+    const std::string str = std::string(10'000, 'a') + "abcdefgh" + std::string(10'000, 'b');
+
+    compression::gzip::Compressor compressor;
+    compression::gzip::Decompressor decompressor;
+    for (int i = 0; i < 3; ++i) {
+        char buffer[kSmallBufferSize];
+
+        std::string compressed;
+        std::string_view input = str;
+        while (true) {
+            const auto result = compressor.Compress(input, buffer, compression::FlushMode::kFinish);
+            input.remove_prefix(result.consumed);
+            compressed.append(buffer, result.produced);
+            if (result.done) break;
+        }
+        EXPECT_LT(compressed.size(), str.size());
+
+        std::string decompressed;
+        std::string_view compressed_input = compressed;
+        while (true) {
+            const auto result = decompressor.Decompress(compressed_input, buffer);
+            compressed_input.remove_prefix(result.consumed);
+            decompressed.append(buffer, result.produced);
+            if (result.done) break;
+            ASSERT_TRUE(result.consumed != 0 || result.produced != 0) << "No progress";
+        }
+        EXPECT_TRUE(compressed_input.empty());
+        EXPECT_EQ(decompressed, str);
+
+        // Streams are reused for the next iteration
+        compressor.Reset();
+        decompressor.Reset();
+    }
+}
+
 USERVER_NAMESPACE_END
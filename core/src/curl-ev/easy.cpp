@@ -201,6 +201,16 @@ void easy::do_ev_async_perform(handler_type handler, size_t request_num) {
 
 void easy::cancel() { cancel(request_counter_); }
 
+void easy::unpause() {
+    UASSERT(multi_);
+    if (!multi_registered_) return;
+
+    const std::error_code ec{static_cast<errc::EasyErrorCode>(native::curl_easy_pause(handle_, CURLPAUSE_CONT))};
+    if (ec) {
+        LOG_WARNING() << "Failed to unpause transfer: " << ec.message();
+    }
+}
+
 void easy::cancel(size_t request_num) {
     if (multi_) {
         multi_->GetThreadControl().RunInEvLoopSync([this, request_num] { do_ev_cancel(request_num); });
@@ -223,6 +223,8 @@ public:
     void perform(std::error_code& ec);
     void async_perform(handler_type handler);
     void cancel();
+    /// Resumes a transfer paused by a callback, must be called from the event loop
+    void unpause();
     void reset();
     void set_source(std::shared_ptr<std::istream> source);
     void set_source(std::shared_ptr<std::istream> source, std::error_code& ec);
@@ -665,6 +667,9 @@ public:
     IMPLEMENT_CURL_OPTION_GET_CURL_OFF_T(get_starttransfer_time_usec, native::CURLINFO_STARTTRANSFER_TIME_T);
     IMPLEMENT_CURL_OPTION_GET_CURL_OFF_T(get_redirect_time_usec, native::CURLINFO_REDIRECT_TIME_T);
     IMPLEMENT_CURL_OPTION_GET_CURL_OFF_T(get_appconnect_time_usec, native::CURLINFO_APPCONNECT_TIME_T);
+#if LIBCURL_VERSION_NUM >= 0x080600
+    IMPLEMENT_CURL_OPTION_GET_CURL_OFF_T(get_queue_time_usec, native::CURLINFO_QUEUE_TIME_T);
+#endif
     IMPLEMENT_CURL_OPTION_GET_CURL_OFF_T(get_retry_after_sec, native::CURLINFO_RETRY_AFTER);
 
     bool has_post_data() const;
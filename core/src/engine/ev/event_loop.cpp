@@ -17,6 +17,15 @@
 
 #include "child_process_map.hpp"
 
+// EVBACKEND_* are enumerators, not macros, so the availability is checked by the
+// version of libev
+#if EV_VERSION_MAJOR > 4 || (EV_VERSION_MAJOR == 4 && EV_VERSION_MINOR >= 27)
+#define USERVER_IMPL_EV_HAS_LINUXAIO 1
+#endif
+#if EV_VERSION_MAJOR > 4 || (EV_VERSION_MAJOR == 4 && EV_VERSION_MINOR >= 31)
+#define USERVER_IMPL_EV_HAS_IOURING 1
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
@@ -40,9 +49,71 @@ void ReleaseEvDefaultLoop() {
     GetEvDefaultLoopFlag().clear();
 }
 
+unsigned GetRequestedBackendFlag(EvBackend backend) noexcept {
+    switch (backend) {
+        case EvBackend::kAuto:
+            return 0;
+        case EvBackend::kEpoll:
+            return EVBACKEND_EPOLL;
+        case EvBackend::kIoUring:
+#ifdef USERVER_IMPL_EV_HAS_IOURING
+            return EVBACKEND_IOURING;
+#else
+            return 0;
+#endif
+        case EvBackend::kLinuxAio:
+#ifdef USERVER_IMPL_EV_HAS_LINUXAIO
+            return EVBACKEND_LINUXAIO;
+#else
+            return 0;
+#endif
+    }
+
+    UASSERT_MSG(false, "Unexpected EvBackend");
+    return 0;
+}
+
+// The requested backend may be compiled out of libev (e.g. io_uring appeared in
+// libev 4.31), so we check the support beforehand to be able to report it.
+unsigned GetEvLoopFlags(EvBackend backend) {
+    if (backend == EvBackend::kAuto) return EVFLAG_AUTO;
+
+    const auto flag = GetRequestedBackendFlag(backend);
+    if (flag == 0 || !(ev_supported_backends() & flag)) {
+        LOG_WARNING() << "Requested ev backend '" << ToString(backend)
+                      << "' is not supported by libev or by the kernel, falling back to the default one";
+        return EVFLAG_AUTO;
+    }
+
+    // io_uring and linuxaio are not 'recommended' by libev and are not picked up
+    // by EVFLAG_AUTO, so they have to be requested explicitly.
+    return flag;
+}
+
+const char* GetBackendName(unsigned backend) noexcept {
+    switch (backend) {
+        case EVBACKEND_SELECT:
+            return "select";
+        case EVBACKEND_POLL:
+            return "poll";
+        case EVBACKEND_EPOLL:
+            return "epoll";
+#ifdef USERVER_IMPL_EV_HAS_LINUXAIO
+        case EVBACKEND_LINUXAIO:
+            return "linuxaio";
+#endif
+#ifdef USERVER_IMPL_EV_HAS_IOURING
+        case EVBACKEND_IOURING:
+            return "io_uring";
+#endif
+        default:
+            return "unknown";
+    }
+}
+
 }  // namespace
 
-EventLoop::EventLoop(EvLoopType ev_loop_mode) : ev_loop_mode_(ev_loop_mode) {
+EventLoop::EventLoop(EvLoopType ev_loop_mode, EvBackend backend) : ev_loop_mode_(ev_loop_mode), backend_(backend) {
     if (ev_loop_mode_ == EvLoopType::kDefaultLoop) AcquireEvDefaultLoop();
     Start();
 }
@@ -78,9 +149,15 @@ bool EventLoop::DebugIsSameOsThread() noexcept {
 }
 
 void EventLoop::Start() {
-    loop_ = ((ev_loop_mode_ == EvLoopType::kDefaultLoop) ? ev_default_loop(EVFLAG_AUTO) : ev_loop_new(EVFLAG_AUTO));
+    const auto flags = GetEvLoopFlags(backend_);
+    loop_ = ((ev_loop_mode_ == EvLoopType::kDefaultLoop) ? ev_default_loop(flags) : ev_loop_new(flags));
+    if (!loop_ && flags != EVFLAG_AUTO) {
+        LOG_WARNING() << "Failed to initialize ev loop with the requested backend, falling back to the default one";
+        loop_ = ((ev_loop_mode_ == EvLoopType::kDefaultLoop) ? ev_default_loop(EVFLAG_AUTO) : ev_loop_new(EVFLAG_AUTO));
+    }
 
     UASSERT(loop_);
+    LOG_DEBUG() << "Using '" << GetBackendName(ev_backend(loop_)) << "' ev backend";
 #ifdef EV_HAS_IO_PESSIMISTIC_REMOVE
     ev_set_io_pessimistic_remove(loop_);
 #endif
@@ -5,6 +5,7 @@
 #include <ev.h>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/thread_pool_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -17,7 +18,7 @@ public:
         kDefaultLoop,
     };
 
-    explicit EventLoop(EvLoopType ev_loop_mode);
+    explicit EventLoop(EvLoopType ev_loop_mode, EvBackend backend = EvBackend::kAuto);
 
     ~EventLoop();
 
@@ -43,6 +44,7 @@ private:
     ev_child watch_child_{};
 
     const EvLoopType ev_loop_mode_;
+    const EvBackend backend_;
 
 #ifndef NDEBUG
     std::thread::id os_thread_id_{};
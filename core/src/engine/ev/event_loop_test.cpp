@@ -0,0 +1,48 @@
+#include <engine/ev/event_loop.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::ev::EvBackend;
+using engine::ev::EventLoop;
+
+// Whether both libev and the kernel can run a loop with the backend
+bool IsBackendAvailable(unsigned backend) {
+    if (!(ev_supported_backends() & backend)) return false;
+
+    auto* loop = ev_loop_new(backend);
+    if (!loop) return false;
+    ev_loop_destroy(loop);
+    return true;
+}
+
+void ExpectBackend(EvBackend requested, unsigned expected) {
+    if (!IsBackendAvailable(expected)) {
+        GTEST_SKIP() << "The backend is not supported by libev or by the kernel";
+    }
+
+    const EventLoop event_loop{EventLoop::EvLoopType::kNewLoop, requested};
+    EXPECT_EQ(ev_backend(event_loop.GetEvLoop()), expected);
+}
+
+}  // namespace
+
+TEST(EventLoop, BackendEpoll) { ExpectBackend(EvBackend::kEpoll, EVBACKEND_EPOLL); }
+
+#if EV_VERSION_MAJOR > 4 || (EV_VERSION_MAJOR == 4 && EV_VERSION_MINOR >= 31)
+TEST(EventLoop, BackendIoUring) { ExpectBackend(EvBackend::kIoUring, EVBACKEND_IOURING); }
+#endif
+
+#if EV_VERSION_MAJOR > 4 || (EV_VERSION_MAJOR == 4 && EV_VERSION_MINOR >= 27)
+TEST(EventLoop, BackendLinuxAio) { ExpectBackend(EvBackend::kLinuxAio, EVBACKEND_LINUXAIO); }
+#endif
+
+TEST(EventLoop, BackendFallback) {
+    const EventLoop event_loop{EventLoop::EvLoopType::kNewLoop, EvBackend::kAuto};
+    EXPECT_NE(ev_backend(event_loop.GetEvLoop()), 0u);
+}
+
+USERVER_NAMESPACE_END
@@ -27,8 +27,8 @@ public:
     struct UseDefaultEvLoop {};
     static constexpr UseDefaultEvLoop kUseDefaultEvLoop{};
 
-    explicit Thread(const std::string& thread_name);
-    Thread(const std::string& thread_name, UseDefaultEvLoop);
+    explicit Thread(const std::string& thread_name, EvBackend backend = EvBackend::kAuto);
+    Thread(const std::string& thread_name, UseDefaultEvLoop, EvBackend backend = EvBackend::kAuto);
 
     ~Thread();
 
@@ -49,7 +49,7 @@ public:
     const std::string& GetName() const;
 
 private:
-    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type);
+    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, EvBackend backend);
 
     void RegisterInEvLoop(AsyncPayloadBase& payload);
 
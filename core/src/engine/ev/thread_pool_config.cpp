@@ -1,13 +1,39 @@
 #include "thread_pool_config.hpp"
 
+#include <userver/utils/assert.hpp>
+#include <userver/utils/trivial_map.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+namespace {
+
+constexpr utils::TrivialBiMap kEvBackendMap([](auto selector) {
+    return selector()
+        .Case(EvBackend::kAuto, "auto")
+        .Case(EvBackend::kEpoll, "epoll")
+        .Case(EvBackend::kIoUring, "io_uring")
+        .Case(EvBackend::kLinuxAio, "linuxaio");
+});
+
+}  // namespace
+
+EvBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<EvBackend>) {
+    return utils::ParseFromValueString(value, kEvBackendMap);
+}
+
+std::string_view ToString(EvBackend backend) {
+    const auto result = kEvBackendMap.TryFind(backend);
+    UINVARIANT(result, "Unexpected EvBackend value");
+    return *result;
+}
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>) {
     ThreadPoolConfig config;
     config.threads = value["threads"].As<std::size_t>(config.threads);
     config.thread_name = value["thread_name"].As<std::string>(config.thread_name);
+    config.backend = value["backend"].As<EvBackend>(config.backend);
     return config;
 }
 
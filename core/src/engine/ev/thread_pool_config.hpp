@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include <userver/formats/yaml.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
@@ -9,12 +10,26 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::ev {
 
+/// Kernel notification mechanism used by the ev loops of the pool
+enum class EvBackend {
+    kAuto,      ///< let libev pick the best available backend (usually epoll)
+    kEpoll,     ///< epoll(7)
+    kIoUring,   ///< io_uring(7), batches fd (re)registrations and polls into
+                ///< a shared submission ring, saving syscalls per wakeup
+    kLinuxAio,  ///< Linux AIO poll requests (IOCB_CMD_POLL)
+};
+
 struct ThreadPoolConfig {
     std::size_t threads = 2;
     std::string thread_name = "event-worker";
+    EvBackend backend = EvBackend::kAuto;
     bool ev_default_loop_disabled = false;
 };
 
+EvBackend Parse(const yaml_config::YamlConfig& value, formats::parse::To<EvBackend>);
+
+std::string_view ToString(EvBackend backend);
+
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>);
 
 }  // namespace engine::ev
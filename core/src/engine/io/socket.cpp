@@ -5,11 +5,22 @@
 #include <sys/uio.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#include <sys/sendfile.h>
+#endif
+
+#include <algorithm>
+#include <array>
 #include <cerrno>
+#include <chrono>
+#include <cstring>
 #include <string>
 #include <vector>
 
 #include <userver/engine/io/exception.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
@@ -25,6 +36,21 @@ namespace {
 
 constexpr size_t kMaxStackSizeVector = 32;
 
+#ifndef __linux__
+constexpr size_t kSendFileFallbackBufferSize = 32 * 1024;
+#endif
+
+#if defined(__linux__) && defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_SOCKET_ZEROCOPY
+#endif
+
+#ifdef USERVER_IMPL_SOCKET_ZEROCOPY
+// Zero-copy completions usually arrive within an RTT after the data is sent
+constexpr std::chrono::microseconds kZeroCopyMinPollInterval{50};
+constexpr std::chrono::microseconds kZeroCopyMaxPollInterval{5000};
+#endif
+
 // MAC_COMPAT: does not accept flags in type
 impl::FdControlHolder MakeSocket(AddrDomain domain, SocketType type) {
     return impl::FdControl::Adopt(utils::CheckSyscallCustomException<IoSystemError>(
@@ -117,6 +143,85 @@ private:
     const Sockaddr& dest_addr_;
 };
 
+#ifdef __linux__
+class SendFileWrapper {
+public:
+    SendFileWrapper(int in_fd, std::size_t offset) : in_fd_(in_fd), offset_(static_cast<off_t>(offset)) {}
+
+    [[nodiscard]] ssize_t operator()(int fd, size_t len) {
+        // sendfile(2) advances offset_ by the amount of bytes sent
+        return ::sendfile(fd, in_fd_, &offset_, len);
+    }
+
+private:
+    const int in_fd_;
+    off_t offset_;
+};
+#endif
+
+#ifdef USERVER_IMPL_SOCKET_ZEROCOPY
+class ZeroCopySendWrapper {
+public:
+    explicit ZeroCopySendWrapper(std::uint32_t& sends) : sends_(sends) {}
+
+    [[nodiscard]] ssize_t operator()(int fd, struct iovec* list, std::size_t list_size) {
+        struct msghdr msg {};
+        msg.msg_iov = list;
+        msg.msg_iovlen = list_size;
+
+        auto ret = ::sendmsg(fd, &msg, MSG_ZEROCOPY | MSG_NOSIGNAL);
+        if (ret == -1 && errno == ENOBUFS) {
+            // optmem limit for pinned pages is exceeded, copy this chunk
+            return ::sendmsg(fd, &msg, MSG_NOSIGNAL);
+        }
+        if (ret > 0) {
+            // Each successful MSG_ZEROCOPY call gets its own completion id
+            ++sends_;
+        }
+        return ret;
+    }
+
+private:
+    std::uint32_t& sends_;
+};
+
+struct ZeroCopyCompletions {
+    std::uint32_t count{0};
+    bool copied{false};
+};
+
+// Reads all the pending notifications from the socket error queue
+ZeroCopyCompletions ReapZeroCopyCompletions(int fd) {
+    ZeroCopyCompletions result;
+    while (true) {
+        alignas(struct cmsghdr) std::array<char, CMSG_SPACE(sizeof(struct sock_extended_err)) * 4> control{};
+        struct msghdr msg {};
+        msg.msg_control = control.data();
+        msg.msg_controllen = control.size();
+
+        if (::recvmsg(fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) == -1) {
+            if (errno == EINTR) continue;
+            break;  // EAGAIN, nothing more for now
+        }
+
+        for (auto* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            const bool is_recverr = (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+                                    (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR);
+            if (!is_recverr) continue;
+
+            struct sock_extended_err err {};
+            std::memcpy(&err, CMSG_DATA(cmsg), sizeof(err));
+            if (err.ee_errno != 0 || err.ee_origin != SO_EE_ORIGIN_ZEROCOPY) continue;
+
+            // [ee_info, ee_data] is an inclusive range of completed send ids
+            result.count += err.ee_data - err.ee_info + 1;
+            result.copied |= (err.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+        }
+    }
+    return result;
+}
+#endif
+
 void FillIoSendData(const IoData* data, struct iovec* dst, std::size_t count) {
     UASSERT(data);
     UASSERT(count > 0);
@@ -338,6 +443,137 @@ size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
     );
 }
 
+size_t Socket::SendAllZeroCopy(const IoData* list, std::size_t list_size, Deadline deadline) {
+    if (!IsValid()) {
+        throw IoException("Attempt to SendAllZeroCopy to closed socket");
+    }
+
+#ifdef USERVER_IMPL_SOCKET_ZEROCOPY
+    if (zerocopy_state_ == ZeroCopyState::kUnknown) {
+        const int enable = 1;
+        const bool is_enabled = ::setsockopt(Fd(), SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)) == 0;
+        zerocopy_state_ = is_enabled ? ZeroCopyState::kEnabled : ZeroCopyState::kDisabled;
+        if (!is_enabled) {
+            LOG_LIMITED_INFO() << "SO_ZEROCOPY is not supported for fd=" << Fd() << ", falling back to copying";
+        }
+    }
+
+    if (zerocopy_state_ == ZeroCopyState::kEnabled) {
+        UASSERT(list);
+        UASSERT(list_size > 0);
+        UINVARIANT(list_size <= IOV_MAX, "To big array of IoData for SendAllZeroCopy");
+
+        std::vector<struct ::iovec> data(list_size);
+        FillIoSendData(list, data.data(), list_size);
+
+        std::size_t sent_bytes = 0;
+        {
+            auto& dir = fd_control_->Write();
+            dir.ResetReady();
+            impl::Direction::SingleUserGuard guard(dir);
+            sent_bytes = dir.PerformIoV(
+                guard,
+                ZeroCopySendWrapper{zerocopy_sends_},
+                data.data(),
+                list_size,
+                impl::TransferMode::kWhole,
+                deadline,
+                "SendAllZeroCopy to ",
+                peername_
+            );
+        }
+
+        // The caller may free or modify the buffers only after the kernel is done
+        // with them
+        WaitZeroCopyCompletions(deadline);
+        return sent_bytes;
+    }
+#endif
+
+    return SendAll(list, list_size, deadline);
+}
+
+void Socket::WaitZeroCopyCompletions([[maybe_unused]] Deadline deadline) {
+#ifdef USERVER_IMPL_SOCKET_ZEROCOPY
+    auto poll_interval = kZeroCopyMinPollInterval;
+    while (zerocopy_completions_ != zerocopy_sends_) {
+        const auto completions = ReapZeroCopyCompletions(Fd());
+        zerocopy_completions_ += completions.count;
+        if (completions.copied && zerocopy_state_ == ZeroCopyState::kEnabled) {
+            // Happens for loopback and for devices without scatter-gather and
+            // checksum offload: the pinning is a pure overhead then
+            LOG_LIMITED_INFO() << "Kernel copies MSG_ZEROCOPY data for fd=" << Fd() << ", disabling zero-copy";
+            zerocopy_state_ = ZeroCopyState::kDisabled;
+        }
+        if (zerocopy_completions_ == zerocopy_sends_) break;
+
+        // The peer does not acknowledge the data. Releasing the buffers while
+        // the kernel still uses them could send garbage, so the connection is
+        // reset: the pending data is discarded and the pages are unpinned.
+        if (deadline.IsReached()) {
+            AbortZeroCopy();
+            throw IoTimeout() << "Waiting for MSG_ZEROCOPY completions";
+        }
+        if (current_task::ShouldCancel()) {
+            AbortZeroCopy();
+            throw IoCancelled() << "Waiting for MSG_ZEROCOPY completions";
+        }
+
+        engine::InterruptibleSleepFor(poll_interval);
+        poll_interval = std::min(poll_interval * 2, kZeroCopyMaxPollInterval);
+    }
+#endif
+}
+
+void Socket::AbortZeroCopy() {
+#ifdef USERVER_IMPL_SOCKET_ZEROCOPY
+    LOG_LIMITED_WARNING() << "MSG_ZEROCOPY sends were not completed on fd=" << Fd() << ", resetting the connection";
+
+    // Disconnecting a TCP socket sends RST and purges its send queue, without
+    // closing the fd that may be waited for by other tasks
+    struct sockaddr unspec {};
+    unspec.sa_family = AF_UNSPEC;
+    ::connect(Fd(), &unspec, sizeof(unspec));
+
+    // The data can not reach the peer anymore, late completions are ignored
+    ReapZeroCopyCompletions(Fd());
+    zerocopy_completions_ = zerocopy_sends_;
+#endif
+}
+
+size_t Socket::SendFile(int in_fd, std::size_t offset, std::size_t len, Deadline deadline) {
+    if (!IsValid()) {
+        throw IoException("Attempt to SendFile to closed socket");
+    }
+    if (len == 0) return 0;
+
+#ifdef __linux__
+    auto& dir = fd_control_->Write();
+    dir.ResetReady();
+    impl::Direction::SingleUserGuard guard(dir);
+    return dir.PerformIoSized(
+        guard, SendFileWrapper{in_fd, offset}, len, impl::TransferMode::kWhole, deadline, "SendFile to ", peername_
+    );
+#else
+    // MAC_COMPAT: sendfile has a different signature, falling back to copying
+    std::array<char, kSendFileFallbackBufferSize> buffer{};
+    std::size_t sent_bytes = 0;
+    while (sent_bytes < len) {
+        const auto read_bytes = ::pread(
+            in_fd, buffer.data(), std::min(buffer.size(), len - sent_bytes), static_cast<off_t>(offset + sent_bytes)
+        );
+        if (read_bytes == -1 && errno == EINTR) continue;
+        utils::CheckSyscallCustomException<IoSystemError>(read_bytes, "reading file for SendFile, fd={}", in_fd);
+        if (read_bytes == 0) break;
+
+        const auto chunk_sent = SendAll(buffer.data(), read_bytes, deadline);
+        sent_bytes += chunk_sent;
+        if (chunk_sent != static_cast<std::size_t>(read_bytes)) break;
+    }
+    return sent_bytes;
+#endif
+}
+
 Socket::RecvFromResult Socket::RecvSomeFrom(void* buf, size_t len, Deadline deadline) {
     if (!IsValid()) {
         throw IoException("Attempt to RecvSomeFrom via closed socket");
@@ -18,6 +18,9 @@
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/wait_any.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/internal/net/net_listener.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -29,6 +32,8 @@ using Deadline = engine::Deadline;
 using TcpListener = internal::net::TcpListener;
 using UdpListener = internal::net::UdpListener;
 
+[[maybe_unused]] constexpr int kOne = 1;
+
 }  // namespace
 
 UTEST(Socket, ConnectFail) {
@@ -193,6 +198,107 @@ UTEST(Socket, SendAllVector) {
     EXPECT_EQ(bytes_sent, bytes_read);
 }
 
+UTEST(Socket, SendFile) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    const auto file = fs::blocking::TempFile::Create();
+    fs::blocking::RewriteFileContents(file.GetPath(), "skip:payload:tail");
+    const auto fd = fs::blocking::FileDescriptor::Open(file.GetPath(), fs::blocking::OpenFlag::kRead);
+
+    TcpListener listener;
+    auto sockets = listener.MakeSocketPair(deadline);
+    auto listen_task = engine::AsyncNoSpan([&sockets, &deadline] {
+        std::array<char, 7> buf = {};
+        const auto bytes_read = sockets.first.RecvAll(buf.data(), buf.size(), deadline);
+        EXPECT_EQ(std::string_view(buf.data(), bytes_read), "payload");
+    });
+
+    const auto bytes_sent = sockets.second.SendFile(fd.GetNative(), 5, 7, deadline);
+    EXPECT_EQ(bytes_sent, 7);
+    listen_task.Get();
+
+    // the file ends earlier than requested
+    EXPECT_EQ(sockets.second.SendFile(fd.GetNative(), 13, 100, deadline), 4);
+}
+
+UTEST(Socket, SendAllZeroCopy) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    TcpListener listener;
+    auto sockets = listener.MakeSocketPair(deadline);
+
+    const std::string header = "header";
+    const std::string body(1024 * 1024, 'z');
+    auto listen_task = engine::AsyncNoSpan([&] {
+        std::string buf(header.size() + body.size(), '\0');
+        const auto bytes_read = sockets.first.RecvAll(buf.data(), buf.size(), deadline);
+        EXPECT_EQ(bytes_read, buf.size());
+        EXPECT_EQ(buf, header + body);
+    });
+
+    const std::array<io::IoData, 2> list{{{header.data(), header.size()}, {body.data(), body.size()}}};
+    // Loopback data is copied by the kernel anyway, the second call checks the
+    // fallback to copying
+    EXPECT_EQ(sockets.second.SendAllZeroCopy(list.data(), 1, deadline), header.size());
+    EXPECT_EQ(sockets.second.SendAllZeroCopy(list.data() + 1, 1, deadline), body.size());
+
+    listen_task.Get();
+}
+
+#ifdef SO_ZEROCOPY
+UTEST(Socket, SendAllZeroCopyNotAcknowledged) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    TcpListener listener;
+    // The peer does not read and has a tiny receive window, so the sent data
+    // stays in the send queue and its completions are deferred
+    listener.socket.SetOption(SOL_SOCKET, SO_RCVBUF, 4096);
+    auto sockets = listener.MakeSocketPair(deadline);
+    if (::setsockopt(sockets.second.Fd(), SOL_SOCKET, SO_ZEROCOPY, &kOne, sizeof(kOne)) != 0) {
+        GTEST_SKIP() << "SO_ZEROCOPY is not supported";
+    }
+
+    const std::string body(256 * 1024, 'z');
+    const io::IoData data{body.data(), body.size()};
+    UEXPECT_THROW(
+        [[maybe_unused]] auto sent =
+            sockets.second.SendAllZeroCopy(&data, 1, Deadline::FromDuration(std::chrono::milliseconds{100})),
+        io::IoTimeout
+    );
+
+    // The connection is reset, the peer never gets the whole body
+    std::string buf(body.size(), '\0');
+    std::size_t bytes_read = 0;
+    try {
+        bytes_read = sockets.first.RecvAll(buf.data(), buf.size(), deadline);
+    } catch (const io::IoSystemError&) {
+    }
+    EXPECT_LT(bytes_read, body.size());
+}
+
+UTEST(Socket, SendAllZeroCopyCancelled) {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    TcpListener listener;
+    listener.socket.SetOption(SOL_SOCKET, SO_RCVBUF, 4096);
+    auto sockets = listener.MakeSocketPair(deadline);
+    if (::setsockopt(sockets.second.Fd(), SOL_SOCKET, SO_ZEROCOPY, &kOne, sizeof(kOne)) != 0) {
+        GTEST_SKIP() << "SO_ZEROCOPY is not supported";
+    }
+
+    const std::string body(256 * 1024, 'z');
+    auto send_task = engine::AsyncNoSpan([&] {
+        const io::IoData data{body.data(), body.size()};
+        return sockets.second.SendAllZeroCopy(&data, 1, deadline);
+    });
+    engine::SleepFor(std::chrono::milliseconds{50});
+    EXPECT_FALSE(send_task.IsFinished());
+
+    send_task.SyncCancel();
+    UEXPECT_THROW([[maybe_unused]] auto sent = send_task.Get(), io::IoCancelled);
+}
+#endif
+
 UTEST(Socket, WaitAnyRead) {
     const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
     TcpListener listener;
@@ -0,0 +1,145 @@
+#include <engine/task/numa_topology.hpp>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include <fmt/format.h>
+#include <boost/filesystem.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::string_view kSysfsNodesPath = "/sys/devices/system/node";
+constexpr std::string_view kNodeDirectoryPrefix = "node";
+
+// Protects from allocating huge mappings for garbage in configs
+constexpr std::size_t kMaxCpuIndex = 1 << 16;
+
+std::size_t ParseCpuIndex(std::string_view value) {
+    const auto cpu = utils::FromString<std::size_t>(value);
+    if (cpu >= kMaxCpuIndex) {
+        throw std::runtime_error(fmt::format("CPU index {} is too big", cpu));
+    }
+    return cpu;
+}
+
+}  // namespace
+
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list) {
+    while (!cpu_list.empty() && (cpu_list.back() == '\n' || cpu_list.back() == ' ')) cpu_list.remove_suffix(1);
+
+    std::vector<std::size_t> result;
+    for (const auto range : utils::text::SplitIntoStringViewVector(cpu_list, ",")) {
+        if (range.empty()) continue;
+
+        const auto dash_pos = range.find('-');
+        if (dash_pos == std::string_view::npos) {
+            result.push_back(ParseCpuIndex(range));
+            continue;
+        }
+
+        const auto first = ParseCpuIndex(range.substr(0, dash_pos));
+        const auto last = ParseCpuIndex(range.substr(dash_pos + 1));
+        if (first > last) {
+            throw std::runtime_error(fmt::format("Invalid CPU range '{}'", range));
+        }
+        for (auto cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+    }
+    return result;
+}
+
+NumaTopology::NumaTopology(std::vector<std::size_t> cpu_nodes) : cpu_nodes_(std::move(cpu_nodes)) {}
+
+NumaTopology NumaTopology::ReadFromSystem() {
+    std::vector<std::size_t> cpu_nodes;
+
+    boost::system::error_code ec;
+    boost::filesystem::directory_iterator it(std::string{kSysfsNodesPath}, ec);
+    if (ec) {
+        LOG_DEBUG() << "NUMA topology is not available: " << ec.message();
+        return NumaTopology{std::move(cpu_nodes)};
+    }
+
+    for (; !ec && it != boost::filesystem::directory_iterator{}; it.increment(ec)) {
+        const auto name = it->path().filename().native();
+        if (!utils::text::StartsWith(name, kNodeDirectoryPrefix)) continue;
+
+        try {
+            const auto node =
+                utils::FromString<std::size_t>(std::string_view{name}.substr(kNodeDirectoryPrefix.size()));
+            const auto cpus = ParseCpuList(fs::blocking::ReadFileContents((it->path() / "cpulist").native()));
+            for (const auto cpu : cpus) {
+                if (cpu >= cpu_nodes.size()) cpu_nodes.resize(cpu + 1, 0);
+                cpu_nodes[cpu] = node;
+            }
+        } catch (const std::exception& ex) {
+            // e.g. 'node' directories that are not numbered
+            LOG_DEBUG() << "Skipping " << it->path().native() << ": " << ex;
+        }
+    }
+
+    return NumaTopology{std::move(cpu_nodes)};
+}
+
+std::optional<std::size_t> NumaTopology::GetNode(std::size_t cpu) const noexcept {
+    if (cpu >= cpu_nodes_.size()) return std::nullopt;
+    return cpu_nodes_[cpu];
+}
+
+std::vector<std::size_t> NumaTopology::GetNodeCpus(std::size_t node) const {
+    std::vector<std::size_t> result;
+    for (std::size_t cpu = 0; cpu < cpu_nodes_.size(); ++cpu) {
+        if (cpu_nodes_[cpu] == node) result.push_back(cpu);
+    }
+    return result;
+}
+
+WorkersPlacement
+NumaTopology::PlaceWorkers(const std::vector<std::size_t>& worker_cpus, std::size_t workers_count) const {
+    WorkersPlacement placement;
+    placement.worker_nodes.resize(workers_count, 0);
+    if (worker_cpus.empty()) return placement;
+
+    std::unordered_map<std::size_t, std::size_t> dense_nodes;
+    for (std::size_t i = 0; i < workers_count; ++i) {
+        // CPUs missing from the topology are considered to be on the node of
+        // the first worker
+        const auto node = GetNode(worker_cpus[i % worker_cpus.size()]).value_or(GetNode(worker_cpus[0]).value_or(0));
+        placement.worker_nodes[i] = dense_nodes.try_emplace(node, dense_nodes.size()).first->second;
+    }
+    placement.nodes_count = std::max<std::size_t>(dense_nodes.size(), 1);
+
+    placement.cpu_nodes.resize(cpu_nodes_.size());
+    for (std::size_t cpu = 0; cpu < cpu_nodes_.size(); ++cpu) {
+        const auto it = dense_nodes.find(cpu_nodes_[cpu]);
+        if (it != dense_nodes.end()) placement.cpu_nodes[cpu] = it->second;
+    }
+    return placement;
+}
+
+std::optional<std::size_t> GetCurrentCpu() noexcept {
+#ifdef __linux__
+    const int cpu = ::sched_getcpu();
+    if (cpu >= 0) return static_cast<std::size_t>(cpu);
+#endif
+    return std::nullopt;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
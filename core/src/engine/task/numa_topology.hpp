@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// Parses the CPU list format of sysfs and cpusets, e.g. "0-3,8,10-11"
+/// @throws std::runtime_error on invalid input
+std::vector<std::size_t> ParseCpuList(std::string_view cpu_list);
+
+/// Distribution of task processor workers over NUMA nodes. Nodes are
+/// renumbered densely in the order of workers, so the node of the first
+/// worker is always 0.
+struct WorkersPlacement final {
+    std::size_t nodes_count{1};
+
+    /// Node of each worker
+    std::vector<std::size_t> worker_nodes;
+
+    /// Node of each CPU, std::nullopt for CPUs on nodes without workers
+    std::vector<std::optional<std::size_t>> cpu_nodes;
+};
+
+/// Mapping of CPUs to NUMA nodes
+class NumaTopology final {
+public:
+    /// `cpu_nodes[cpu]` is the NUMA node of the cpu
+    explicit NumaTopology(std::vector<std::size_t> cpu_nodes);
+
+    /// Reads the topology from /sys/devices/system/node, all the CPUs are
+    /// considered to be on the same node if the topology is not available.
+    static NumaTopology ReadFromSystem();
+
+    /// @returns NUMA node of the CPU or std::nullopt for unknown CPUs
+    std::optional<std::size_t> GetNode(std::size_t cpu) const noexcept;
+
+    /// @returns CPUs of the NUMA node
+    std::vector<std::size_t> GetNodeCpus(std::size_t node) const;
+
+    /// Worker `i` is expected to be pinned to `worker_cpus[i % size]`, all the
+    /// workers are on the same node if `worker_cpus` is empty.
+    WorkersPlacement PlaceWorkers(const std::vector<std::size_t>& worker_cpus, std::size_t workers_count) const;
+
+private:
+    std::vector<std::size_t> cpu_nodes_;
+};
+
+/// @returns the CPU the current thread is running on, if known
+std::optional<std::size_t> GetCurrentCpu() noexcept;
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,55 @@
+#include <engine/task/numa_topology.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using Cpus = std::vector<std::size_t>;
+
+TEST(NumaTopology, ParseCpuList) {
+    EXPECT_EQ(engine::ParseCpuList(""), Cpus{});
+    EXPECT_EQ(engine::ParseCpuList("3"), Cpus{3});
+    EXPECT_EQ(engine::ParseCpuList("0-3\n"), (Cpus{0, 1, 2, 3}));
+    EXPECT_EQ(engine::ParseCpuList("0-1,8,10-11"), (Cpus{0, 1, 8, 10, 11}));
+
+    EXPECT_ANY_THROW(engine::ParseCpuList("3-1"));
+    EXPECT_ANY_THROW(engine::ParseCpuList("a-b"));
+    EXPECT_ANY_THROW(engine::ParseCpuList("100000000"));
+}
+
+TEST(NumaTopology, PlaceWorkersWithoutPinning) {
+    const engine::NumaTopology topology{{0, 0, 1, 1}};
+    const auto placement = topology.PlaceWorkers({}, 3);
+
+    EXPECT_EQ(placement.nodes_count, 1);
+    EXPECT_EQ(placement.worker_nodes, (Cpus{0, 0, 0}));
+}
+
+TEST(NumaTopology, PlaceWorkers) {
+    // CPUs 0,1,4,5 on node 0, CPUs 2,3,6,7 on node 1, CPUs 8,9 on node 2
+    const engine::NumaTopology topology{{0, 0, 1, 1, 0, 0, 1, 1, 2, 2}};
+    EXPECT_EQ(topology.GetNode(2), 1);
+    EXPECT_EQ(topology.GetNode(10), std::nullopt);
+    EXPECT_EQ(topology.GetNodeCpus(1), (Cpus{2, 3, 6, 7}));
+    EXPECT_EQ(topology.GetNodeCpus(3), Cpus{});
+
+    // Nodes are renumbered in the order of workers
+    const auto placement = topology.PlaceWorkers({2, 3, 0, 1}, 6);
+    EXPECT_EQ(placement.nodes_count, 2);
+    EXPECT_EQ(placement.worker_nodes, (Cpus{0, 0, 1, 1, 0, 0}));
+
+    ASSERT_EQ(placement.cpu_nodes.size(), 10);
+    EXPECT_EQ(placement.cpu_nodes[0], 1);
+    EXPECT_EQ(placement.cpu_nodes[6], 0);
+    EXPECT_EQ(placement.cpu_nodes[8], std::nullopt);
+}
+
+TEST(NumaTopology, PlaceWorkersUnknownCpus) {
+    const engine::NumaTopology topology{{}};
+    const auto placement = topology.PlaceWorkers({0, 1}, 2);
+
+    EXPECT_EQ(placement.nodes_count, 1);
+    EXPECT_EQ(placement.worker_nodes, (Cpus{0, 0}));
+}
+
+USERVER_NAMESPACE_END
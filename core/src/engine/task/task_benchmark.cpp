@@ -10,6 +10,7 @@
 
 #include <concurrent/impl/latch.hpp>
 #include <engine/impl/standalone.hpp>
+#include <engine/task/numa_topology.hpp>
 #include <engine/task/task_processor.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/work_stealing_queue/task_queue.hpp>
@@ -194,4 +195,61 @@ void engine_tasks_from_another_task_processor(benchmark::State& state) {
 }
 BENCHMARK(engine_tasks_from_another_task_processor)->RangeMultiplier(2)->Range(2, 32)->Arg(6)->Arg(12);
 
+// Spawns and awaits tasks on the work-stealing task processor with workers on
+// the first range(0) NUMA nodes. If range(1) is set, workers are pinned to CPUs
+// and the queue prefers stealing within a node.
+void engine_work_stealing_numa_nodes(benchmark::State& state) {
+    const auto topology = engine::NumaTopology::ReadFromSystem();
+    std::vector<std::size_t> cpus;
+    for (std::int64_t node = 0; node < state.range(0); ++node) {
+        const auto node_cpus = topology.GetNodeCpus(node);
+        if (node_cpus.empty()) {
+            state.SkipWithError("Not enough NUMA nodes");
+            return;
+        }
+        cpus.insert(cpus.end(), node_cpus.begin(), node_cpus.end());
+    }
+
+    engine::RunStandalone([&] {
+        engine::TaskProcessorConfig proc_config;
+        proc_config.name = "benchmark";
+        proc_config.thread_name = "benchmark";
+        proc_config.worker_threads = cpus.size();
+        proc_config.task_processor_queue = engine::TaskQueueType::kWorkStealingTaskQueue;
+        if (state.range(1)) proc_config.worker_cpus = cpus;
+        engine::TaskProcessor task_processor(
+            std::move(proc_config), engine::current_task::GetTaskProcessor().GetTaskProcessorPools()
+        );
+
+        std::atomic<bool> keep_running{true};
+        std::vector<engine::TaskWithResult<std::uint64_t>> tasks;
+        tasks.reserve(cpus.size());
+        for (std::size_t i = 0; i < cpus.size(); ++i) {
+            tasks.push_back(engine::AsyncNoSpan(task_processor, [&] {
+                std::uint64_t tasks_count = 0;
+                while (keep_running) {
+                    engine::AsyncNoSpan([] {}).Wait();
+                    ++tasks_count;
+                }
+                return tasks_count;
+            }));
+        }
+
+        for ([[maybe_unused]] auto _ : state) {
+            engine::Yield();
+        }
+
+        keep_running = false;
+        std::uint64_t tasks_count = 0;
+        for (auto& task : tasks) {
+            tasks_count += task.Get();
+        }
+
+        state.counters["tasks"] = benchmark::Counter(tasks_count, benchmark::Counter::kIsRate);
+        state.counters["tasks/thread"] =
+            benchmark::Counter(static_cast<double>(tasks_count) / cpus.size(), benchmark::Counter::kIsRate);
+    });
+}
+BENCHMARK(engine_work_stealing_numa_nodes)->ArgsProduct({{1, 2, 4}, {0, 1}})->ArgNames({"nodes", "pinned"});
+
 USERVER_NAMESPACE_END
@@ -284,6 +284,16 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
             break;
     }
 
+    if (!config_.worker_cpus.empty()) {
+        const auto cpu = config_.worker_cpus[index % config_.worker_cpus.size()];
+        try {
+            utils::SetCurrentThreadCpuAffinity(cpu);
+        } catch (const std::exception& ex) {
+            LOG_ERROR() << "Failed to pin worker " << index << " of task processor " << Name() << " to CPU " << cpu
+                        << ": " << ex;
+        }
+    }
+
     std::visit([index](auto& obj) { obj.PrepareWorker(index); }, task_queue_);
 
     pools_->GetCoroPool().PrepareLocalCache();
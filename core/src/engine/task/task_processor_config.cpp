@@ -9,6 +9,8 @@
 #include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
+#include <engine/task/numa_topology.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine {
@@ -64,6 +66,11 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::
     config.spinning_iterations = value["spinning-iterations"].As<int>(config.spinning_iterations);
     config.task_processor_queue = value["task-processor-queue"].As<TaskQueueType>(config.task_processor_queue);
 
+    const auto worker_cpus = value["worker-cpus"];
+    if (!worker_cpus.IsMissing()) {
+        config.worker_cpus = ParseCpuList(worker_cpus.As<std::string>());
+    }
+
     const auto task_trace = value["task-trace"];
     if (!task_trace.IsMissing()) {
         config.task_trace_every = task_trace["every"].As<std::size_t>(config.task_trace_every);
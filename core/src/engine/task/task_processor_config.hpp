@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
@@ -34,6 +35,10 @@ struct TaskProcessorConfig {
     int spinning_iterations{1000};
     TaskQueueType task_processor_queue{TaskQueueType::kGlobalTaskQueue};
 
+    // Worker `i` is pinned to `worker_cpus[i % worker_cpus.size()]`, workers
+    // are not pinned if empty
+    std::vector<std::size_t> worker_cpus;
+
     std::size_t task_trace_every{1000};
     std::size_t task_trace_max_csw{0};
     std::string task_trace_logger_name;
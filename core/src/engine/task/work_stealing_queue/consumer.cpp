@@ -41,6 +41,9 @@ constexpr std::size_t kFrequencyGlobalQueuePop = 61;
 // frequency of visits to the background
 // queue in stealing process
 constexpr std::size_t kFrequencyStealingBackgroundQueuePop = 10;
+// frequency of visits to the queues of other NUMA
+// nodes in stealing process
+constexpr std::size_t kFrequencyStealingRemoteNodes = 4;
 }  // namespace
 
 Consumer::Consumer(WorkStealingTaskQueue& owner, ConsumersManager& consumers_manager)
@@ -49,7 +52,10 @@ Consumer::Consumer(WorkStealingTaskQueue& owner, ConsumersManager& consumers_man
       steal_attempts_count_(std::max<std::size_t>(3, kDefaultStealSpins / owner.consumers_count_)),
       rnd_(utils::Rand()),
       steps_count_(rnd_()),
-      global_queue_token_(owner_.global_queue_.CreateConsumerToken()),
+      global_queue_tokens_(utils::GenerateFixedArray(
+          owner_.global_queues_.size(),
+          [&owner](std::size_t node) { return owner.global_queues_[node].CreateConsumerToken(); }
+      )),
       background_queue_token_(owner.background_queue_.CreateConsumerToken()) {}
 
 void Consumer::Push(impl::TaskContext* ctx) {
@@ -79,7 +85,10 @@ std::size_t Consumer::GetLocalQueueSize() const noexcept {
 
 WorkStealingTaskQueue* Consumer::GetOwner() const noexcept { return &owner_; }
 
-void Consumer::SetIndex(std::size_t index) noexcept { inner_index_ = index; }
+void Consumer::SetIndex(std::size_t index, std::size_t node) noexcept {
+    inner_index_ = index;
+    node_ = node;
+}
 
 bool Consumer::IsStopped() const noexcept { return consumers_manager_.IsStopped(); }
 
@@ -94,35 +103,34 @@ void Consumer::EmptySurplusQueue(impl::TaskContext* extra) {
 
     // Second, we push the remaining tasks to the global queue
     if (pushed_shift < free_tasks_count) {
-        owner_.global_queue_.PushBulk(
-            global_queue_token_, utils::span(steal_buffer_.data() + pushed_shift, free_tasks_count - pushed_shift)
+        GetNodeGlobalQueue().PushBulk(
+            global_queue_tokens_[node_],
+            utils::span(steal_buffer_.data() + pushed_shift, free_tasks_count - pushed_shift)
         );
     }
 }
 
 impl::TaskContext*
 Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std::size_t to_steal_count) {
+    const std::size_t nodes_count = owner_.global_queues_.size();
     std::size_t stealed_size = 0;
     for (std::size_t i = 0; i < attempts && to_steal_count > 0 && stealed_size == 0; ++i) {
-        std::size_t start_index = rnd_() % owner_.consumers_count_;
-        for (std::size_t shift = 0; shift < owner_.consumers_count_ && to_steal_count > 0 && stealed_size == 0;
-             ++shift) {
-            std::size_t index = (start_index + shift) % owner_.consumers_count_;
-            Consumer* victim = &owner_.consumers_[index];
-            if (victim == this) {
-                continue;
-            }
-            const std::size_t tasks_count =
-                victim->Steal(utils::span(steal_buffer_.data() + stealed_size, to_steal_count));
-            stealed_size += tasks_count;
-            to_steal_count -= tasks_count;
-        }
-
-        if (stealed_size == 0) {
-            impl::TaskContext* ctx = owner_.global_queue_.TryPop(global_queue_token_);
-            if (ctx) {
-                steal_buffer_[stealed_size++] = ctx;
-                to_steal_count--;
+        // Crossing the NUMA node boundary thrashes the caches, so the tasks of
+        // the own node are preferred. Other nodes are still visited from time
+        // to time and on the last attempt to guarantee progress.
+        const bool visit_remote_nodes = (i % kFrequencyStealingRemoteNodes == kFrequencyStealingRemoteNodes - 1) ||
+                                        (i + 1 == attempts);
+        const std::size_t visited_nodes = visit_remote_nodes ? nodes_count : 1;
+
+        for (std::size_t shift = 0; shift < visited_nodes && stealed_size == 0; ++shift) {
+            const std::size_t node = (node_ + shift) % nodes_count;
+            stealed_size = StealFromNode(node, utils::span(steal_buffer_.data(), to_steal_count));
+
+            if (stealed_size == 0) {
+                impl::TaskContext* ctx = owner_.global_queues_[node].TryPop(global_queue_tokens_[node]);
+                if (ctx) {
+                    steal_buffer_[stealed_size++] = ctx;
+                }
             }
         }
 
@@ -130,7 +138,6 @@ Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std:
             impl::TaskContext* ctx = owner_.background_queue_.TryPop(background_queue_token_);
             if (ctx) {
                 steal_buffer_[stealed_size++] = ctx;
-                to_steal_count--;
             }
         }
     }
@@ -144,6 +151,22 @@ Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std:
     return nullptr;
 }
 
+std::size_t Consumer::StealFromNode(std::size_t node, utils::span<impl::TaskContext*> buffer) {
+    const auto& victims = owner_.node_consumers_[node];
+    const std::size_t start_index = rnd_() % victims.size();
+    for (std::size_t shift = 0; shift < victims.size(); ++shift) {
+        Consumer* victim = &owner_.consumers_[victims[(start_index + shift) % victims.size()]];
+        if (victim == this) {
+            continue;
+        }
+        const std::size_t tasks_count = victim->Steal(buffer);
+        if (tasks_count > 0) {
+            return tasks_count;
+        }
+    }
+    return 0;
+}
+
 std::size_t Consumer::Steal(utils::span<impl::TaskContext*> buffer) {
     std::size_t can_be_stealed_count = local_queue_.GetSize();
     if (can_be_stealed_count) {
@@ -165,13 +188,14 @@ std::size_t Consumer::Steal(utils::span<impl::TaskContext*> buffer) {
 }
 
 impl::TaskContext* Consumer::TryPopFromOwnerQueue(const bool is_global) {
-    GlobalQueue* queue = &owner_.global_queue_;
-    GlobalQueue::Token* token = &global_queue_token_;
+    GlobalQueue* queue = &GetNodeGlobalQueue();
+    GlobalQueue::Token* token = &global_queue_tokens_[node_];
+    std::size_t consumers_count = owner_.node_consumers_[node_].size();
     if (!is_global) {
         queue = &owner_.background_queue_;
         token = &background_queue_token_;
+        consumers_count = owner_.consumers_count_;
     }
-    const std::size_t consumers_count = owner_.consumers_count_;
     std::size_t steal_size =
         std::min((queue->GetSizeApproximateDelayed() + consumers_count) / consumers_count, kConsumerStealBufferSize);
     steal_size = queue->PopBulk(*token, utils::span(steal_buffer_.data(), steal_size));
@@ -190,7 +214,7 @@ impl::TaskContext* Consumer::TryPopFromOwnerQueue(const bool is_global) {
 impl::TaskContext* Consumer::ProbabilisticPopFromOwnerQueues() {
     impl::TaskContext* context = nullptr;
     if (steps_count_ % kFrequencyGlobalQueuePop == 0) {
-        context = owner_.global_queue_.TryPop(global_queue_token_);
+        context = GetNodeGlobalQueue().TryPop(global_queue_tokens_[node_]);
         if (context) {
             return context;
         }
@@ -199,6 +223,8 @@ impl::TaskContext* Consumer::ProbabilisticPopFromOwnerQueues() {
     return nullptr;
 }
 
+GlobalQueue& Consumer::GetNodeGlobalQueue() noexcept { return owner_.global_queues_[node_]; }
+
 impl::TaskContext* Consumer::TryPop() {
     impl::TaskContext* context = TryPopFromOwnerQueue(/* is_global */ true);
     if (context) {
@@ -5,6 +5,8 @@
 #include <cstddef>
 #include <random>
 
+#include <userver/utils/fixed_array.hpp>
+
 #include <engine/task/work_stealing_queue/global_queue.hpp>
 #include <engine/task/work_stealing_queue/local_queue.hpp>
 
@@ -35,7 +37,7 @@ private:
     friend ConsumersManager;
     friend WorkStealingTaskQueue;
 
-    void SetIndex(std::size_t index) noexcept;
+    void SetIndex(std::size_t index, std::size_t node) noexcept;
 
     bool IsStopped() const noexcept;
 
@@ -43,8 +45,12 @@ private:
 
     impl::TaskContext* StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std::size_t to_steal);
 
+    std::size_t StealFromNode(std::size_t node, utils::span<impl::TaskContext*> buffer);
+
     std::size_t Steal(utils::span<impl::TaskContext*> buffer);
 
+    GlobalQueue& GetNodeGlobalQueue() noexcept;
+
     impl::TaskContext* TryPopFromOwnerQueue(const bool is_global);
 
     impl::TaskContext* ProbabilisticPopFromOwnerQueues();
@@ -73,12 +79,14 @@ private:
     ConsumersManager& consumers_manager_;
     const std::size_t steal_attempts_count_;
     std::size_t inner_index_{0};
+    std::size_t node_{0};
     // kConsumerStealBufferSize + 1 for extra task in push
     std::array<impl::TaskContext*, kConsumerStealBufferSize + 1> steal_buffer_{};
     std::minstd_rand rnd_;
     std::size_t steps_count_{0};
     std::atomic<std::int32_t> sleep_counter_{0};
-    GlobalQueue::Token global_queue_token_;
+    // A token for the global queue of each NUMA node
+    utils::FixedArray<GlobalQueue::Token> global_queue_tokens_;
     GlobalQueue::Token background_queue_token_;
 #ifndef __linux__
     std::condition_variable cv_;
@@ -13,16 +13,33 @@ namespace {
 // It is only used in worker threads outside of any coroutine,
 // so it does not need to be protected via compiler::ThreadLocal
 thread_local Consumer* localConsumer = nullptr;
+
+std::vector<std::vector<std::size_t>> GroupConsumersByNode(const WorkersPlacement& placement) {
+    std::vector<std::vector<std::size_t>> result(placement.nodes_count);
+    for (std::size_t i = 0; i < placement.worker_nodes.size(); ++i) {
+        result[placement.worker_nodes[i]].push_back(i);
+    }
+    return result;
+}
+
 }  // namespace
 
 WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
+    : WorkStealingTaskQueue(
+          config,
+          config.worker_cpus.empty() ? NumaTopology{std::vector<std::size_t>{}} : NumaTopology::ReadFromSystem()
+      ) {}
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config, const NumaTopology& topology)
     : consumers_count_(config.worker_threads),
-      global_queue_(consumers_count_),
+      placement_(topology.PlaceWorkers(config.worker_cpus, consumers_count_)),
+      node_consumers_(GroupConsumersByNode(placement_)),
+      global_queues_(placement_.nodes_count, consumers_count_),
       background_queue_(consumers_count_),
       consumers_(config.worker_threads, *this, consumers_manager_),
       consumers_manager_(consumers_count_) {
     for (size_t i = 0; i < consumers_count_; ++i) {
-        consumers_[i].SetIndex(i);
+        consumers_[i].SetIndex(i, placement_.worker_nodes[i]);
     }
 }
 
@@ -49,7 +66,9 @@ std::size_t WorkStealingTaskQueue::GetSizeApproximate() const noexcept {
     for (const auto& consumer : consumers_) {
         size += consumer.GetLocalQueueSize();
     }
-    size += global_queue_.GetSizeApproximate();
+    for (const auto& global_queue : global_queues_) {
+        size += global_queue.GetSizeApproximate();
+    }
     size += background_queue_.GetSizeApproximate();
     return size;
 }
@@ -69,7 +88,7 @@ void WorkStealingTaskQueue::DoPush(impl::TaskContext* context) {
         } else if (context && context->IsBackground()) {
             background_queue_.Push(context);
         } else {
-            global_queue_.Push(context);
+            GetGlobalQueueForPush().Push(context);
         }
     }
     consumers_manager_.NotifyNewTask();
@@ -83,6 +102,18 @@ impl::TaskContext* WorkStealingTaskQueue::DoPopBlocking() {
 
 Consumer* WorkStealingTaskQueue::GetConsumer() { return localConsumer; }
 
+GlobalQueue& WorkStealingTaskQueue::GetGlobalQueueForPush() {
+    if (placement_.nodes_count == 1) return global_queues_[0];
+
+    // Tasks from the threads outside of the task processor go to the node of
+    // the producer, its caches are likely to hold the task data
+    const auto cpu = GetCurrentCpu();
+    if (cpu && *cpu < placement_.cpu_nodes.size() && placement_.cpu_nodes[*cpu]) {
+        return global_queues_[*placement_.cpu_nodes[*cpu]];
+    }
+    return global_queues_[push_node_counter_.fetch_add(1, std::memory_order_relaxed) % placement_.nodes_count];
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
+#include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include <engine/task/numa_topology.hpp>
 #include <engine/task/task_processor_config.hpp>
 #include <engine/task/work_stealing_queue/consumer.hpp>
 #include <engine/task/work_stealing_queue/consumers_manager.hpp>
@@ -23,6 +26,8 @@ class WorkStealingTaskQueue final {
 public:
     explicit WorkStealingTaskQueue(const TaskProcessorConfig& config);
 
+    WorkStealingTaskQueue(const TaskProcessorConfig& config, const NumaTopology& topology);
+
     void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
     // Returns nullptr as a stop signal
     boost::intrusive_ptr<impl::TaskContext> PopBlocking();
@@ -40,12 +45,19 @@ private:
 
     Consumer* GetConsumer();
 
+    GlobalQueue& GetGlobalQueueForPush();
+
     const std::size_t consumers_count_;
+    const WorkersPlacement placement_;
+    // Indices of consumers on each NUMA node
+    const std::vector<std::vector<std::size_t>> node_consumers_;
 
-    GlobalQueue global_queue_;
+    // One per NUMA node, consumers prefer the queue of their own node
+    utils::FixedArray<GlobalQueue> global_queues_;
     GlobalQueue background_queue_;
     utils::FixedArray<Consumer> consumers_;
     ConsumersManager consumers_manager_;
+    std::atomic<std::size_t> push_node_counter_{0};
 };
 
 }  // namespace engine
@@ -3,7 +3,10 @@
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include <userver/engine/async.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/fs/blocking/open_mode.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/fs/read.hpp>
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/async.hpp>
@@ -142,6 +145,21 @@ FileInfoWithDataConstPtr FsCacheClient::TryGetFile(std::string_view path) const
     return nullptr;
 }
 
+std::optional<fs::blocking::FileDescriptor> FsCacheClient::TryOpenFile(std::string_view path) const {
+    // Only the files known to cache may be opened, that guards from escaping dir_
+    if (!TryGetFile(path)) return std::nullopt;
+
+    auto full_path = dir_ + std::string{path};
+    return engine::AsyncNoSpan(tp_, [&full_path]() -> std::optional<fs::blocking::FileDescriptor> {
+               try {
+                   return fs::blocking::FileDescriptor::Open(full_path, fs::blocking::OpenFlag::kRead);
+               } catch (const std::exception& e) {
+                   LOG_WARNING() << "Failed to open cached file " << full_path << ": " << e;
+                   return std::nullopt;
+               }
+           }).Get();
+}
+
 }  // namespace fs
 
 USERVER_NAMESPACE_END
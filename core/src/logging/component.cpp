@@ -96,6 +96,10 @@ void Logging::Init(const ComponentConfig& config, const ComponentContext& contex
             socket_sink_ = logging::impl::GetTcpSocketSink(*logger);
         }
 
+        if (logger_config.batching_max_latency) {
+            logger->EnableBatching(*logger_config.batching_max_latency);
+        }
+
         logger->StartConsumerTask(
             context.GetTaskProcessor(tp_name), logger_config.message_queue_size, logger_config.queue_overflow_behavior
         );
@@ -282,6 +286,7 @@ properties:
                       - raw
                       - json
                       - json_yadeploy
+                      - binary
                 flush_level:
                     type: string
                     description: messages of this and higher levels get flushed to the file immediately
@@ -301,6 +306,12 @@ properties:
                     type: string
                     description: task processor for disk I/O operations for this logger
                     defaultDescription: fs-task-processor of the loggers component
+                batching-max-latency:
+                    type: string
+                    description: |
+                        if set, log records are collected in per-thread buffers and written to the sinks in
+                        batches, a record waits in a buffer for no longer than this time, e.g. `10ms`
+                    defaultDescription: batching is disabled
                 testsuite-capture:
                     type: object
                     description: if exists, setups additional TCP log sink for testing purposes
@@ -46,6 +46,8 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Logg
 
     config.fs_task_processor = value["fs-task-processor"].As<std::optional<std::string>>();
 
+    config.batching_max_latency = value["batching-max-latency"].As<std::optional<std::chrono::milliseconds>>();
+
     config.testsuite_capture = value["testsuite-capture"].As<std::optional<TestsuiteCaptureConfig>>();
 
     return config;
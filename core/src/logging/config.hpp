@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -40,6 +42,9 @@ struct LoggerConfig final {
 
     std::optional<std::string> fs_task_processor;
 
+    // if set, records are collected in per-thread buffers and written in batches
+    std::optional<std::chrono::milliseconds> batching_max_latency;
+
     std::optional<TestsuiteCaptureConfig> testsuite_capture;
 };
 
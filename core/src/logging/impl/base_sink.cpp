@@ -14,6 +14,28 @@ void BaseSink::Log(const LogMessage& message) {
     }
 }
 
+void BaseSink::LogBatch(const std::vector<LogMessage>& messages) {
+    batch_parts_.clear();
+    for (const auto& message : messages) {
+        if (!ShouldLog(message.level)) continue;
+
+        const auto& payload = message.payload;
+        if (!batch_parts_.empty() && batch_parts_.back().data() + batch_parts_.back().size() == payload.data()) {
+            batch_parts_.back() = std::string_view{batch_parts_.back().data(), batch_parts_.back().size() + payload.size()};
+        } else {
+            batch_parts_.push_back(payload);
+        }
+    }
+
+    if (!batch_parts_.empty()) WriteBatch(batch_parts_);
+}
+
+void BaseSink::WriteBatch(const std::vector<std::string_view>& parts) {
+    for (const auto part : parts) {
+        Write(part);
+    }
+}
+
 void BaseSink::Flush() {}
 
 void BaseSink::Reopen(ReopenMode) {}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <string_view>
+#include <vector>
 
 #include <logging/impl/reopen_mode.hpp>
 #include <userver/logging/level.hpp>
@@ -22,6 +24,10 @@ public:
 
     void Log(const LogMessage& message);
 
+    /// Writes the messages that pass the sink level with a single
+    /// WriteBatch() call. Messages adjacent in memory are written as one.
+    void LogBatch(const std::vector<LogMessage>& messages);
+
     virtual void Flush();
 
     virtual void Reopen(ReopenMode);
@@ -35,8 +41,12 @@ protected:
 
     virtual void Write(std::string_view log) = 0;
 
+    /// Default implementation calls Write() for each of the parts
+    virtual void WriteBatch(const std::vector<std::string_view>& parts);
+
 private:
     std::atomic<Level> level_{Level::kTrace};
+    std::vector<std::string_view> batch_parts_;
 };
 
 }  // namespace logging::impl
@@ -0,0 +1,72 @@
+#include "binary_file_sink.hpp"
+
+#include <algorithm>
+
+#include <logging/impl/binary_format.hpp>
+
+#include "open_file_helper.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+BinaryFileSink::BinaryFileSink(const std::string& filename)
+    : filename_{filename}, file_(OpenFile<fs::blocking::CFile>(filename)) {
+    WriteStart();
+}
+
+BinaryFileSink::~BinaryFileSink() = default;
+
+void BinaryFileSink::Reopen(ReopenMode mode) {
+    file_.FlushLight();
+    auto new_file = OpenFile<fs::blocking::CFile>(filename_, mode);
+    std::move(file_).Close();
+    file_ = std::move(new_file);
+    WriteStart();
+}
+
+void BinaryFileSink::Flush() {
+    if (file_.IsOpen()) {
+        file_.FlushLight();
+    }
+}
+
+void BinaryFileSink::Write(std::string_view log) {
+    // Batched writes pass several records at once, each of them may depend
+    // on more interned strings than the previous ones
+    std::uint32_t strings_used = 0;
+    for (auto frames = log; !frames.empty();) {
+        const auto type = static_cast<binary::FrameType>(frames[0]);
+        frames.remove_prefix(1);
+        const auto payload_size = binary::ReadVarint(frames);
+        if (!payload_size || *payload_size > frames.size()) break;
+
+        if (type == binary::FrameType::kRecord) {
+            auto payload = frames.substr(0, *payload_size);
+            const auto record_strings_used = binary::ReadVarint(payload).value_or(0);
+            strings_used = std::max(strings_used, static_cast<std::uint32_t>(record_strings_used));
+        }
+        frames.remove_prefix(*payload_size);
+    }
+
+    if (strings_used > strings_written_) {
+        frames_.clear();
+        binary::AppendStringFrames(frames_, strings_written_, strings_used);
+        file_.Write(frames_);
+        strings_written_ = strings_used;
+    }
+    file_.Write(log);
+}
+
+void BinaryFileSink::WriteStart() {
+    // The file may be appended after a restart, the interned strings of the
+    // previous process are reset by the start frame
+    frames_.clear();
+    binary::AppendStartFrame(frames_);
+    file_.Write(frames_);
+    strings_written_ = 0;
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
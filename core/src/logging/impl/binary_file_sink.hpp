@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <logging/impl/base_sink.hpp>
+#include <userver/fs/blocking/c_file.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// @brief Buffered file sink for the logging::Format::kBinary records.
+///
+/// Writes the interned strings that the records depend on before the records,
+/// so that each file is decodable on its own, even after a reopen.
+class BinaryFileSink final : public BaseSink {
+public:
+    explicit BinaryFileSink(const std::string& filename);
+    ~BinaryFileSink() override;
+
+    void Reopen(ReopenMode mode) override;
+
+    void Flush() override;
+
+protected:
+    void Write(std::string_view log) override;
+
+private:
+    void WriteStart();
+
+    std::string filename_;
+    fs::blocking::CFile file_;
+    std::uint32_t strings_written_{0};
+    std::string frames_;
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
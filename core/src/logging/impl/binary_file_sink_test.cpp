@@ -0,0 +1,120 @@
+#include "binary_file_sink.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <logging/impl/formatters/binary.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/logging/impl/binary_decoder.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string FormatRecord(std::string_view key, std::string_view text) {
+    logging::impl::formatters::Binary formatter{logging::Level::kInfo, utils::impl::SourceLocation::Current()};
+    formatter.AddTag(key, logging::LogExtra::Value{42});
+    formatter.SetText(text);
+
+    auto& item = formatter.ExtractLoggerItem();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    return std::string{static_cast<logging::impl::TextLogItem&>(item).log_line};
+}
+
+void LogText(logging::impl::BaseSink& sink, std::string_view text) {
+    const auto record = FormatRecord("key", text);
+    sink.Log({record, logging::Level::kInfo});
+}
+
+std::string DecodeFile(const std::string& filename) {
+    const auto data = fs::blocking::ReadFileContents(filename);
+
+    logging::impl::BinaryLogDecoder decoder{logging::Format::kTskv};
+    std::string result;
+    EXPECT_EQ(decoder.Decode(data, result), data.size());
+    return result;
+}
+
+std::size_t CountLines(std::string_view text) { return std::count(text.begin(), text.end(), '\n'); }
+
+}  // namespace
+
+UTEST(BinaryFileSink, Decodable) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const auto filename = temp_root.GetPath() + "/temp_file";
+    logging::impl::BinaryFileSink sink{filename};
+
+    LogText(sink, "first");
+    LogText(sink, "second");
+    sink.Flush();
+
+    auto text = DecodeFile(filename);
+    EXPECT_EQ(CountLines(text), 2) << text;
+    EXPECT_NE(text.find("\tkey=42\ttext=first\n"), std::string::npos) << text;
+    EXPECT_NE(text.find("\tkey=42\ttext=second\n"), std::string::npos) << text;
+
+    // Interned strings are written again after the reopen
+    sink.Reopen(logging::impl::ReopenMode::kTruncate);
+    LogText(sink, "third");
+    sink.Flush();
+
+    text = DecodeFile(filename);
+    EXPECT_EQ(CountLines(text), 1) << text;
+    EXPECT_NE(text.find("\tkey=42\ttext=third\n"), std::string::npos) << text;
+}
+
+UTEST(BinaryFileSink, Append) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const auto filename = temp_root.GetPath() + "/temp_file";
+
+    {
+        logging::impl::BinaryFileSink sink{filename};
+        LogText(sink, "first");
+    }
+    {
+        logging::impl::BinaryFileSink sink{filename};
+        LogText(sink, "second");
+    }
+
+    const auto text = DecodeFile(filename);
+    EXPECT_EQ(CountLines(text), 2) << text;
+    EXPECT_NE(text.find("\ttext=second\n"), std::string::npos) << text;
+}
+
+UTEST(BinaryFileSink, Batch) {
+    const auto temp_root = fs::blocking::TempDirectory::Create();
+    const auto filename = temp_root.GetPath() + "/temp_file";
+    logging::impl::BinaryFileSink sink{filename};
+
+    // Each record interns a new key, the batch is merged into a single write
+    constexpr std::size_t kRecords = 5;
+    std::string buffer;
+    std::vector<std::size_t> record_ends;
+    for (std::size_t i = 0; i < kRecords; ++i) {
+        buffer += FormatRecord(fmt::format("batch_key_{}", i), fmt::format("batched_{}", i));
+        record_ends.push_back(buffer.size());
+    }
+
+    std::vector<logging::impl::LogMessage> messages;
+    std::size_t record_begin = 0;
+    for (const auto record_end : record_ends) {
+        const auto record = std::string_view{buffer}.substr(record_begin, record_end - record_begin);
+        messages.push_back({record, logging::Level::kInfo});
+        record_begin = record_end;
+    }
+    sink.LogBatch(messages);
+    sink.Flush();
+
+    const auto text = DecodeFile(filename);
+    EXPECT_EQ(CountLines(text), kRecords) << text;
+    for (std::size_t i = 0; i < kRecords; ++i) {
+        EXPECT_NE(text.find(fmt::format("\tbatch_key_{}=42\ttext=batched_{}\n", i, i)), std::string::npos) << text;
+    }
+}
+
+USERVER_NAMESPACE_END
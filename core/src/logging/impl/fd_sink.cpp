@@ -1,13 +1,67 @@
 #include "fd_sink.hpp"
 
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <system_error>
+
+#include <boost/container/small_vector.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+constexpr std::size_t kMaxIovecs = IOV_MAX;
+
+}  // namespace
+
+void WriteAllVectored(int fd, const std::vector<std::string_view>& parts) {
+    boost::container::small_vector<::iovec, 64> iovecs;
+
+    for (std::size_t begin = 0; begin < parts.size(); begin += kMaxIovecs) {
+        const auto end = std::min(parts.size(), begin + kMaxIovecs);
+        iovecs.clear();
+        for (std::size_t i = begin; i < end; ++i) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            iovecs.push_back({const_cast<char*>(parts[i].data()), parts[i].size()});
+        }
+
+        auto* current = iovecs.data();
+        auto* const iovecs_end = iovecs.data() + iovecs.size();
+        while (current != iovecs_end) {
+            const auto count = static_cast<int>(iovecs_end - current);
+            const ::ssize_t written = ::writev(fd, current, count);
+            if (written < 0) {
+                if (errno == EAGAIN || errno == EINTR) continue;
+
+                const auto code = std::make_error_code(std::errc{errno});
+                throw std::system_error(code, "calling ::writev");
+            }
+
+            // Skip the fully written parts and cut the partially written one
+            auto left = static_cast<std::size_t>(written);
+            while (current != iovecs_end && left >= current->iov_len) {
+                left -= current->iov_len;
+                ++current;
+            }
+            if (current != iovecs_end) {
+                current->iov_base = static_cast<char*>(current->iov_base) + left;
+                current->iov_len -= left;
+            }
+        }
+    }
+}
+
 FdSink::FdSink(fs::blocking::FileDescriptor fd) : fd_{std::move(fd)} {}
 
 void FdSink::Write(std::string_view log) { fd_.Write(log); }
 
+void FdSink::WriteBatch(const std::vector<std::string_view>& parts) { WriteAllVectored(fd_.GetNative(), parts); }
+
 void FdSink::Flush() {
     if (fd_.IsOpen()) {
         fd_.FSync();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string_view>
+#include <vector>
 
 #include <userver/fs/blocking/file_descriptor.hpp>
 
@@ -10,6 +11,9 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+/// Writes all the parts to fd with as few ::writev calls as possible
+void WriteAllVectored(int fd, const std::vector<std::string_view>& parts);
+
 class FdSink : public BaseSink {
 public:
     explicit FdSink(fs::blocking::FileDescriptor fd);
@@ -21,6 +25,8 @@ public:
 protected:
     void Write(std::string_view log) final;
 
+    void WriteBatch(const std::vector<std::string_view>& parts) final;
+
     fs::blocking::FileDescriptor& GetFd();
 
     void SetFd(fs::blocking::FileDescriptor&& fd);
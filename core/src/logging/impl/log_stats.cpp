@@ -19,6 +19,11 @@ void DumpMetric(utils::statistics::Writer& writer, const impl::LogStatistics& st
 
     writer["total"] = total;
     writer["has_reopening_error"] = stats.has_reopening_error.load();
+
+    if (const auto batches = stats.batches.Load()) {
+        writer["batches"] = batches;
+        writer["batch_delay_us"] = stats.batch_delay_us.Load();
+    }
 }
 
 }  // namespace logging::impl
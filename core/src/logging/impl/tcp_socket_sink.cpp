@@ -6,8 +6,11 @@
 #include <netinet/tcp.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <climits>
 #include <cstring>
 
+#include <boost/container/small_vector.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
@@ -44,6 +47,28 @@ void TcpSocketClient::Send(const char* data, size_t n_bytes) {
     }
 }
 
+void TcpSocketClient::Send(const std::vector<std::string_view>& parts) {
+    constexpr std::size_t kMaxIoData = IOV_MAX;
+    boost::container::small_vector<engine::io::IoData, 64> io_data;
+
+    for (std::size_t begin = 0; begin < parts.size(); begin += kMaxIoData) {
+        const auto end = std::min(parts.size(), begin + kMaxIoData);
+        io_data.clear();
+        std::size_t n_bytes = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            io_data.push_back({parts[i].data(), parts[i].size()});
+            n_bytes += parts[i].size();
+        }
+
+        const auto send_result = socket_.SendAll(io_data.data(), io_data.size(), {});
+        if (n_bytes != send_result) {
+            throw std::runtime_error(
+                fmt::format("Failed to send {} bytes because the remote closed the connection", n_bytes)
+            );
+        }
+    }
+}
+
 void TcpSocketClient::Close() { socket_.Close(); }
 
 bool TcpSocketClient::IsConnected() { return socket_.Fd() != -1; }
@@ -65,6 +90,14 @@ void TcpSocketSink::Write(std::string_view log) {
     client_.Send(log.data(), log.size());
 }
 
+void TcpSocketSink::WriteBatch(const std::vector<std::string_view>& parts) {
+    const std::lock_guard lock{mutex_};
+    if (!client_.IsConnected()) {
+        client_.Connect();
+    }
+    client_.Send(parts);
+}
+
 }  // namespace logging::impl
 
 USERVER_NAMESPACE_END
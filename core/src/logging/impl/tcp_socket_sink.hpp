@@ -24,6 +24,7 @@ public:
 
     void Connect();
     void Send(const char* data, size_t n_bytes);
+    void Send(const std::vector<std::string_view>& parts);
     bool IsConnected();
     void Close();
 
@@ -45,6 +46,8 @@ public:
 protected:
     void Write(std::string_view log) final;
 
+    void WriteBatch(const std::vector<std::string_view>& parts) final;
+
 private:
     std::mutex mutex_;
     impl::TcpSocketClient client_;
@@ -12,6 +12,8 @@
 #include <userver/utils/strerror.hpp>
 #include <utils/check_syscall.hpp>
 
+#include "fd_sink.hpp"
+
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
@@ -40,6 +42,15 @@ void UnixSocketClient::send(std::string_view message) {
     }
 }
 
+void UnixSocketClient::send(const std::vector<std::string_view>& messages) {
+    try {
+        WriteAllVectored(socket_, messages);
+    } catch (const std::system_error&) {
+        close();
+        throw;
+    }
+}
+
 void UnixSocketClient::close() {
     if (socket_ != -1) {
         if (::close(socket_) == -1) {
@@ -55,6 +66,8 @@ UnixSocketClient::~UnixSocketClient() { close(); }
 
 void UnixSocketSink::Write(std::string_view log) { client_.send(log); }
 
+void UnixSocketSink::WriteBatch(const std::vector<std::string_view>& parts) { client_.send(parts); }
+
 void UnixSocketSink::Close() { client_.close(); }
 
 }  // namespace logging::impl
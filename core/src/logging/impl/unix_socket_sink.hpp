@@ -2,6 +2,8 @@
 
 #include <mutex>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <logging/impl/base_sink.hpp>
 
@@ -21,6 +23,7 @@ public:
 
     void connect(std::string_view filename);
     void send(std::string_view message);
+    void send(const std::vector<std::string_view>& messages);
     void close();
 
 private:
@@ -36,6 +39,8 @@ public:
 protected:
     void Write(std::string_view log) final;
 
+    void WriteBatch(const std::vector<std::string_view>& parts) final;
+
 private:
     const std::string filename_;
     impl::UnixSocketClient client_;
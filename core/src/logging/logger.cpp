@@ -5,6 +5,7 @@
 #include <fmt/compile.h>
 
 #include <engine/task/task_context.hpp>
+#include <logging/impl/binary_file_sink.hpp>
 #include <logging/impl/buffered_file_sink.hpp>
 #include <logging/impl/fd_sink.hpp>
 #include <logging/impl/unix_socket_sink.hpp>
@@ -13,6 +14,7 @@
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
 
 #include "config.hpp"
 
@@ -55,14 +57,19 @@ void LogRaw(TextLogger& logger, Level level, std::string_view message) {
 }  // namespace impl
 
 LoggerPtr MakeStderrLogger(const std::string& name, Format format, Level level) {
+    UINVARIANT(format != Format::kBinary, "Binary log format may be written only to a file");
     return MakeSimpleLogger(name, MakeStderrSink(), level, format);
 }
 
 LoggerPtr MakeStdoutLogger(const std::string& name, Format format, Level level) {
+    UINVARIANT(format != Format::kBinary, "Binary log format may be written only to a file");
     return MakeSimpleLogger(name, MakeStdoutSink(), level, format);
 }
 
 LoggerPtr MakeFileLogger(const std::string& name, const std::string& path, Format format, Level level) {
+    if (format == Format::kBinary) {
+        return MakeSimpleLogger(name, std::make_unique<impl::BinaryFileSink>(path), level, format);
+    }
     return MakeSimpleLogger(name, std::make_unique<impl::BufferedFileSink>(path), level, format);
 }
 
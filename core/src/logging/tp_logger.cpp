@@ -1,9 +1,13 @@
 #include "tp_logger.hpp"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/logging/logger.hpp>
@@ -15,20 +19,41 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+namespace {
+
+// A thread buffer of this size is drained without waiting for the timer
+constexpr std::size_t kBufferDrainThreshold = 64 * 1024;
+
+std::atomic<std::uint64_t> next_logger_id{0};
+
+using ThreadBuffers = std::vector<std::pair<std::uint64_t, std::shared_ptr<async::ThreadBuffer>>>;
+
+compiler::ThreadLocal local_thread_buffers = [] { return ThreadBuffers{}; };
+
+}  // namespace
+
+void async::BufferedRecords::Clear() noexcept {
+    payloads.clear();
+    records.clear();
+}
+
 struct TpLogger::ActionVisitor final {
     TpLogger& logger;
 
     void operator()(impl::async::Log&& log) const {
-        logger.AccountLogConsumed();
+        logger.AccountLogConsumed(1);
         logger.BackendLog(std::move(log));
     }
 
+    void operator()(impl::async::DrainBuffers&&) const { logger.BackendDrainBuffers(); }
+
     void operator()(impl::async::Stop&&) const noexcept {
         // The consumer thread will check state_ later.
     }
 
     void operator()(impl::async::ReopenCoro&& reopen) const noexcept {
         try {
+            logger.BackendDrainBuffers();
             logger.BackendReopen(reopen.reopen_mode);
             reopen.promise.set_value();
         } catch (const std::exception& e) {
@@ -40,13 +65,14 @@ struct TpLogger::ActionVisitor final {
 
     template <class Flush>
     void operator()(Flush&& flush) const {
+        logger.BackendDrainBuffers();
         logger.BackendFlush();
         flush.promise.set_value();
     }
 };
 
 TpLogger::TpLogger(Format format, std::string logger_name)
-    : impl::TextLogger(format), logger_name_(std::move(logger_name)) {
+    : impl::TextLogger(format), logger_name_(std::move(logger_name)), id_(next_logger_id.fetch_add(1)) {
     SetLevel(logging::Level::kInfo);
 }
 
@@ -77,12 +103,22 @@ void TpLogger::StartConsumerTask(
 
     consuming_task_ =
         engine::CriticalAsyncNoSpan(task_processor, [this, guard = std::move(exit_async_guard)] { ProcessingLoop(); });
+
+    if (batching_max_latency_.count() != 0) {
+        batching_task_ = engine::CriticalAsyncNoSpan(task_processor, [this] { BatchingLoop(); });
+    }
+}
+
+void TpLogger::EnableBatching(std::chrono::milliseconds max_latency) {
+    UINVARIANT(max_latency.count() > 0, "Invalid batching max latency");
+    UINVARIANT(state_ == State::kSync, "Batching must be enabled before switching the logger to async mode");
+    batching_max_latency_ = max_latency;
 }
 
 TpLogger::~TpLogger() {
     UASSERT_MSG(state_ == State::kSync, "We may be in non coroutine context, async logger must be in sync mode");
     UASSERT_MSG(
-        !consuming_task_.IsValid(),
+        !consuming_task_.IsValid() && !batching_task_.IsValid(),
         "We may be in non coroutine context, async logger must be in "
         "sync mode and consuming task must be stopped"
     );
@@ -94,6 +130,11 @@ void TpLogger::StopConsumerTask() {
         return;
     }
 
+    if (batching_task_.IsValid()) {
+        batching_task_.SyncCancel();
+        batching_task_ = {};
+    }
+
     DoPush(stop_node_);
 
     const engine::TaskCancellationBlocker block_cancel;
@@ -143,6 +184,10 @@ void TpLogger::Log(Level level, impl::formatters::LoggerItemRef item) {
         produced_->fetch_add(1);
 
         try {
+            if (batching_max_latency_.count() != 0 && state_ == State::kAsync) {
+                LogBatched(level, msg.log_line);
+                return;
+            }
             Push(impl::async::Log{level, std::string{msg.log_line}});
         } catch (const std::exception&) {
             // failed to construct a Log action or a node in Push
@@ -197,6 +242,75 @@ void TpLogger::ProcessingLoop() {
     CleanUpQueue(std::move(queue_consumer_));
 }
 
+void TpLogger::BatchingLoop() {
+    while (!engine::current_task::ShouldCancel()) {
+        engine::InterruptibleSleepFor(batching_max_latency_);
+        if (has_buffered_->exchange(false)) {
+            Push(impl::async::DrainBuffers{});
+        }
+    }
+}
+
+void TpLogger::LogBatched(Level level, std::string_view log_line) {
+    bool request_drain = false;
+    {
+        auto local_buffers = local_thread_buffers.Use();
+        auto& buffer = GetThreadBuffer(*local_buffers);
+
+        const std::lock_guard lock{buffer.mutex};
+        auto& active = buffer.active;
+        const auto old_payloads_size = active.payloads.size();
+        try {
+            active.payloads.append(log_line);
+            active.records.push_back({active.payloads.size(), level});
+        } catch (const std::exception&) {
+            active.payloads.resize(old_payloads_size);
+            throw;
+        }
+
+        if (active.records.size() == 1) {
+            active.first_record_time = std::chrono::steady_clock::now();
+            has_buffered_->store(true);
+        }
+        if (active.payloads.size() >= kBufferDrainThreshold && !buffer.drain_requested) {
+            buffer.drain_requested = true;
+            request_drain = true;
+        }
+    }
+
+    if (request_drain) {
+        try {
+            Push(impl::async::DrainBuffers{});
+        } catch (const std::exception&) {
+            // The record is already buffered, it will be written on a timer
+        }
+    }
+}
+
+impl::async::ThreadBuffer& TpLogger::GetThreadBuffer(ThreadBuffers& local_buffers) {
+    for (const auto& [logger_id, buffer] : local_buffers) {
+        if (logger_id == id_) return *buffer;
+    }
+
+    // Forget the buffers of the destroyed loggers
+    local_buffers.erase(
+        std::remove_if(
+            local_buffers.begin(),
+            local_buffers.end(),
+            [](const auto& local_buffer) { return local_buffer.second.use_count() == 1; }
+        ),
+        local_buffers.end()
+    );
+
+    auto buffer = std::make_shared<impl::async::ThreadBuffer>();
+    {
+        const std::lock_guard lock{buffers_mutex_};
+        buffers_.push_back(buffer);
+    }
+    local_buffers.emplace_back(id_, buffer);
+    return *buffer;
+}
+
 void TpLogger::BackendPerform(impl::async::Action&& action) noexcept {
     try {
         std::visit(ActionVisitor{*this}, std::move(action));
@@ -239,8 +353,8 @@ void TpLogger::DoPush(concurrent::impl::SinglyLinkedBaseHook& node) noexcept {
     }
 }
 
-void TpLogger::AccountLogConsumed() noexcept {
-    consumed_->store(consumed_->load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+void TpLogger::AccountLogConsumed(QueueSize count) noexcept {
+    consumed_->store(consumed_->load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
     if (overflow_policy_.load() == QueueOverflowBehavior::kBlock) {
         {
             // Atomic consumed_ mutation doesn't need to be protected by lock.
@@ -250,7 +364,11 @@ void TpLogger::AccountLogConsumed() noexcept {
             //    not fall asleep
             const std::lock_guard lock{capacity_waiters_mutex_};
         }
-        capacity_waiters_cv_.NotifyOne();
+        if (count == 1) {
+            capacity_waiters_cv_.NotifyOne();
+        } else {
+            capacity_waiters_cv_.NotifyAll();
+        }
     }
 }
 
@@ -270,6 +388,12 @@ void TpLogger::ConsumeQueueOnce(Queue::Consumer& consumer) noexcept {
 }
 
 void TpLogger::CleanUpQueue(Queue::Consumer&& consumer) noexcept {
+    // Records may still get into the buffers while the logger is being stopped
+    try {
+        BackendDrainBuffers();
+    } catch (const std::exception& e) {
+        UASSERT_MSG(false, fmt::format("Exception while draining the log buffers: {}", e.what()));
+    }
     std::move(consumer).ConsumeAndStop([this](auto& node) noexcept { ConsumeNode(node); });
 }
 
@@ -291,6 +415,76 @@ void TpLogger::BackendLog(impl::async::Log&& action) const {
     }
 }
 
+void TpLogger::BackendDrainBuffers() {
+    if (batching_max_latency_.count() == 0) return;
+
+    UASSERT(draining_buffers_.empty());
+    {
+        const std::lock_guard lock{buffers_mutex_};
+        for (auto it = buffers_.begin(); it != buffers_.end();) {
+            auto& buffer = **it;
+            {
+                const std::lock_guard buffer_lock{buffer.mutex};
+                UASSERT(buffer.draining.IsEmpty());
+                std::swap(buffer.active, buffer.draining);
+                buffer.drain_requested = false;
+            }
+            if (!buffer.draining.IsEmpty()) draining_buffers_.push_back(*it);
+
+            // Only the registry references the buffer, its thread is gone
+            if (it->use_count() == 1) {
+                it = buffers_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    if (draining_buffers_.empty()) return;
+
+    utils::FastScopeGuard cleanup_guard([this]() noexcept {
+        for (const auto& buffer : draining_buffers_) buffer->draining.Clear();
+        draining_buffers_.clear();
+        batch_messages_.clear();
+    });
+
+    const auto now = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::duration max_delay{0};
+    bool should_flush = false;
+
+    batch_messages_.clear();
+    for (const auto& buffer : draining_buffers_) {
+        const auto& draining = buffer->draining;
+        max_delay = std::max(max_delay, now - draining.first_record_time);
+
+        std::size_t payload_begin = 0;
+        for (const auto& record : draining.records) {
+            batch_messages_.push_back(LogMessage{
+                std::string_view{draining.payloads}.substr(payload_begin, record.payload_end - payload_begin),
+                record.level,
+            });
+            payload_begin = record.payload_end;
+            should_flush = should_flush || ShouldFlush(record.level);
+        }
+    }
+
+    AccountLogConsumed(static_cast<QueueSize>(batch_messages_.size()));
+    ++stats_.batches;
+    stats_.batch_delay_us.Add(utils::statistics::Rate{
+        static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(max_delay).count())});
+
+    for (const auto& sink : GetSinks()) {
+        try {
+            sink->LogBatch(batch_messages_);
+        } catch (const std::exception& e) {
+            UASSERT_MSG(false, "While writing a batch of log messages caught an exception: " + std::string(e.what()));
+        }
+    }
+
+    if (should_flush) {
+        BackendFlush();
+    }
+}
+
 void TpLogger::BackendFlush() const {
     for (const auto& sink : GetSinks()) {
         try {
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <future>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -53,12 +56,40 @@ struct ReopenCoro {
 
 struct Stop {};
 
-using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro>;
+/// Write the records collected in the thread buffers
+struct DrainBuffers {};
+
+using Action = std::variant<Stop, Log, FlushCoro, FlushThreaded, ReopenCoro, DrainBuffers>;
 
 struct ActionNode final : public concurrent::impl::SinglyLinkedBaseHook {
     Action action{Stop{}};
 };
 
+struct BufferedRecords final {
+    struct Record final {
+        std::size_t payload_end{0};
+        Level level{};
+    };
+
+    bool IsEmpty() const noexcept { return records.empty(); }
+    void Clear() noexcept;
+
+    // Payloads of all the records one after another
+    std::string payloads;
+    std::vector<Record> records;
+    std::chrono::steady_clock::time_point first_record_time{};
+};
+
+/// Records logged from a single thread in the batching mode
+struct ThreadBuffer final {
+    std::mutex mutex;
+    // Filled by the producers under the mutex
+    BufferedRecords active;
+    // Swapped with `active` and written by the consumer, no lock needed
+    BufferedRecords draining;
+    bool drain_requested{false};
+};
+
 }  // namespace async
 
 /// @brief Asynchronous logger that logs into a specific TaskProcessor.
@@ -75,6 +106,11 @@ public:
 
     void StopConsumerTask();
 
+    /// Makes producers append records to per-thread buffers, which the
+    /// consumer writes in batches at least each `max_latency`, on Flush and
+    /// when a buffer grows large. Must be called before StartConsumerTask.
+    void EnableBatching(std::chrono::milliseconds max_latency);
+
     void Log(Level level, impl::formatters::LoggerItemRef msg) override;
     void Flush() override;
     void PrependCommonTags(TagWriter writer) const override;
@@ -101,8 +137,12 @@ private:
 
     using Queue = engine::impl::AsyncFlatCombiningQueue;
     using QueueSize = std::int64_t;
+    using ThreadBuffers = std::vector<std::pair<std::uint64_t, std::shared_ptr<impl::async::ThreadBuffer>>>;
 
     void ProcessingLoop();
+    void BatchingLoop();
+    void LogBatched(Level level, std::string_view log_line);
+    impl::async::ThreadBuffer& GetThreadBuffer(ThreadBuffers& local_buffers);
     bool HasFreeQueueCapacity() noexcept;
     bool TryWaitFreeQueueCapacity();
     void Push(impl::async::Action&& action);
@@ -110,9 +150,10 @@ private:
     void ConsumeNode(concurrent::impl::SinglyLinkedBaseHook& node) noexcept;
     void ConsumeQueueOnce(Queue::Consumer& consumer) noexcept;
     void CleanUpQueue(Queue::Consumer&& consumer) noexcept;
-    void AccountLogConsumed() noexcept;
+    void AccountLogConsumed(QueueSize count) noexcept;
     void BackendPerform(impl::async::Action&& action) noexcept;
     void BackendLog(impl::async::Log&& action) const;
+    void BackendDrainBuffers();
     void BackendFlush() const;
     void BackendReopen(ReopenMode reopen_mode) const;
 
@@ -134,6 +175,17 @@ private:
     Queue queue_;
     concurrent::impl::InterferenceShield<std::atomic<QueueSize>> produced_{0};
     concurrent::impl::InterferenceShield<std::atomic<QueueSize>> consumed_{0};
+
+    // Batching mode, see EnableBatching
+    const std::uint64_t id_;
+    std::chrono::milliseconds batching_max_latency_{0};
+    engine::Task batching_task_;
+    concurrent::impl::InterferenceShield<std::atomic<bool>> has_buffered_{false};
+    std::mutex buffers_mutex_;
+    std::vector<std::shared_ptr<impl::async::ThreadBuffer>> buffers_;
+    // Used only by the consumer
+    std::vector<std::shared_ptr<impl::async::ThreadBuffer>> draining_buffers_;
+    std::vector<LogMessage> batch_messages_;
 };
 
 }  // namespace logging::impl
@@ -2,12 +2,16 @@
 
 #include <benchmark/benchmark.h>
 
+#include <chrono>
+#include <optional>
+
 #include <logging/impl/null_sink.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/fixed_array.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -31,7 +35,10 @@ protected:
 
     void TearDown(const benchmark::State&) override { guard_.reset(); }
 
-    auto StartAsyncLoggerScope() {
+    auto StartAsyncLoggerScope(std::optional<std::chrono::milliseconds> batching_max_latency = {}) {
+        if (batching_max_latency) {
+            tp_logger_->EnableBatching(*batching_max_latency);
+        }
         tp_logger_->StartConsumerTask(
             engine::current_task::GetTaskProcessor(), 1 << 30, logging::QueueOverflowBehavior::kDiscard
         );
@@ -89,4 +96,42 @@ BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogCheckSpan)
 }
 BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogCheckSpan);
 
+namespace {
+
+constexpr std::size_t kRecordsPerProducer = 1000;
+
+}  // namespace
+
+// Many producers log concurrently, with and without per-thread batching
+BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogContention)(benchmark::State& state) {
+    const auto producers = static_cast<std::size_t>(state.range(0));
+    std::optional<std::chrono::milliseconds> batching_max_latency;
+    if (state.range(1) != 0) {
+        batching_max_latency = std::chrono::milliseconds{10};
+    }
+
+    engine::RunStandalone(producers, [&] {
+        auto scope = StartAsyncLoggerScope(batching_max_latency);
+        const auto msg = Launder(std::string(64, '*'));
+
+        for ([[maybe_unused]] auto _ : state) {
+            auto tasks = utils::GenerateFixedArray(producers, [&](std::size_t) {
+                return engine::AsyncNoSpan([&] {
+                    for (std::size_t i = 0; i < kRecordsPerProducer; ++i) {
+                        LOG_INFO() << msg;
+                    }
+                });
+            });
+            for (auto& task : tasks) {
+                task.Get();
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * producers * kRecordsPerProducer);
+    });
+}
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogContention)
+    ->ArgsProduct({{16, 32, 64}, {0, 1}})
+    ->ArgNames({"producers", "batching"})
+    ->UseRealTime();
+
 USERVER_NAMESPACE_END
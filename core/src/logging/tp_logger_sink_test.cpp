@@ -2,6 +2,10 @@
 
 #include <atomic>
 #include <future>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
 
 #include <compiler/relax_cpu.hpp>
 #include <logging/tp_logger.hpp>
@@ -41,6 +45,21 @@ private:
     std::atomic<std::uint64_t> write_count_{0};
 };
 
+class BatchRecordingSink final : public logging::impl::BaseSink {
+public:
+    const std::vector<std::vector<std::string>>& GetBatches() const { return batches_; }
+
+protected:
+    void Write(std::string_view log) override { batches_.push_back({std::string{log}}); }
+
+    void WriteBatch(const std::vector<std::string_view>& parts) override {
+        batches_.emplace_back(parts.begin(), parts.end());
+    }
+
+private:
+    std::vector<std::vector<std::string>> batches_;
+};
+
 class Backoff final {
 public:
     Backoff() = default;
@@ -117,4 +136,26 @@ UTEST_MT(TpLogger, SerializesSinkOperations, 4) {
     // - some operations were successfully performed on the NonThreadSafeSink.
 }
 
+UTEST(TpLogger, BatchesAreWrittenAtOnce) {
+    logging::impl::TpLogger logger{logging::Format::kRaw, "test-logger"};
+    logger.AddSink(std::make_unique<BatchRecordingSink>());
+    logger.EnableBatching(std::chrono::minutes{1});
+    logger.StartConsumerTask(
+        engine::current_task::GetTaskProcessor(), 1 << 8, logging::QueueOverflowBehavior::kDiscard
+    );
+
+    for (int i = 0; i < 3; ++i) {
+        logging::impl::TextLogItem item{{fmt::format("record {}\n", i)}};
+        logger.Log(logging::Level::kInfo, item);
+    }
+    logger.Flush();
+    logger.StopConsumerTask();
+
+    // Records from the same thread are adjacent in memory and written as one part
+    const auto& batches = dynamic_cast<BatchRecordingSink&>(*logger.GetSinks().at(0)).GetBatches();
+    ASSERT_EQ(batches.size(), 1);
+    ASSERT_EQ(batches[0].size(), 1);
+    EXPECT_EQ(batches[0][0], "record 0\nrecord 1\nrecord 2\n");
+}
+
 USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <gmock/gmock.h>
 
 #include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/statistics/storage.hpp>
@@ -44,7 +45,8 @@ public:
 
     std::shared_ptr<logging::impl::TpLogger> StartAsyncLogger(
         std::size_t queue_size_max = 10,
-        QueueOverflowBehavior on_overflow = QueueOverflowBehavior::kDiscard
+        QueueOverflowBehavior on_overflow = QueueOverflowBehavior::kDiscard,
+        std::optional<std::chrono::milliseconds> batching_max_latency = {}
     ) {
         UASSERT_MSG(
             engine::current_task::IsTaskProcessorThread(), "Misconfigured test. Should be run in coroutine environment"
@@ -56,6 +58,9 @@ public:
             writer = logger->GetStatistics();
         });
 
+        if (batching_max_latency) {
+            logger->EnableBatching(*batching_max_latency);
+        }
         logger->StartConsumerTask(engine::current_task::GetTaskProcessor(), queue_size_max, on_overflow);
 
         // Tracing should not break the TpLogger
@@ -587,6 +592,76 @@ UTEST_F(LoggingTestCoro, TpLoggerFlushMultiple) {
     EXPECT_EQ(GetRecordsCount(), kLoggingTestIterations);
 }
 
+UTEST_F(LoggingTestCoro, TpLoggerBatchingFlush) {
+    auto logger = StartAsyncLogger(16, QueueOverflowBehavior::kDiscard, std::chrono::minutes{1});
+
+    for (std::size_t i = 0; i < 10; ++i) {
+        LOG_INFO_TO(logger) << i;
+    }
+    EXPECT_EQ(GetRecordsCount(), 0);
+
+    logger->Flush();
+    EXPECT_EQ(GetRecordsCount(), 10);
+    for (std::size_t i = 0; i < 10; ++i) {
+        EXPECT_THAT(GetStreamString(), testing::HasSubstr(fmt::format("text={}", i)));
+    }
+
+    LOG_INFO_TO(logger) << "after flush";
+    logger->StopConsumerTask();
+    EXPECT_THAT(GetStreamString(), testing::HasSubstr("text=after flush"));
+    EXPECT_EQ(GetRecordsCount(), 11);
+
+    EXPECT_EQ(GetMetric("total"), 11);
+    EXPECT_EQ(GetMetric("dropped"), 0);
+    EXPECT_EQ(GetMetric("batches"), 2);
+}
+
+UTEST_F(LoggingTestCoro, TpLoggerBatchingMaxLatency) {
+    auto logger = StartAsyncLogger(16, QueueOverflowBehavior::kDiscard, std::chrono::milliseconds{10});
+
+    LOG_INFO_TO(logger) << "Some log";
+    while (GetRecordsCount() == 0) {
+        engine::SleepFor(std::chrono::milliseconds{1});
+    }
+    EXPECT_THAT(GetStreamString(), testing::HasSubstr("text=Some log"));
+
+    logger->StopConsumerTask();
+    EXPECT_EQ(GetRecordsCount(), 1);
+}
+
+UTEST_F(LoggingTestCoro, TpLoggerBatchingOverflow) {
+    auto logger = StartAsyncLogger(4, QueueOverflowBehavior::kDiscard, std::chrono::minutes{1});
+
+    for (std::size_t i = 0; i < 10; ++i) {
+        LOG_INFO_TO(logger) << i;
+    }
+    logger->Flush();
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        LOG_INFO_TO(logger) << i;
+    }
+    logger->StopConsumerTask();
+
+    EXPECT_EQ(GetRecordsCount(), 8);
+    EXPECT_EQ(GetMetric("dropped"), 6);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerBatchingMultipleMT, 4) {
+    const std::size_t message_count = kLoggingTestIterations * (GetThreadCount() - 1);
+    auto logger =
+        StartAsyncLogger(message_count * 10, QueueOverflowBehavior::kDiscard, std::chrono::milliseconds{1});
+    LogTestMT(logger, GetThreadCount(), kTestLogging);
+    EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
+UTEST_F_MT(LoggingTestCoro, TpLoggerBatchingMultipleFlushSyncMT, 4) {
+    const std::size_t message_count = kLoggingTestIterations * GetThreadCount();
+    auto logger =
+        StartAsyncLogger(message_count * 10, QueueOverflowBehavior::kDiscard, std::chrono::milliseconds{1});
+    LogTestMT(logger, GetThreadCount(), kTestLogFlushSync);
+    EXPECT_EQ(GetRecordsCount(), message_count);
+}
+
 UTEST_F_MT(LoggingTestCoro, TpLoggerLogMultipleMT, 4) {
     const std::size_t message_count = kLoggingTestIterations * (GetThreadCount() - 1);
     auto logger = StartAsyncLogger(message_count * 10, QueueOverflowBehavior::kDiscard);
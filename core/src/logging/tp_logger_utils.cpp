@@ -5,9 +5,11 @@
 #include <string>
 #include <utility>
 
+#include <fmt/format.h>
 #include <boost/filesystem/operations.hpp>
 #include <boost/range/algorithm/find_if.hpp>
 
+#include <logging/impl/binary_file_sink.hpp>
 #include <logging/impl/buffered_file_sink.hpp>
 #include <logging/impl/tcp_socket_sink.hpp>
 #include <logging/impl/unix_socket_sink.hpp>
@@ -45,9 +47,25 @@ SinkPtr GetSinkFromFilename(const std::string& file_path) {
     }
 }
 
-SinkPtr MakeOptionalSink(const LoggerConfig& config) {
+SinkPtr MakeBinarySink(const LoggerConfig& config) {
     if (config.file_path == "@null") {
         return nullptr;
+    }
+    if (utils::text::StartsWith(config.file_path, "@") ||
+        utils::text::StartsWith(config.file_path, kUnixSocketPrefix)) {
+        throw std::runtime_error(
+            fmt::format("Logger '{}': binary log format may be written only to a file", config.logger_name)
+        );
+    }
+    CreateLogDirectory(config.logger_name, config.file_path);
+    return std::make_unique<BinaryFileSink>(config.file_path);
+}
+
+SinkPtr MakeOptionalSink(const LoggerConfig& config) {
+    if (config.format == Format::kBinary) {
+        return MakeBinarySink(config);
+    } else if (config.file_path == "@null") {
+        return nullptr;
     } else if (config.file_path == "@stderr") {
         return std::make_unique<logging::impl::BufferedUnownedFileSink>(stderr);
     } else if (config.file_path == "@stdout") {
@@ -75,6 +93,11 @@ std::shared_ptr<TpLogger> MakeTpLogger(const LoggerConfig& config) {
     }
 
     if (config.testsuite_capture) {
+        if (config.format == Format::kBinary) {
+            throw std::runtime_error(
+                fmt::format("Logger '{}': testsuite-capture does not support binary log format", config.logger_name)
+            );
+        }
         auto socket_sink_holder = MakeTestsuiteSink(*config.testsuite_capture);
         auto* const socket_sink = socket_sink_holder.get();
         logger->AddSink(std::move(socket_sink_holder));
@@ -191,6 +191,19 @@ properties:
                         defaultDescription: 498
                         minimum: 400
                         maximum: 599
+                    http1_fast_path_enabled:
+                        type: boolean
+                        description: |
+                            whether to parse complete HTTP/1.1 requests of the common shape with the vectorized
+                            fast path, other requests are always parsed by llhttp; opt-in until the fast path
+                            has been proven in production
+                        defaultDescription: false
+                    copy_headers_on_access:
+                        type: boolean
+                        description: |
+                            keep the request headers in a single per-request buffer and copy a header into
+                            the headers map only when it is accessed
+                        defaultDescription: false
 
             connection:
                 type: object
@@ -209,6 +222,15 @@ properties:
                         type: integer
                         description: timeout in seconds to drop connection if there's not data received from it
                         defaultDescription: 600
+                    zerocopy_threshold:
+                        type: integer
+                        description: send response bodies of this size in bytes and bigger with MSG_ZEROCOPY, saving the copy into the kernel socket buffers; pays off for bodies of hundreds of kilobytes and more
+                        defaultDescription: disabled
+                        minimum: 0
+                    zerocopy_timeout:
+                        type: integer
+                        description: timeout in seconds for the peer to acknowledge a response body sent with MSG_ZEROCOPY, the connection is reset after it
+                        defaultDescription: 60
                     stream_close_check_delay:
                         type: integer
                         description: delay in microseconds of the start of abort check routine
@@ -239,6 +261,10 @@ properties:
             shards:
                 type: integer
                 description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+            shards-cpu-steering:
+                type: boolean
+                description: distribute new connections between the SO_REUSEPORT sockets of shards by the CPU that received the connection instead of the hash of the connection (Linux only, falls back to the hash if the kernel refuses the steering program)
+                defaultDescription: false
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
@@ -253,7 +253,9 @@ void HttpHandlerBase::HandleHttpRequest(http::HttpRequest& http_request, request
         HandleRequestStream(http_request, context);
     } else {
         // !IsBodyStreamed()
-        response.SetData(HandleRequest(http_request, context));
+        auto data = HandleRequest(http_request, context);
+        // The handler may have set the body by itself, e.g. as a buffer chain
+        if (!data.empty() || !response.HasBodyChain()) response.SetData(std::move(data));
     }
 }
 
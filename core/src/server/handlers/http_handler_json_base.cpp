@@ -4,6 +4,7 @@
 #include <userver/formats/json/serialize.hpp>
 #include <userver/http/content_type.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/impl/buffer_chain.hpp>
 
 #include <userver/server/handlers/exceptions.hpp>
 #include <userver/server/handlers/json_error_builder.hpp>
@@ -45,7 +46,16 @@ std::string HttpHandlerJsonBase::HandleRequestThrow(const http::HttpRequest& req
     );
 
     const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime(kSerializeJson);
-    return formats::json::ToString(response_json);
+    utils::impl::BufferChain body;
+    formats::json::impl::ToBufferChain(response_json, body);
+    if (body.GetChunksCount() <= 1) {
+        return body.IsEmpty() ? std::string{} : std::string{body.GetChunk(0)};
+    }
+
+    // Large bodies are sent with writev right from the chunks, without
+    // reallocations on growth and without gluing them together
+    response.SetBodyChain(std::move(body));
+    return {};
 }
 
 const formats::json::Value* HttpHandlerJsonBase::GetRequestJson(const request::RequestContext& context) {
@@ -1,10 +1,19 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <algorithm>
+#include <optional>
+#include <variant>
+
+#include <fmt/format.h>
+
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/http/common_headers.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/text_light.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -33,6 +42,60 @@ const dynamic_config::Key<dynamic_config::ValueDict<std::string>> kContentTypeMa
 )"},
 };
 
+struct ByteRange {
+    std::size_t offset{0};
+    std::size_t size{0};
+};
+
+struct RangeNotSatisfiable {};
+
+std::optional<std::size_t> TryParseSize(std::string_view value) {
+    if (value.empty() || value.front() < '0' || value.front() > '9') return std::nullopt;
+    try {
+        return utils::FromString<std::size_t>(value);
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+// Parses single range `Range: bytes=...` header values according to RFC 9110.
+// Returns std::nullopt if the whole file should be sent, which is allowed for
+// multiple ranges and malformed headers.
+std::variant<std::nullopt_t, ByteRange, RangeNotSatisfiable>
+ParseRange(std::string_view header, std::size_t file_size) {
+    static constexpr std::string_view kBytesUnit = "bytes=";
+    if (!utils::text::StartsWith(header, kBytesUnit)) return std::nullopt;
+    header.remove_prefix(kBytesUnit.size());
+
+    const auto dash_pos = header.find('-');
+    if (dash_pos == std::string_view::npos || header.find(',') != std::string_view::npos) return std::nullopt;
+
+    const auto first = header.substr(0, dash_pos);
+    const auto last = header.substr(dash_pos + 1);
+
+    if (first.empty()) {
+        // suffix range: last N bytes
+        const auto suffix = TryParseSize(last);
+        if (!suffix) return std::nullopt;
+        if (*suffix == 0 || file_size == 0) return RangeNotSatisfiable{};
+        const auto size = std::min(*suffix, file_size);
+        return ByteRange{file_size - size, size};
+    }
+
+    const auto offset = TryParseSize(first);
+    if (!offset) return std::nullopt;
+    if (*offset >= file_size) return RangeNotSatisfiable{};
+
+    auto end = file_size - 1;
+    if (!last.empty()) {
+        const auto parsed_end = TryParseSize(last);
+        if (!parsed_end || *parsed_end < *offset) return std::nullopt;
+        end = std::min(*parsed_end, end);
+    }
+
+    return ByteRange{*offset, end - *offset + 1};
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -45,20 +108,59 @@ HttpHandlerStatic::HttpHandlerStatic(
           context.FindComponent<components::FsCache>(config["fs-cache-component"].As<std::string>("fs-cache-component"))
               .GetClient()
       ),
-      cache_age_(config["expires"].As<std::chrono::seconds>(600)) {}
+      cache_age_(config["expires"].As<std::chrono::seconds>(600)),
+      zero_copy_threshold_(config["zero-copy-threshold"].As<std::optional<std::size_t>>()) {}
 
 std::string HttpHandlerStatic::HandleRequestThrow(const http::HttpRequest& request, request::RequestContext&) const {
     LOG_DEBUG() << "Handler: " << request.GetRequestPath();
     auto& response = request.GetHttpResponse();
     const auto file = storage_.TryGetFile(request.GetRequestPath());
-    if (file) {
-        const auto config = config_.GetSnapshot();
-        response.SetHeader(USERVER_NAMESPACE::http::headers::kExpires, std::to_string(cache_age_.count()));
-        response.SetContentType(config[kContentTypeMap][file->extension]);
-        return file->data;
+    if (!file) {
+        response.SetStatusNotFound();
+        return "File not found";
+    }
+
+    const auto config = config_.GetSnapshot();
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kExpires, std::to_string(cache_age_.count()));
+    response.SetContentType(config[kContentTypeMap][file->extension]);
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kAcceptRanges, std::string{"bytes"});
+
+    // HTTP/2.0 responses are framed by nghttp2 in userspace, no sense to sendfile
+    std::optional<fs::blocking::FileDescriptor> fd;
+    if (zero_copy_threshold_ && file->data.size() >= *zero_copy_threshold_ && !response.GetStreamId().has_value()) {
+        fd = storage_.TryOpenFile(request.GetRequestPath());
+    }
+    // The file on FS may differ from the cached one, the range must match the
+    // data that is actually sent. fstat(2) may block, it runs on the fs task
+    // processor as well as the open(2) and the sendfile(2) calls.
+    const auto file_size =
+        fd ? engine::AsyncNoSpan(storage_.GetTaskProcessor(), [&fd] { return fd->GetSize(); }).Get()
+           : file->data.size();
+
+    ByteRange range{0, file_size};
+    const auto& range_header = request.GetHeader(USERVER_NAMESPACE::http::headers::kRange);
+    if (!range_header.empty()) {
+        const auto parsed_range = ParseRange(range_header, file_size);
+        if (std::holds_alternative<RangeNotSatisfiable>(parsed_range)) {
+            response.SetStatus(http::HttpStatus::kRangeNotSatisfiable);
+            response.SetHeader(USERVER_NAMESPACE::http::headers::kContentRange, fmt::format("bytes */{}", file_size));
+            return {};
+        }
+        if (const auto* byte_range = std::get_if<ByteRange>(&parsed_range)) {
+            range = *byte_range;
+            response.SetStatus(http::HttpStatus::kPartialContent);
+            response.SetHeader(
+                USERVER_NAMESPACE::http::headers::kContentRange,
+                fmt::format("bytes {}-{}/{}", range.offset, range.offset + range.size - 1, file_size)
+            );
+        }
+    }
+
+    if (fd) {
+        response.SetBodyFile(std::move(*fd), range.offset, range.size, storage_.GetTaskProcessor());
+        return {};
     }
-    response.SetStatusNotFound();
-    return "File not found";
+    return file->data.substr(range.offset, range.size);
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
@@ -77,6 +179,13 @@ properties:
         type: string
         description: Cache age in seconds
         defaultDescription: 600
+    zero-copy-threshold:
+        type: integer
+        description: |
+            Files of this size in bytes and bigger are sent with sendfile(2)
+            from the file system instead of copying the cached data
+        defaultDescription: disabled
+        minimum: 0
 )");
 }
 
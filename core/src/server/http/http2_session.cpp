@@ -53,6 +53,7 @@ Http2Session::Http2Session(
       data_accounter_(data_accounter),
       stats_(stats),
       remote_address_(remote_address),
+      arena_pool_(std::make_shared<impl::RequestArenaPool>()),
       socket_(socket),
       streaming_queue_(impl::Http2StreamEventQueue::Create()),
       streaming_consumer_(streaming_queue_->GetConsumer()) {
@@ -250,7 +251,8 @@ void Http2Session::RegisterStream(Stream::Id id) {
     }
     utils::FastScopeGuard guard_free{[this, stream_ptr]() noexcept { streams_pool_.free(stream_ptr); }};
 
-    new (stream_ptr) Stream(request_constructor_config_, handler_info_index_, data_accounter_, remote_address_, id);
+    new (stream_ptr)
+        Stream(request_constructor_config_, handler_info_index_, data_accounter_, remote_address_, arena_pool_, id);
     guard_free.Release();
 
     utils::FastScopeGuard guard_destroy{[this, stream_ptr]() noexcept { streams_pool_.destroy(stream_ptr); }};
@@ -6,6 +6,7 @@
 #include <server/http/http2_stream.hpp>
 #include <server/http/http2_writer.hpp>
 #include <server/http/http_request_constructor.hpp>
+#include <server/http/request_arena_pool.hpp>
 #include <server/net/stats.hpp>
 #include <server/request/request_parser.hpp>
 
@@ -127,6 +128,7 @@ private:
 
     net::ParserStats& stats_;
     engine::io::Sockaddr remote_address_;
+    std::shared_ptr<impl::RequestArenaPool> arena_pool_;
     engine::io::RwBase* socket_;
 
     std::shared_ptr<impl::Http2StreamEventQueue> streaming_queue_{nullptr};
@@ -30,9 +30,10 @@ Stream::Stream(
     const HandlerInfoIndex& handler_info_index,
     request::ResponseDataAccounter& data_accounter,
     engine::io::Sockaddr remote_address,
+    std::shared_ptr<impl::RequestArenaPool> arena_pool,
     Id id
 )
-    : constructor_(config, handler_info_index, data_accounter, remote_address), id_(id) {
+    : constructor_(config, handler_info_index, data_accounter, remote_address, std::move(arena_pool)), id_(id) {
     constructor_.SetHttpMajor(2);
     constructor_.SetHttpMinor(0);
     nghttp2_provider_.read_callback = NgHttp2ReadCallback;
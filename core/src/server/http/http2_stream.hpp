@@ -24,6 +24,7 @@ public:
         const HandlerInfoIndex& handler_info_index,
         request::ResponseDataAccounter& data_accounter,
         engine::io::Sockaddr remote_address,
+        std::shared_ptr<impl::RequestArenaPool> arena_pool,
         Id id
     );
 
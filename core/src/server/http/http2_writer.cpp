@@ -102,6 +102,10 @@ public:
 
     void WriteHttpResponse() {
         auto data = response_.ExtractData();
+        if (data.empty() && response_.body_file_) {
+            // nghttp2 frames the data itself, so there is no way to sendfile(2) it
+            data = response_.ReadBodyFile();
+        }
 
         auto headers = GetHeaders();
         const bool is_body_forbidden = IsBodyForbiddenForStatus(response_.status_);
@@ -67,8 +67,15 @@ const std::vector<std::string> kEmptyVector{};
 
 namespace server::http {
 
-HttpRequest::HttpRequest(request::ResponseDataAccounter& data_accounter, utils::impl::InternalTag)
-    : pimpl_(*this, data_accounter) {}
+HttpRequest::HttpRequest(request::ResponseDataAccounter& data_accounter, utils::impl::InternalTag tag)
+    : HttpRequest(data_accounter, nullptr, tag) {}
+
+HttpRequest::HttpRequest(
+    request::ResponseDataAccounter& data_accounter,
+    std::shared_ptr<impl::RequestArenaPool> arena_pool,
+    utils::impl::InternalTag
+)
+    : pimpl_(*this, data_accounter, std::move(arena_pool)) {}
 
 HttpRequest::~HttpRequest() = default;
 
@@ -178,36 +185,41 @@ bool HttpRequest::HasPathArg(size_t index) const { return index < PathArgCount()
 size_t HttpRequest::PathArgCount() const { return pimpl_->path_args_.size(); }
 
 const std::string& HttpRequest::GetHeader(std::string_view header_name) const {
-    auto it = pimpl_->headers_.find(header_name);
-    if (it == pimpl_->headers_.end()) return kEmptyString;
-    return it->second;
+    const auto* value = pimpl_->FindHeader(header_name);
+    return value ? *value : kEmptyString;
 }
 
 const std::string& HttpRequest::GetHeader(const USERVER_NAMESPACE::http::headers::PredefinedHeader& header_name) const {
-    auto it = pimpl_->headers_.find(header_name);
-    if (it == pimpl_->headers_.end()) return kEmptyString;
-    return it->second;
+    const auto* value = pimpl_->FindHeader(header_name);
+    return value ? *value : kEmptyString;
 }
 
-bool HttpRequest::HasHeader(std::string_view header_name) const { return pimpl_->headers_.count(header_name) != 0; }
+bool HttpRequest::HasHeader(std::string_view header_name) const { return pimpl_->HasHeader(header_name); }
 
 bool HttpRequest::HasHeader(const USERVER_NAMESPACE::http::headers::PredefinedHeader& header_name) const {
-    return pimpl_->headers_.count(header_name) != 0;
+    return pimpl_->HasHeader(header_name);
 }
 
-size_t HttpRequest::HeaderCount() const { return pimpl_->headers_.size(); }
+size_t HttpRequest::HeaderCount() const {
+    pimpl_->MoveRawHeaders();
+    return pimpl_->headers_.size();
+}
 
-void HttpRequest::RemoveHeader(std::string_view header_name) { pimpl_->headers_.erase(header_name); }
+void HttpRequest::RemoveHeader(std::string_view header_name) { pimpl_->RemoveHeader(header_name); }
 
 void HttpRequest::RemoveHeader(const USERVER_NAMESPACE::http::headers::PredefinedHeader& header_name) {
-    pimpl_->headers_.erase(header_name);
+    pimpl_->RemoveHeader(header_name);
 }
 
 HttpRequest::HeadersMapKeys HttpRequest::GetHeaderNames() const {
+    pimpl_->MoveRawHeaders();
     return HttpRequest::HeadersMapKeys{pimpl_->headers_};
 }
 
-const HttpRequest::HeadersMap& HttpRequest::GetHeaders() const { return pimpl_->headers_; }
+const HttpRequest::HeadersMap& HttpRequest::GetHeaders() const {
+    pimpl_->MoveRawHeaders();
+    return pimpl_->headers_;
+}
 
 const std::string& HttpRequest::GetCookie(const std::string& cookie_name) const {
     auto it = pimpl_->cookies_.find(cookie_name);
@@ -261,6 +273,8 @@ HttpResponse& HttpRequest::GetHttpResponse() const { return pimpl_->response_; }
 
 std::chrono::steady_clock::time_point HttpRequest::GetStartTime() const { return pimpl_->start_time_; }
 
+utils::Arena& HttpRequest::GetArena() const { return pimpl_->arena_holder_.arena; }
+
 bool HttpRequest::IsUpgradeWebsocket() const { return static_cast<bool>(pimpl_->upgrade_websocket_cb_); }
 
 void HttpRequest::SetUpgradeWebsocket(UpgradeCallback cb) const { pimpl_->upgrade_websocket_cb_ = std::move(cb); }
@@ -294,6 +308,7 @@ void HttpRequest::AccountResponseTime() {
 void HttpRequest::MarkAsInternalServerError() const {
     // TODO : refactor, this being here is a bit ridiculous
     pimpl_->response_.SetStatus(http::HttpStatus::kInternalServerError);
+    pimpl_->response_.SetBodyChain({});
     pimpl_->response_.SetData({});
     pimpl_->response_.ClearHeaders();
 }
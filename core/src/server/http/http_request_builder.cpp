@@ -20,7 +20,13 @@ request::ResponseDataAccounter default_data_accounter;
 }  // namespace
 
 HttpRequestBuilder::HttpRequestBuilder(request::ResponseDataAccounter& data_accounter)
-    : request_(std::make_shared<HttpRequest>(data_accounter, utils::impl::InternalTag{})) {}
+    : HttpRequestBuilder(data_accounter, nullptr) {}
+
+HttpRequestBuilder::HttpRequestBuilder(
+    request::ResponseDataAccounter& data_accounter,
+    std::shared_ptr<impl::RequestArenaPool> arena_pool
+)
+    : request_(std::make_shared<HttpRequest>(data_accounter, std::move(arena_pool), utils::impl::InternalTag{})) {}
 
 HttpRequestBuilder::HttpRequestBuilder() : HttpRequestBuilder(default_data_accounter) {}
 
@@ -54,6 +60,11 @@ HttpRequestBuilder& HttpRequestBuilder::AddHeader(std::string&& header, std::str
     return *this;
 }
 
+HttpRequestBuilder& HttpRequestBuilder::AddRawHeader(std::string_view header, std::string_view value) {
+    request_->pimpl_->AddRawHeader(header, value);
+    return *this;
+}
+
 HttpRequestBuilder& HttpRequestBuilder::AddRequestArg(std::string&& key, std::string&& value) {
     request_->pimpl_->request_args_[std::move(key)].push_back(std::move(value));
     return *this;
@@ -12,6 +12,7 @@
 #include <userver/utils/exception.hpp>
 
 #include "multipart_form_data_parser.hpp"
+#include "raw_headers.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -46,9 +47,10 @@ HttpRequestConstructor::HttpRequestConstructor(
     Config config,
     const HandlerInfoIndex& handler_info_index,
     request::ResponseDataAccounter& data_accounter,
-    engine::io::Sockaddr remote_address
+    engine::io::Sockaddr remote_address,
+    std::shared_ptr<impl::RequestArenaPool> arena_pool
 )
-    : config_(config), handler_info_index_(handler_info_index), builder_(data_accounter) {
+    : config_(config), handler_info_index_(handler_info_index), builder_(data_accounter, std::move(arena_pool)) {
     builder_.SetRemoteAddress(std::move(remote_address));
 }
 
@@ -232,6 +234,19 @@ void HttpRequestConstructor::ParseArgs(const char* data, size_t size) {
 void HttpRequestConstructor::AddHeader() {
     UASSERT(header_field_flag_);
 
+    if (config_.copy_headers_on_access) {
+        if (headers_count_ == impl::RawHeaders::kMaxSize) {
+            SetStatus(Status::kHeadersTooLarge);
+            utils::LogErrorAndThrow(fmt::format("Request has too many headers, already contains {}", headers_count_));
+        }
+        // Accumulators keep their capacity for the next headers
+        builder_.AddRawHeader(header_field_, header_value_);
+        ++headers_count_;
+        header_field_.clear();
+        header_value_.clear();
+        return;
+    }
+
     try {
         builder_.AddHeader(std::move(header_field_), std::move(header_value_));
     } catch (const USERVER_NAMESPACE::http::headers::HeaderMap::TooManyHeadersException&) {
@@ -36,7 +36,8 @@ public:
         Config config,
         const HandlerInfoIndex& handler_info_index,
         request::ResponseDataAccounter& data_accounter,
-        engine::io::Sockaddr remote_address
+        engine::io::Sockaddr remote_address,
+        std::shared_ptr<impl::RequestArenaPool> arena_pool = {}
     );
 
     ~HttpRequestConstructor();
@@ -90,6 +91,7 @@ private:
     size_t request_size_ = 0;
     size_t url_size_ = 0;
     size_t headers_size_ = 0;
+    size_t headers_count_ = 0;
     bool url_parsed_ = false;
     Status status_ = Status::kOk;
 
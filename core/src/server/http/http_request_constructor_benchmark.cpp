@@ -15,7 +15,31 @@ void http_request_constructor_url_decode(benchmark::State& state) {
 
     for ([[maybe_unused]] auto _ : state) benchmark::DoNotOptimize(USERVER_NAMESPACE::http::parser::UrlDecode(input));
 }
+
+void http_request_constructor_url_decode_escaped(benchmark::State& state) {
+    std::string tmp = "text+with%20some%2Fescapes";
+    std::string input;
+
+    for (int64_t i = 0; i < state.range(0); i++) input += tmp;
+
+    for ([[maybe_unused]] auto _ : state) benchmark::DoNotOptimize(USERVER_NAMESPACE::http::parser::UrlDecode(input));
+}
+
+void http_request_constructor_parse_args(benchmark::State& state) {
+    std::string input = "first=1";
+
+    for (int64_t i = 0; i < state.range(0); i++) input += "&name" + std::to_string(i) + "=some%20value";
+
+    for ([[maybe_unused]] auto _ : state) {
+        USERVER_NAMESPACE::http::parser::ParseAndConsumeArgs(input, [](std::string&& key, std::string&& value) {
+            benchmark::DoNotOptimize(key);
+            benchmark::DoNotOptimize(value);
+        });
+    }
+}
 }  // namespace
 BENCHMARK(http_request_constructor_url_decode)->RangeMultiplier(2)->Range(1, 1024);
+BENCHMARK(http_request_constructor_url_decode_escaped)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(http_request_constructor_parse_args)->RangeMultiplier(4)->Range(1, 256);
 
 USERVER_NAMESPACE_END
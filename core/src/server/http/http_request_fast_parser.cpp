@@ -0,0 +1,152 @@
+#include <server/http/http_request_fast_parser.hpp>
+
+#include <array>
+#include <cstdint>
+
+#include <userver/utils/str_icase.hpp>
+
+#include <utils/impl/simd_find.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+namespace {
+
+struct MethodToken final {
+    std::string_view token;
+    HttpMethod method;
+};
+
+// With the trailing space, most frequent first
+constexpr std::array kMethods{
+    MethodToken{"GET ", HttpMethod::kGet},
+    MethodToken{"POST ", HttpMethod::kPost},
+    MethodToken{"PUT ", HttpMethod::kPut},
+    MethodToken{"DELETE ", HttpMethod::kDelete},
+    MethodToken{"PATCH ", HttpMethod::kPatch},
+    MethodToken{"HEAD ", HttpMethod::kHead},
+    MethodToken{"OPTIONS ", HttpMethod::kOptions},
+};
+
+constexpr std::string_view kHttp11 = " HTTP/1.1\r\n";
+
+constexpr std::uint64_t kMaxContentLengthDigits = 18;
+
+enum CharClass : std::uint8_t {
+    kTokenChar = 1 << 0,
+    kUrlChar = 1 << 1,
+};
+
+constexpr auto kCharClasses = [] {
+    std::array<std::uint8_t, 256> classes{};
+    for (int c = '0'; c <= '9'; ++c) classes[c] |= kTokenChar | kUrlChar;
+    for (int c = 'a'; c <= 'z'; ++c) classes[c] |= kTokenChar | kUrlChar;
+    for (int c = 'A'; c <= 'Z'; ++c) classes[c] |= kTokenChar | kUrlChar;
+    for (unsigned char c : std::string_view{"!#$%&'*+-.^_`|~"}) classes[c] |= kTokenChar;
+    // Origin form of the request target without fragments and IP literals,
+    // the full parser deals with the rest
+    for (unsigned char c : std::string_view{"-._~:/?@!$&'()*+,;=%"}) classes[c] |= kUrlChar;
+    return classes;
+}();
+
+bool Is(char c, CharClass char_class) noexcept {
+    return kCharClasses[static_cast<unsigned char>(c)] & char_class;
+}
+
+bool IsOws(char c) noexcept { return c == ' ' || c == '\t'; }
+
+bool ParseContentLength(std::string_view value, std::size_t& content_length) noexcept {
+    if (value.empty() || value.size() > kMaxContentLengthDigits) return false;
+
+    std::size_t result = 0;
+    for (const char c : value) {
+        if (c < '0' || c > '9') return false;
+        result = result * 10 + (c - '0');
+    }
+    content_length = result;
+    return true;
+}
+
+}  // namespace
+
+bool TryParseRequestFast(std::string_view data, FastParsedRequest& request) {
+    const char* ptr = data.data();
+    const char* const end = data.data() + data.size();
+
+    request.method = HttpMethod::kUnknown;
+    for (const auto& [token, method] : kMethods) {
+        if (data.substr(0, token.size()) == token) {
+            request.method = method;
+            ptr += token.size();
+            break;
+        }
+    }
+    if (request.method == HttpMethod::kUnknown) return false;
+
+    const char* const url_end = utils::impl::FindFirstOf<' ', '\r', '\n'>(ptr, end);
+    if (url_end == ptr || url_end == end || *url_end != ' ') return false;
+    for (const char* url_ptr = ptr; url_ptr != url_end; ++url_ptr) {
+        if (!Is(*url_ptr, kUrlChar)) return false;
+    }
+    request.url = std::string_view(ptr, url_end - ptr);
+    ptr = url_end;
+
+    if (static_cast<std::size_t>(end - ptr) < kHttp11.size() || std::string_view(ptr, kHttp11.size()) != kHttp11) {
+        return false;
+    }
+    ptr += kHttp11.size();
+
+    request.headers.clear();
+    bool has_content_length = false;
+    std::size_t content_length = 0;
+    while (true) {
+        if (end - ptr < 2) return false;
+        if (*ptr == '\r') {
+            if (ptr[1] != '\n') return false;
+            ptr += 2;
+            break;
+        }
+
+        const char* const name_begin = ptr;
+        while (ptr != end && Is(*ptr, kTokenChar)) ++ptr;
+        if (ptr == name_begin || ptr == end || *ptr != ':') return false;
+        const std::string_view name(name_begin, ptr - name_begin);
+        ++ptr;
+
+        while (ptr != end && IsOws(*ptr)) ++ptr;
+        const char* const value_begin = ptr;
+        const char* value_end = utils::impl::FindFirstNonPrintable(ptr, end);
+        while (value_end != end && *value_end == '\t') {
+            value_end = utils::impl::FindFirstNonPrintable(value_end + 1, end);
+        }
+        if (end - value_end < 2 || value_end[0] != '\r' || value_end[1] != '\n') return false;
+        // Leave the trimming rules and empty values to the full parser
+        if (value_end == value_begin || IsOws(value_end[-1])) return false;
+        const std::string_view value(value_begin, value_end - value_begin);
+        ptr = value_end + 2;
+
+        if (utils::StrIcaseEqual{}(name, "content-length")) {
+            if (has_content_length || !ParseContentLength(value, content_length)) return false;
+            has_content_length = true;
+        } else if (utils::StrIcaseEqual{}(name, "transfer-encoding") || utils::StrIcaseEqual{}(name, "upgrade")) {
+            return false;
+        } else if (utils::StrIcaseEqual{}(name, "connection") && !utils::StrIcaseEqual{}(value, "keep-alive")) {
+            return false;
+        }
+
+        if (request.headers.size() == kFastParserMaxHeaders) return false;
+        request.headers.push_back(FastParsedHeader{name, value});
+    }
+
+    if (static_cast<std::size_t>(end - ptr) < content_length) return false;
+    request.body = std::string_view(ptr, content_length);
+    ptr += content_length;
+
+    request.size = ptr - data.data();
+    return true;
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
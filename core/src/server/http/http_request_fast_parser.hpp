@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <userver/server/http/http_method.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+struct FastParsedHeader final {
+    std::string_view name;
+    std::string_view value;
+};
+
+/// Views into the input buffer of a request parsed by TryParseRequestFast()
+struct FastParsedRequest final {
+    HttpMethod method{HttpMethod::kUnknown};
+    std::string_view url;
+    // capacity is reused between the requests
+    std::vector<FastParsedHeader> headers;
+    std::string_view body;
+    // number of bytes of the input buffer taken by the request
+    std::size_t size{0};
+};
+
+inline constexpr std::size_t kFastParserMaxHeaders = 64;
+
+/// @brief Parses a complete HTTP/1.1 keep-alive request of the common shape
+/// from the beginning of `data` in a single vectorized pass.
+///
+/// Returns `false` if the request is incomplete or has anything the fast path
+/// does not handle: other HTTP versions, unusual methods or characters,
+/// Transfer-Encoding, Upgrade, `Connection` other than `keep-alive`, empty
+/// header values or trailing whitespace in them, more than
+/// kFastParserMaxHeaders headers, a partial body. The full parser must be used
+/// in that case. Every request accepted by the fast path is also accepted by
+/// the full parser with the same result.
+bool TryParseRequestFast(std::string_view data, FastParsedRequest& request);
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,169 @@
+#include <server/http/http_request_fast_parser.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <server/http/http_request_parser.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::HttpMethod;
+using server::http::impl::FastParsedRequest;
+using server::http::impl::TryParseRequestFast;
+
+constexpr std::string_view kPipelinedRequests =
+    "GET /first?a=1&b=%20x HTTP/1.1\r\n"
+    "Host: localhost:11235\r\nUser-Agent: curl/7.58.0\r\nAccept: */*\r\n\r\n"
+    "POST /second HTTP/1.1\r\n"
+    "Host:localhost\r\nContent-Type: application/json\r\nContent-Length: 18\r\n\r\n"
+    "{\"hello\": \"world\"}"
+    "GET /third HTTP/1.0\r\n"
+    "Connection: keep-alive\r\nX-Header: \t value\twith\ttabs\r\n\r\n"
+    "DELETE /fourth HTTP/1.1\r\n"
+    "Transfer-Encoding: chunked\r\n\r\n"
+    "4\r\nbody\r\n0\r\n\r\n"
+    "PUT /fifth HTTP/1.1\r\n"
+    "Content-Length: 0\r\nConnection: close\r\n\r\n";
+
+struct ParsedRequest {
+    HttpMethod method;
+    std::string url;
+    std::vector<std::pair<std::string, std::string>> headers;
+    std::string body;
+    bool is_final;
+
+    bool operator==(const ParsedRequest& other) const {
+        return method == other.method && url == other.url && headers == other.headers && body == other.body &&
+               is_final == other.is_final;
+    }
+};
+
+std::vector<ParsedRequest> ParseWithChunks(std::string_view data, std::size_t chunk_size, bool fast_path_enabled) {
+    static const server::http::HandlerInfoIndex kTestHandlerInfoIndex;
+    server::request::HttpRequestConfig config;
+    config.testing_mode = true;
+    config.http1_fast_path_enabled = fast_path_enabled;
+    static server::net::ParserStats test_stats;
+    static server::request::ResponseDataAccounter test_accounter;
+
+    std::vector<ParsedRequest> result;
+    server::http::HttpRequestParser parser(
+        kTestHandlerInfoIndex,
+        config,
+        [&result](std::shared_ptr<server::http::HttpRequest>&& request) {
+            ParsedRequest parsed{
+                request->GetMethod(), request->GetUrl(), {}, request->RequestBody(), request->IsFinal()};
+            for (const auto& name : request->GetHeaderNames()) {
+                parsed.headers.emplace_back(name, request->GetHeader(name));
+            }
+            std::sort(parsed.headers.begin(), parsed.headers.end());
+            result.push_back(std::move(parsed));
+        },
+        test_stats,
+        test_accounter,
+        engine::io::Sockaddr{}
+    );
+
+    for (std::size_t pos = 0; pos < data.size(); pos += chunk_size) {
+        EXPECT_TRUE(parser.Parse(data.substr(pos, chunk_size)));
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(HttpRequestFastParser, Simple) {
+    FastParsedRequest request;
+    constexpr std::string_view kData =
+        "POST /hello?arg=value HTTP/1.1\r\n"
+        "Host: localhost:11235\r\nUser-Agent:curl/7.58.0\r\nContent-Length: 4\r\n\r\n"
+        "bodyGET / HTTP/1.1\r\n\r\n";
+    ASSERT_TRUE(TryParseRequestFast(kData, request));
+
+    EXPECT_EQ(request.method, HttpMethod::kPost);
+    EXPECT_EQ(request.url, "/hello?arg=value");
+    ASSERT_EQ(request.headers.size(), 3);
+    EXPECT_EQ(request.headers[0].name, "Host");
+    EXPECT_EQ(request.headers[0].value, "localhost:11235");
+    EXPECT_EQ(request.headers[1].name, "User-Agent");
+    EXPECT_EQ(request.headers[1].value, "curl/7.58.0");
+    EXPECT_EQ(request.headers[2].name, "Content-Length");
+    EXPECT_EQ(request.headers[2].value, "4");
+    EXPECT_EQ(request.body, "body");
+    EXPECT_EQ(kData.substr(request.size), "GET / HTTP/1.1\r\n\r\n");
+
+    ASSERT_TRUE(TryParseRequestFast(kData.substr(request.size), request));
+    EXPECT_EQ(request.method, HttpMethod::kGet);
+    EXPECT_EQ(request.url, "/");
+    EXPECT_TRUE(request.headers.empty());
+    EXPECT_TRUE(request.body.empty());
+}
+
+TEST(HttpRequestFastParser, Incomplete) {
+    constexpr std::string_view kData =
+        "POST /hello HTTP/1.1\r\n"
+        "Host: localhost\r\nContent-Length: 4\r\n\r\n"
+        "body";
+
+    FastParsedRequest request;
+    for (std::size_t size = 0; size < kData.size(); ++size) {
+        EXPECT_FALSE(TryParseRequestFast(kData.substr(0, size), request)) << size;
+    }
+    EXPECT_TRUE(TryParseRequestFast(kData, request));
+}
+
+TEST(HttpRequestFastParser, Fallback) {
+    FastParsedRequest request;
+    const std::string_view kFallbackRequests[] = {
+        "CONNECT example.org:443 HTTP/1.1\r\n\r\n",
+        "get / HTTP/1.1\r\n\r\n",
+        "GET / HTTP/1.0\r\n\r\n",
+        "GET / HTTP/2.0\r\n\r\n",
+        "GET /a#fragment HTTP/1.1\r\n\r\n",
+        "GET /\xd0\xb0 HTTP/1.1\r\n\r\n",
+        "GET / HTTP/1.1\n\n",
+        "GET / HTTP/1.1\r\nHost : localhost\r\n\r\n",
+        "GET / HTTP/1.1\r\nHost: local\xd0\xb0\r\n\r\n",
+        "GET / HTTP/1.1\r\nHost: localhost \r\n\r\n",
+        "GET / HTTP/1.1\r\nHost:\r\n\r\n",
+        "GET / HTTP/1.1\r\nX-Folded: a\r\n b\r\n\r\n",
+        "GET / HTTP/1.1\r\nHost: localhost\n\r\n",
+        "GET / HTTP/1.1\r\nConnection: close\r\n\r\n",
+        "GET / HTTP/1.1\r\nConnection: Upgrade\r\nUpgrade: websocket\r\n\r\n",
+        "POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n0\r\n\r\n",
+        "POST / HTTP/1.1\r\nContent-Length: 1\r\nContent-Length: 1\r\n\r\na",
+        "POST / HTTP/1.1\r\nContent-Length: +1\r\n\r\na",
+        "POST / HTTP/1.1\r\nContent-Length: 99999999999999999999\r\n\r\na",
+    };
+    for (const auto data : kFallbackRequests) {
+        EXPECT_FALSE(TryParseRequestFast(data, request)) << data;
+    }
+
+    std::string many_headers = "GET / HTTP/1.1\r\n";
+    for (std::size_t i = 0; i <= server::http::impl::kFastParserMaxHeaders; ++i) {
+        many_headers += fmt::format("header{}: value\r\n", i);
+    }
+    many_headers += "\r\n";
+    EXPECT_FALSE(TryParseRequestFast(many_headers, request));
+}
+
+UTEST(HttpRequestFastParser, SameAsFullParser) {
+    const auto expected = ParseWithChunks(kPipelinedRequests, kPipelinedRequests.size(), false);
+    ASSERT_EQ(expected.size(), 5);
+    EXPECT_EQ(expected[1].body, "{\"hello\": \"world\"}");
+    EXPECT_FALSE(expected[3].is_final);
+    EXPECT_TRUE(expected[4].is_final);
+
+    for (std::size_t chunk_size = 1; chunk_size <= kPipelinedRequests.size(); ++chunk_size) {
+        EXPECT_EQ(ParseWithChunks(kPipelinedRequests, chunk_size, true), expected) << chunk_size;
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,14 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 #include <userver/server/http/http_request.hpp>
+#include <userver/utils/arena.hpp>
+
+#include <server/http/raw_headers.hpp>
+#include <server/http/request_arena_pool.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -12,20 +20,127 @@ constexpr size_t kBucketCount = 16;
 
 constexpr size_t kZeroAllocationBucketCount = 0;
 
+// Returns the arena to the connection pool after all the containers that use
+// it are destroyed
+struct RequestArenaHolder final {
+    explicit RequestArenaHolder(std::shared_ptr<RequestArenaPool> arena_pool)
+        : pool(std::move(arena_pool)), arena(pool ? pool->Acquire() : utils::Arena{}) {}
+
+    RequestArenaHolder(RequestArenaHolder&&) = delete;
+    RequestArenaHolder& operator=(RequestArenaHolder&&) = delete;
+
+    ~RequestArenaHolder() {
+        if (pool) pool->Release(std::move(arena));
+    }
+
+    std::shared_ptr<RequestArenaPool> pool;
+    utils::Arena arena;
+};
+
+template <typename T>
+using ArenaAllocator = utils::ArenaAllocator<T>;
+
+using RequestArgs = utils::impl::TransparentMap<
+    std::string,
+    std::vector<std::string>,
+    utils::StrCaseHash,
+    std::equal_to<>,
+    ArenaAllocator<std::pair<const std::string, std::vector<std::string>>>>;
+
+using PathArgs = std::vector<std::string, ArenaAllocator<std::string>>;
+
+using PathArgsByNameIndex = utils::impl::TransparentMap<
+    std::string,
+    size_t,
+    utils::StrCaseHash,
+    std::equal_to<>,
+    ArenaAllocator<std::pair<const std::string, size_t>>>;
+
 }  // namespace impl
 
 struct HttpRequest::Impl {
     // Use hash_function() magic to pass out the same RNG seed among all
     // unordered_maps because we don't need different seeds and want to avoid its
     // overhead.
-    Impl(HttpRequest& http_request, request::ResponseDataAccounter& data_accounter)
-        : start_time_(std::chrono::steady_clock::now()),
+    Impl(
+        HttpRequest& http_request,
+        request::ResponseDataAccounter& data_accounter,
+        std::shared_ptr<impl::RequestArenaPool> arena_pool
+    )
+        : arena_holder_(std::move(arena_pool)),
+          start_time_(std::chrono::steady_clock::now()),
+          request_args_(
+              impl::kZeroAllocationBucketCount,
+              utils::StrCaseHash{},
+              std::equal_to<>{},
+              impl::RequestArgs::allocator_type{arena_holder_.arena}
+          ),
           form_data_args_(impl::kZeroAllocationBucketCount, request_args_.hash_function()),
-          path_args_by_name_index_(impl::kZeroAllocationBucketCount, request_args_.hash_function()),
+          path_args_(impl::PathArgs::allocator_type{arena_holder_.arena}),
+          path_args_by_name_index_(
+              impl::kZeroAllocationBucketCount,
+              request_args_.hash_function(),
+              std::equal_to<>{},
+              impl::PathArgsByNameIndex::allocator_type{arena_holder_.arena}
+          ),
           headers_(impl::kBucketCount),
+          raw_headers_(arena_holder_.arena),
           cookies_(impl::kZeroAllocationBucketCount, request_args_.hash_function()),
           response_(http_request, data_accounter, start_time_, cookies_.hash_function()) {}
 
+    void AddRawHeader(std::string_view name, std::string_view value) {
+        raw_headers_.Add(name, value);
+        has_raw_headers_.store(true, std::memory_order_relaxed);
+    }
+
+    // Copies the header from raw_headers_ on the first access. Capacity of
+    // headers_ is reserved for all the raw headers at once, so that the
+    // references to the values returned earlier stay valid.
+    //
+    // Const accessors may be called concurrently, so the moves are done under
+    // raw_headers_mutex_. Once everything is moved headers_ is not modified
+    // by const accessors anymore and is read without the lock.
+    template <typename Name>
+    const std::string* FindHeader(const Name& name) const {
+        if (!has_raw_headers_.load(std::memory_order_acquire)) return FindMovedHeader(name);
+
+        const std::lock_guard lock{raw_headers_mutex_};
+        if (const auto* value = FindMovedHeader(name)) return value;
+        if (!raw_headers_.Size()) return nullptr;
+
+        headers_.reserve(headers_.size() + raw_headers_.Size());
+        const bool moved = raw_headers_.MoveTo(name, headers_);
+        UpdateHasRawHeaders();
+        return moved ? FindMovedHeader(name) : nullptr;
+    }
+
+    template <typename Name>
+    bool HasHeader(const Name& name) const {
+        if (!has_raw_headers_.load(std::memory_order_acquire)) return headers_.count(name) != 0;
+
+        const std::lock_guard lock{raw_headers_mutex_};
+        return headers_.count(name) != 0 || raw_headers_.Contains(name);
+    }
+
+    void MoveRawHeaders() const {
+        if (!has_raw_headers_.load(std::memory_order_acquire)) return;
+
+        const std::lock_guard lock{raw_headers_mutex_};
+        headers_.reserve(headers_.size() + raw_headers_.Size());
+        raw_headers_.MoveAllTo(headers_);
+        UpdateHasRawHeaders();
+    }
+
+    template <typename Name>
+    void RemoveHeader(const Name& name) {
+        raw_headers_.Remove(name);
+        headers_.erase(name);
+        UpdateHasRawHeaders();
+    }
+
+    // Must be declared first, the containers below allocate from the arena
+    mutable impl::RequestArenaHolder arena_holder_;
+
     std::chrono::steady_clock::time_point start_time_;
     std::chrono::steady_clock::time_point task_create_time_;
     std::chrono::steady_clock::time_point task_start_time_;
@@ -39,11 +154,15 @@ struct HttpRequest::Impl {
     std::string url_;
     std::string request_path_;
     std::string request_body_;
-    utils::impl::TransparentMap<std::string, std::vector<std::string>, utils::StrCaseHash> request_args_;
+    impl::RequestArgs request_args_;
     utils::impl::TransparentMap<std::string, std::vector<FormDataArg>, utils::StrCaseHash> form_data_args_;
-    std::vector<std::string> path_args_;
-    utils::impl::TransparentMap<std::string, size_t, utils::StrCaseHash> path_args_by_name_index_;
-    HeadersMap headers_;
+    impl::PathArgs path_args_;
+    impl::PathArgsByNameIndex path_args_by_name_index_;
+    mutable HeadersMap headers_;
+    // Headers added with HttpRequestBuilder::AddRawHeader() and not accessed yet
+    mutable impl::RawHeaders raw_headers_;
+    mutable std::mutex raw_headers_mutex_;
+    mutable std::atomic<bool> has_raw_headers_{false};
     CookiesMap cookies_;
     bool is_final_{false};
 #ifndef NDEBUG
@@ -57,6 +176,15 @@ struct HttpRequest::Impl {
     engine::TaskProcessor* task_processor_{nullptr};
     const handlers::HttpHandlerBase* handler_{nullptr};
     handlers::HttpRequestStatistics* request_statistics_{nullptr};
+
+private:
+    template <typename Name>
+    const std::string* FindMovedHeader(const Name& name) const {
+        const auto it = headers_.find(name);
+        return it == headers_.end() ? nullptr : &it->second;
+    }
+
+    void UpdateHasRawHeaders() const { has_raw_headers_.store(raw_headers_.Size() != 0, std::memory_order_release); }
 };
 
 }  // namespace server::http
@@ -1,5 +1,7 @@
 #include "http_request_parser.hpp"
 
+#include <server/http/request_arena_pool.hpp>
+
 #include <userver/logging/log.hpp>
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -94,12 +96,24 @@ HttpRequestParser::HttpRequestParser(
       on_new_request_cb_(std::move(on_new_request_cb)),
       stats_(stats),
       data_accounter_(data_accounter),
-      remote_address_(std::move(remote_address)) {
+      remote_address_(std::move(remote_address)),
+      arena_pool_(std::make_shared<impl::RequestArenaPool>()) {
     llhttp_init(&parser_, HTTP_REQUEST, &parser_settings);
     parser_.data = this;
 }
 
 bool HttpRequestParser::Parse(std::string_view req) {
+    // Complete requests of the common shape skip the byte-by-byte state
+    // machine of llhttp. The fast path is only taken between the messages,
+    // when llhttp holds no partial request.
+    if (request_constructor_config_.http1_fast_path_enabled) {
+        while (!request_constructor_ && impl::TryParseRequestFast(req, fast_parsed_request_)) {
+            if (!ProcessFastParsedRequest()) return false;
+            req.remove_prefix(fast_parsed_request_.size);
+        }
+        if (req.empty()) return true;
+    }
+
     const auto err = llhttp_execute(&parser_, req.data(), req.size());
     if (parser_.upgrade && err == HPE_PAUSED_UPGRADE) {
         FinalizeRequest();
@@ -241,9 +255,38 @@ int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
     return 0;
 }
 
+bool HttpRequestParser::ProcessFastParsedRequest() {
+    CreateRequestConstructor();
+    const auto& request = fast_parsed_request_;
+    try {
+        request_constructor_->SetMethod(request.method);
+        request_constructor_->AppendUrl(request.url.data(), request.url.size());
+        request_constructor_->SetHttpMajor(1);
+        request_constructor_->SetHttpMinor(1);
+        url_complete_ = true;
+        request_constructor_->ParseUrl();
+
+        for (const auto& header : request.headers) {
+            request_constructor_->AppendHeaderField(header.name.data(), header.name.size());
+            request_constructor_->AppendHeaderValue(header.value.data(), header.value.size());
+        }
+        request_constructor_->AppendHeaderField("", 0);
+
+        if (!request.body.empty()) request_constructor_->AppendBody(request.body.data(), request.body.size());
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "can't process request: " << ex;
+        FinalizeRequest();
+        return false;
+    }
+    request_constructor_->SetIsFinal(false);
+    return FinalizeRequest();
+}
+
 void HttpRequestParser::CreateRequestConstructor() {
     stats_.parsing_request_count.Add(1);
-    request_constructor_.emplace(request_constructor_config_, handler_info_index_, data_accounter_, remote_address_);
+    request_constructor_.emplace(
+        request_constructor_config_, handler_info_index_, data_accounter_, remote_address_, arena_pool_
+    );
     url_complete_ = false;
 }
 
@@ -7,6 +7,7 @@
 
 #include <llhttp.h>
 
+#include <server/http/http_request_fast_parser.hpp>
 #include <server/net/stats.hpp>
 #include <server/request/request_parser.hpp>
 #include <userver/engine/io/sockaddr.hpp>
@@ -54,6 +55,8 @@ private:
     int OnBodyImpl(llhttp_t* p, const char* data, size_t size);
     int OnMessageCompleteImpl(llhttp_t* p);
 
+    bool ProcessFastParsedRequest();
+
     void CreateRequestConstructor();
 
     bool CheckUrlComplete(llhttp_t* p);
@@ -69,12 +72,14 @@ private:
     OnNewRequestCb on_new_request_cb_;
 
     llhttp_t parser_{};
+    impl::FastParsedRequest fast_parsed_request_;
     std::optional<HttpRequestConstructor> request_constructor_;
 
     static const llhttp_settings_t parser_settings;
     net::ParserStats& stats_;
     request::ResponseDataAccounter& data_accounter_;
     engine::io::Sockaddr remote_address_;
+    std::shared_ptr<impl::RequestArenaPool> arena_pool_;
 };
 
 }  // namespace server::http
@@ -1,12 +1,16 @@
 #include <userver/server/http/http_response.hpp>
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 #include <cctz/time_zone.h>
 #include <fmt/compile.h>
 
+#include <userver/engine/async.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/content_type.hpp>
@@ -19,6 +23,8 @@
 #include <userver/utils/small_string.hpp>
 
 #include <server/http/http_cached_date.hpp>
+#include <server/http/response_body_compressor.hpp>
+#include <server/middlewares/response_compression.hpp>
 
 #include <userver/server/http/http_request.hpp>
 
@@ -88,6 +94,13 @@ void AppendToCharArray(char*& data, const std::string_view what) {
 
 const std::string kEmptyString{};
 
+// Chunk size for sending file bodies via sockets that do not support sendfile
+constexpr std::size_t kFileBodyChunkSize = 64 * 1024;
+
+// Limits the iovec array of a single writev for the body chain, the socket
+// buffer would not take more at once anyway
+constexpr std::size_t kMaxChainChunksPerWrite = 64;
+
 }  // namespace
 
 namespace server::http {
@@ -231,6 +244,18 @@ HttpResponse::CookiesMapKeys HttpResponse::GetCookieNames() const { return HttpR
 
 const Cookie& HttpResponse::GetCookie(std::string_view cookie_name) const { return cookies_.at(cookie_name.data()); }
 
+void HttpResponse::SetBodyFile(
+    fs::blocking::FileDescriptor file,
+    std::size_t offset,
+    std::size_t size,
+    engine::TaskProcessor& fs_task_processor
+) {
+    body_file_ = std::make_unique<fs::blocking::FileDescriptor>(std::move(file));
+    body_file_offset_ = offset;
+    body_file_size_ = size;
+    body_file_task_processor_ = &fs_task_processor;
+}
+
 void HttpResponse::SetHeadersEnd() { headers_end_.Send(); }
 
 bool HttpResponse::WaitForHeadersEnd() { return headers_end_.WaitForEvent(); }
@@ -289,8 +314,12 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
 
     std::size_t sent_bytes{};
 
-    if (IsBodyStreamed() && GetData().empty()) {
+    if (IsBodyStreamed() && IsDataEmpty()) {
         sent_bytes = SetBodyStreamed(socket, header);
+    } else if (body_file_ && IsDataEmpty()) {
+        sent_bytes = SetBodyFromFile(socket, header);
+    } else if (HasBodyChain() && IsDataEmpty()) {
+        sent_bytes = SetBodyFromChain(socket, header);
     } else {
         // e.g. a CustomHandlerException
         sent_bytes = SetBodyNotStreamed(socket, header);
@@ -319,7 +348,19 @@ HttpResponse::SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::
 
     ssize_t sent_bytes = 0;
     if (!is_head_request && !is_body_forbidden) {
-        sent_bytes = socket.WriteAll({{header.data(), header.size()}, {data.data(), data.size()}}, engine::Deadline{});
+        auto* zerocopy_socket = (zerocopy_threshold_ && data.size() >= *zerocopy_threshold_)
+                                    ? dynamic_cast<engine::io::Socket*>(&socket)
+                                    : nullptr;
+        if (zerocopy_socket) {
+            const std::array<engine::io::IoData, 2> list{{{header.data(), header.size()}, {data.data(), data.size()}}};
+            sent_bytes = zerocopy_socket->SendAllZeroCopy(
+                list.data(), list.size(), engine::Deadline::FromDuration(zerocopy_timeout_)
+            );
+            bytes_sent_zero_copy_ += std::min(data.size(), static_cast<std::size_t>(sent_bytes));
+        } else {
+            sent_bytes =
+                socket.WriteAll({{header.data(), header.size()}, {data.data(), data.size()}}, engine::Deadline{});
+        }
     } else {
         sent_bytes = socket.WriteAll(header.data(), header.size(), engine::Deadline{});
     }
@@ -327,6 +368,141 @@ HttpResponse::SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::
     return sent_bytes;
 }
 
+std::size_t
+HttpResponse::SetBodyFromFile(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
+    UASSERT(body_file_);
+    const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
+    const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
+
+    if (!is_body_forbidden) {
+        impl::OutputHeader(
+            header, USERVER_NAMESPACE::http::headers::kContentLength, fmt::format(FMT_COMPILE("{}"), body_file_size_)
+        );
+    }
+    header.append(kCrlf);
+
+    std::size_t sent_bytes = socket.WriteAll(header.data(), header.size(), engine::Deadline{});
+    if (is_head_request || is_body_forbidden) {
+        return sent_bytes;
+    }
+
+    UASSERT(body_file_task_processor_);
+    if (auto* plain_socket = dynamic_cast<engine::io::Socket*>(&socket)) {
+        // sendfile(2) blocks on disk reads if the file data is not in the page
+        // cache, so it is called from the fs task processor. Waiting for the
+        // socket to become writable does not occupy the fs threads.
+        const auto file_bytes_sent = engine::AsyncNoSpan(*body_file_task_processor_, [&] {
+                                         return plain_socket->SendFile(
+                                             body_file_->GetNative(),
+                                             body_file_offset_,
+                                             body_file_size_,
+                                             engine::Deadline{}
+                                         );
+                                     }).Get();
+        bytes_sent_zero_copy_ += file_bytes_sent;
+        sent_bytes += file_bytes_sent;
+        if (file_bytes_sent != body_file_size_) {
+            throw std::runtime_error(fmt::format(
+                "File body was sent partially, {} out of {} bytes, the file was probably truncated",
+                file_bytes_sent,
+                body_file_size_
+            ));
+        }
+        return sent_bytes;
+    }
+
+    // e.g. TLS, the data has to pass through userspace
+    std::string buffer(std::min(body_file_size_, kFileBodyChunkSize), '\0');
+    for (std::size_t left = body_file_size_; left > 0;) {
+        // The chunk is read on the fs task processor, so that a slow disk does
+        // not block the current one
+        const auto read_bytes = engine::AsyncNoSpan(*body_file_task_processor_, [&] {
+                                    body_file_->Seek(body_file_offset_ + body_file_size_ - left);
+                                    return body_file_->Read(buffer.data(), std::min(left, buffer.size()));
+                                }).Get();
+        if (read_bytes == 0) {
+            throw std::runtime_error(fmt::format(
+                "File body was sent partially, {} out of {} bytes, the file was probably truncated",
+                body_file_size_ - left,
+                body_file_size_
+            ));
+        }
+        sent_bytes += socket.WriteAll(buffer.data(), read_bytes, engine::Deadline{});
+        left -= read_bytes;
+    }
+    return sent_bytes;
+}
+
+std::size_t
+HttpResponse::SetBodyFromChain(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
+    const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
+    const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
+    const auto& body_chain = GetBodyChain();
+
+    if (!is_body_forbidden) {
+        impl::OutputHeader(
+            header,
+            USERVER_NAMESPACE::http::headers::kContentLength,
+            fmt::format(FMT_COMPILE("{}"), body_chain.GetSize())
+        );
+    } else {
+        LOG_LIMITED_WARNING() << "Non-empty body provided for response with HTTP code " << static_cast<int>(status_)
+                              << " which does not allow one, it will be dropped";
+    }
+    header.append(kCrlf);
+
+    if (is_head_request || is_body_forbidden) {
+        return socket.WriteAll(header.data(), header.size(), engine::Deadline{});
+    }
+
+    std::vector<engine::io::IoData> list;
+    list.reserve(body_chain.GetChunksCount() + 1);
+    list.push_back({header.data(), header.size()});
+    for (std::size_t i = 0; i < body_chain.GetChunksCount(); ++i) {
+        const auto chunk = body_chain.GetChunk(i);
+        list.push_back({chunk.data(), chunk.size()});
+    }
+
+    std::size_t sent_bytes = 0;
+    auto* plain_socket = dynamic_cast<engine::io::Socket*>(&socket);
+    if (!plain_socket) {
+        // e.g. TLS, that encrypts the data record by record anyway
+        for (const auto& io_data : list) {
+            sent_bytes += socket.WriteAll(io_data.data, io_data.len, engine::Deadline{});
+        }
+        return sent_bytes;
+    }
+
+    for (std::size_t offset = 0; offset < list.size(); offset += kMaxChainChunksPerWrite) {
+        const auto count = std::min(kMaxChainChunksPerWrite, list.size() - offset);
+        std::size_t expected_bytes = 0;
+        for (std::size_t i = offset; i < offset + count; ++i) expected_bytes += list[i].len;
+
+        const auto written = plain_socket->SendAll(list.data() + offset, count, engine::Deadline{});
+        sent_bytes += written;
+        // the connection was closed by peer
+        if (written != expected_bytes) break;
+    }
+    return sent_bytes;
+}
+
+std::string HttpResponse::ReadBodyFile() {
+    UASSERT(body_file_);
+    UASSERT(body_file_task_processor_);
+    return engine::AsyncNoSpan(*body_file_task_processor_, [this] {
+               std::string result(body_file_size_, '\0');
+               body_file_->Seek(body_file_offset_);
+               std::size_t read_total = 0;
+               while (read_total < body_file_size_) {
+                   const auto read_bytes = body_file_->Read(result.data() + read_total, body_file_size_ - read_total);
+                   if (read_bytes == 0) break;
+                   read_total += read_bytes;
+               }
+               result.resize(read_total);
+               return result;
+           }).Get();
+}
+
 std::size_t
 HttpResponse::SetBodyStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
     const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
@@ -398,6 +574,18 @@ void HttpResponse::SetStreamBody() {
 
 bool HttpResponse::IsBodyStreamed() const { return is_stream_body_; }
 
+void HttpResponse::SetBodyStreamCompressor(std::unique_ptr<impl::ResponseBodyCompressor> compressor) {
+    UASSERT(IsBodyStreamed());
+    body_stream_compressor_ = std::move(compressor);
+}
+
+std::unique_ptr<impl::ResponseBodyCompressor> HttpResponse::ExtractBodyStreamCompressor() {
+    auto compressor = std::move(body_stream_compressor_);
+    // The status and the headers are final only now, at the end of headers
+    if (compressor && !middlewares::IsResponseCompressible(request_, *this)) compressor.reset();
+    return compressor;
+}
+
 HttpResponse::Producer HttpResponse::GetBodyProducer() {
     Producer res{};
     std::visit(
@@ -1,8 +1,11 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/overloaded.hpp>
 
+#include <server/http/response_body_compressor.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
@@ -13,7 +16,19 @@ ResponseBodyStream::ResponseBodyStream(
 )
     : queue_producer_(std::move(queue_producer)), http_response_(http_response) {}
 
+ResponseBodyStream::ResponseBodyStream(ResponseBodyStream&&) = default;
+
 ResponseBodyStream::~ResponseBodyStream() {
+    if (compressor_) {
+        try {
+            auto tail = compressor_->Finish();
+            compressor_.reset();
+            PushBodyChunk(std::move(tail), engine::Deadline{});
+        } catch (const std::exception& e) {
+            LOG_WARNING() << "Failed to finish compression of the response body: " << e;
+        }
+    }
+
     if (http_response_.GetStreamId().has_value()) {
         UASSERT(queue_producer_.index() == 2);
         std::get<impl::Http2StreamEventProducer>(queue_producer_).CloseStream(*http_response_.GetStreamId());
@@ -22,6 +37,9 @@ ResponseBodyStream::~ResponseBodyStream() {
 
 void ResponseBodyStream::PushBodyChunk(std::string&& chunk, engine::Deadline deadline) {
     UASSERT_MSG(headers_ended_, "SetEndOfHeaders() was not called before PushBodyChunk()");
+    if (compressor_) {
+        chunk = compressor_->Compress(chunk);
+    }
     std::visit(
         utils::Overloaded{
             [&chunk, &deadline](HttpResponse::Queue::Producer& queue_producer) mutable {
@@ -46,6 +64,13 @@ void ResponseBodyStream::SetHeader(std::string_view name, const std::string& val
 }
 
 void ResponseBodyStream::SetEndOfHeaders() {
+    // Not compressible responses, e.g. with bodiless statuses, get no
+    // compressor, so no trailer is pushed for them on destruction
+    compressor_ = http_response_.ExtractBodyStreamCompressor();
+    if (compressor_) {
+        impl::SetContentCodingHeaders(http_response_, compressor_->GetCoding());
+    }
+
     headers_ended_ = true;
     http_response_.SetHeadersEnd();
 }
@@ -41,6 +41,56 @@ UTEST(HttpResponse, Smoke) {
     EXPECT_EQ(reply.substr(reply.size() - 4 - kBody.size()), fmt::format("\r\n\r\n{}", kBody));
 }
 
+UTEST(HttpResponse, BodyChain) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    server::request::ResponseDataAccounter accounter;
+    auto request = server::http::HttpRequestBuilder{accounter}.Build();
+    server::http::HttpResponse response{*request, accounter};
+
+    std::string body;
+    for (std::size_t i = 0; body.size() < utils::impl::BufferChain::kChunkSize * 3; ++i) {
+        body += std::to_string(i);
+    }
+    utils::impl::BufferChain chain;
+    chain.Append(body);
+    ASSERT_EQ(chain.GetChunksCount(), 4);
+
+    response.SetBodyChain(std::move(chain));
+    response.SetStatus(server::http::HttpStatus::kOk);
+    EXPECT_EQ(accounter.GetCurrentLevel(), body.size());
+
+    auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+    auto send_task = engine::AsyncNoSpan(
+        [](auto&& response, auto&& socket) { response.SendResponse(socket); }, std::ref(response), std::move(server)
+    );
+
+    std::string buffer(body.size() + 4096, '\0');
+    const auto reply_size = client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+    buffer.resize(reply_size);
+
+    const auto expected_content_length = fmt::format("\r\n{}: {}\r\n", http::headers::kContentLength, body.size());
+    EXPECT_THAT(buffer, testing::HasSubstr(expected_content_length));
+    EXPECT_EQ(buffer.substr(buffer.size() - 4 - body.size()), "\r\n\r\n" + body);
+    EXPECT_EQ(response.BytesSent(), buffer.size());
+}
+
+UTEST(HttpResponse, BodyChainGetData) {
+    server::request::ResponseDataAccounter accounter;
+    auto request = server::http::HttpRequestBuilder{accounter}.Build();
+    server::http::HttpResponse response{*request, accounter};
+
+    const std::string body(utils::impl::BufferChain::kChunkSize * 2, 'x');
+    utils::impl::BufferChain chain;
+    chain.Append(body);
+    response.SetBodyChain(std::move(chain));
+
+    // Middlewares that read the body see it whole
+    EXPECT_EQ(response.GetData(), body);
+    EXPECT_FALSE(response.HasBodyChain());
+    EXPECT_EQ(accounter.GetCurrentLevel(), body.size());
+}
+
 UTEST(HttpResponse, AccounterLifetimeIfNotSent) {
     auto accounter = std::make_unique<server::request::ResponseDataAccounter>();
     const auto request = server::http::HttpRequestBuilder{*accounter}.Build();
@@ -0,0 +1,96 @@
+#include <server/http/raw_headers.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+namespace {
+
+constexpr std::size_t kInitialBufferSize = 1024;
+constexpr std::size_t kInitialEntriesCount = 32;
+
+}  // namespace
+
+RawHeaders::RawHeaders(utils::Arena& arena)
+    : buffer_(utils::ArenaAllocator<char>{arena}), entries_(utils::ArenaAllocator<Entry>{arena}) {}
+
+void RawHeaders::Add(std::string_view name, std::string_view value) {
+    UASSERT(entries_.size() < kMaxSize);
+
+    if (entries_.empty()) {
+        buffer_.reserve(kInitialBufferSize);
+        entries_.reserve(kInitialEntriesCount);
+    }
+
+    entries_.push_back(Entry{
+        static_cast<std::uint32_t>(buffer_.size()),
+        static_cast<std::uint32_t>(name.size()),
+        static_cast<std::uint32_t>(value.size()),
+        false,
+    });
+    buffer_.append(name);
+    buffer_.append(value);
+    ++size_;
+}
+
+bool RawHeaders::Contains(std::string_view name) const noexcept {
+    if (size_ == 0) return false;
+
+    for (const auto& entry : entries_) {
+        if (!entry.moved && utils::StrIcaseEqual{}(GetName(entry), name)) return true;
+    }
+    return false;
+}
+
+bool RawHeaders::MoveTo(std::string_view name, HeadersMap& headers) {
+    if (size_ == 0) return false;
+
+    bool found = false;
+    for (auto& entry : entries_) {
+        if (entry.moved || !utils::StrIcaseEqual{}(GetName(entry), name)) continue;
+
+        headers.InsertOrAppend(std::string{GetName(entry)}, std::string{GetValue(entry)});
+        entry.moved = true;
+        --size_;
+        found = true;
+    }
+    return found;
+}
+
+void RawHeaders::MoveAllTo(HeadersMap& headers) {
+    if (size_ == 0) return;
+
+    for (auto& entry : entries_) {
+        if (entry.moved) continue;
+
+        headers.InsertOrAppend(std::string{GetName(entry)}, std::string{GetValue(entry)});
+        entry.moved = true;
+    }
+    size_ = 0;
+}
+
+void RawHeaders::Remove(std::string_view name) noexcept {
+    if (size_ == 0) return;
+
+    for (auto& entry : entries_) {
+        if (entry.moved || !utils::StrIcaseEqual{}(GetName(entry), name)) continue;
+
+        entry.moved = true;
+        --size_;
+    }
+}
+
+std::string_view RawHeaders::GetName(const Entry& entry) const noexcept {
+    return std::string_view{buffer_}.substr(entry.offset, entry.name_size);
+}
+
+std::string_view RawHeaders::GetValue(const Entry& entry) const noexcept {
+    return std::string_view{buffer_}.substr(entry.offset + entry.name_size, entry.value_size);
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
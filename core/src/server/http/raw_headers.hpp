@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/http/header_map.hpp>
+#include <userver/utils/arena.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// @brief Request headers that are not copied into the HeadersMap yet.
+///
+/// Names and values of all the headers are kept in a single buffer in the
+/// request arena, a header is moved into the HeadersMap on the first access
+/// by name. Headers that are never looked at are never copied one by one.
+class RawHeaders final {
+public:
+    using HeadersMap = USERVER_NAMESPACE::http::headers::HeaderMap;
+
+    /// Not more than HeadersMap could hold
+    static constexpr std::size_t kMaxSize = 1 << 14;
+
+    explicit RawHeaders(utils::Arena& arena);
+
+    void Add(std::string_view name, std::string_view value);
+
+    /// @returns the number of header lines not moved into a HeadersMap
+    std::size_t Size() const noexcept { return size_; }
+
+    bool Contains(std::string_view name) const noexcept;
+
+    /// Moves all the values of the header into `headers` in the order of
+    /// arrival, @returns false if there are none
+    bool MoveTo(std::string_view name, HeadersMap& headers);
+
+    void MoveAllTo(HeadersMap& headers);
+
+    /// Drops the values of the header without copying them
+    void Remove(std::string_view name) noexcept;
+
+private:
+    struct Entry final {
+        std::uint32_t offset;
+        std::uint32_t name_size;
+        std::uint32_t value_size;
+        bool moved;
+    };
+
+    std::string_view GetName(const Entry& entry) const noexcept;
+    std::string_view GetValue(const Entry& entry) const noexcept;
+
+    std::basic_string<char, std::char_traits<char>, utils::ArenaAllocator<char>> buffer_;
+    std::vector<Entry, utils::ArenaAllocator<Entry>> entries_;
+    std::size_t size_{0};
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,34 @@
+#include <server/http/request_arena_pool.hpp>
+
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+RequestArenaPool::RequestArenaPool() { arenas_.reserve(kMaxPooledArenas); }
+
+utils::Arena RequestArenaPool::Acquire() {
+    {
+        const std::lock_guard lock{mutex_};
+        if (!arenas_.empty()) {
+            auto arena = std::move(arenas_.back());
+            arenas_.pop_back();
+            return arena;
+        }
+    }
+    return utils::Arena{kInitialArenaSize};
+}
+
+void RequestArenaPool::Release(utils::Arena&& arena) noexcept {
+    arena.Reset();
+    if (arena.GetReservedBytes() > kMaxRetainedArenaSize) return;
+
+    const std::lock_guard lock{mutex_};
+    // Capacity is reserved in the constructor, push_back does not allocate
+    if (arenas_.size() < kMaxPooledArenas) arenas_.push_back(std::move(arena));
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include <userver/utils/arena.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// Per-connection pool of the request arenas. Requests are parsed by the
+/// connection task and destroyed by the handler tasks, so the arenas travel
+/// between threads and the pool is synchronized.
+class RequestArenaPool final {
+public:
+    static constexpr std::size_t kInitialArenaSize = 4096;
+    static constexpr std::size_t kMaxPooledArenas = 8;
+    // Arenas that grew bigger after a huge request are not kept
+    static constexpr std::size_t kMaxRetainedArenaSize = 64 * 1024;
+
+    RequestArenaPool();
+
+    utils::Arena Acquire();
+
+    void Release(utils::Arena&& arena) noexcept;
+
+private:
+    std::mutex mutex_;
+    std::vector<utils::Arena> arenas_;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#include <server/http/request_arena_pool.hpp>
+
+#include <vector>
+
+#include <userver/server/http/http_request.hpp>
+#include <userver/utest/utest.hpp>
+
+#include "create_parser_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(RequestArenaPool, Reuse) {
+    server::http::impl::RequestArenaPool pool;
+
+    auto arena = pool.Acquire();
+    arena.Allocate(100);
+    const auto reserved = arena.GetReservedBytes();
+    EXPECT_GT(reserved, 0);
+    pool.Release(std::move(arena));
+
+    auto reused = pool.Acquire();
+    EXPECT_EQ(reused.GetReservedBytes(), reserved);
+    EXPECT_EQ(reused.GetUsedBytes(), 0);
+}
+
+TEST(RequestArenaPool, HugeArenasAreDropped) {
+    server::http::impl::RequestArenaPool pool;
+
+    auto arena = pool.Acquire();
+    arena.Allocate(server::http::impl::RequestArenaPool::kMaxRetainedArenaSize * 2);
+    pool.Release(std::move(arena));
+
+    EXPECT_EQ(pool.Acquire().GetReservedBytes(), 0);
+}
+
+UTEST(RequestArenaPool, RequestArgs) {
+    std::vector<std::shared_ptr<server::http::HttpRequest>> requests;
+    auto parser = server::CreateTestParser([&requests](std::shared_ptr<server::http::HttpRequest>&& request) {
+        requests.push_back(std::move(request));
+    });
+
+    parser->Parse(
+        "GET /first?a=1&b=2&a=3 HTTP/1.1\r\n\r\n"
+        "GET /second?c=4 HTTP/1.1\r\n\r\n"
+    );
+    ASSERT_EQ(requests.size(), 2);
+
+    // Requests of a connection may be alive simultaneously, each one has its
+    // own arena
+    auto& first_arena = requests[0]->GetArena();
+    auto& second_arena = requests[1]->GetArena();
+    EXPECT_NE(&first_arena, &second_arena);
+
+    EXPECT_EQ(requests[0]->GetArgVector("a"), (std::vector<std::string>{"1", "3"}));
+    EXPECT_EQ(requests[0]->GetArg("b"), "2");
+    EXPECT_EQ(requests[1]->GetArg("c"), "4");
+    EXPECT_FALSE(requests[1]->HasArg("a"));
+    EXPECT_GT(first_arena.GetUsedBytes(), 0);
+
+    std::vector<int, utils::ArenaAllocator<int>> scratch{utils::ArenaAllocator<int>{second_arena}};
+    scratch.assign(10, 42);
+    EXPECT_EQ(scratch.size(), 10);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,164 @@
+#include <server/http/response_body_compressor.hpp>
+
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+namespace {
+
+// Quality values are stored in thousandths, RFC 9110, 12.4.2.
+constexpr int kMaxQuality = 1000;
+
+constexpr std::string_view kWhitespace = " \t";
+
+std::string_view TrimView(std::string_view str) {
+    const auto begin = str.find_first_not_of(kWhitespace);
+    if (begin == std::string_view::npos) return {};
+    const auto end = str.find_last_not_of(kWhitespace);
+    return str.substr(begin, end - begin + 1);
+}
+
+std::optional<std::string_view> TakeToken(std::string_view& str, char separator) {
+    if (str.empty()) return std::nullopt;
+
+    const auto pos = str.find(separator);
+    const auto token = str.substr(0, pos);
+    str.remove_prefix(pos == std::string_view::npos ? str.size() : pos + 1);
+    return TrimView(token);
+}
+
+// qvalue = ( "0" [ "." 0*3DIGIT ] ) / ( "1" [ "." 0*3("0") ] )
+std::optional<int> ParseQuality(std::string_view value) {
+    if (value.empty() || (value[0] != '0' && value[0] != '1')) return std::nullopt;
+
+    int quality = (value[0] - '0') * kMaxQuality;
+    if (value.size() == 1) return quality;
+    if (value[1] != '.' || value.size() > 5) return std::nullopt;
+
+    int multiplier = kMaxQuality / 10;
+    for (const char c : value.substr(2)) {
+        if (c < '0' || c > '9') return std::nullopt;
+        quality += (c - '0') * multiplier;
+        multiplier /= 10;
+    }
+
+    if (quality > kMaxQuality) return std::nullopt;
+    return quality;
+}
+
+std::optional<ContentCoding> ParseContentCoding(std::string_view name) {
+    const utils::StrIcaseEqual equal;
+    if (equal(name, "zstd")) return ContentCoding::kZstd;
+    // RFC 9110, 8.4.1.3. A recipient SHOULD consider "x-gzip" to be
+    // equivalent to "gzip".
+    if (equal(name, "gzip") || equal(name, "x-gzip")) return ContentCoding::kGzip;
+    return std::nullopt;
+}
+
+bool HasToken(std::string_view list, std::string_view token) {
+    const utils::StrIcaseEqual equal;
+    while (const auto item = TakeToken(list, ',')) {
+        if (equal(*item, token)) return true;
+    }
+    return false;
+}
+
+template <typename Compressor>
+class ResponseBodyCompressorImpl final : public ResponseBodyCompressor {
+public:
+    ResponseBodyCompressorImpl(ContentCoding coding, int level) : ResponseBodyCompressor(coding), compressor_(level) {}
+
+    std::string Compress(std::string_view chunk) override { return compressor_.Compress(chunk); }
+
+    std::string Finish() override { return compressor_.Finish(); }
+
+private:
+    Compressor compressor_;
+};
+
+}  // namespace
+
+std::string_view ToString(ContentCoding coding) {
+    switch (coding) {
+        case ContentCoding::kGzip:
+            return "gzip";
+        case ContentCoding::kZstd:
+            return "zstd";
+    }
+
+    UINVARIANT(false, "Unexpected content coding");
+}
+
+std::optional<ContentCoding> NegotiateContentCoding(std::string_view accept_encoding) {
+    constexpr std::size_t kCodingsCount = static_cast<std::size_t>(ContentCoding::kZstd) + 1;
+
+    std::optional<int> qualities[kCodingsCount]{};
+    std::optional<int> wildcard_quality;
+
+    while (auto item = TakeToken(accept_encoding, ',')) {
+        auto name = TakeToken(*item, ';');
+        if (!name || name->empty()) continue;
+
+        int quality = kMaxQuality;
+        while (const auto param = TakeToken(*item, ';')) {
+            if (param->size() > 2 && (param->substr(0, 2) == "q=" || param->substr(0, 2) == "Q=")) {
+                const auto parsed = ParseQuality(param->substr(2));
+                // Ignore the malformed element
+                quality = parsed.value_or(0);
+            }
+        }
+
+        if (*name == "*") {
+            wildcard_quality = quality;
+        } else if (const auto coding = ParseContentCoding(*name)) {
+            qualities[static_cast<std::size_t>(*coding)] = quality;
+        }
+    }
+
+    std::optional<ContentCoding> result;
+    int best_quality = 0;
+    for (std::size_t i = 0; i < kCodingsCount; ++i) {
+        const auto quality = qualities[i].has_value() ? *qualities[i] : wildcard_quality.value_or(0);
+        if (quality > 0 && quality >= best_quality) {
+            best_quality = quality;
+            result = static_cast<ContentCoding>(i);
+        }
+    }
+    return result;
+}
+
+void SetContentCodingHeaders(HttpResponse& response, ContentCoding coding) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kContentEncoding, std::string{ToString(coding)});
+
+    constexpr std::string_view kAcceptEncoding = USERVER_NAMESPACE::http::headers::kAcceptEncoding;
+    const auto& vary = response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+    if (vary.empty()) {
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, std::string{kAcceptEncoding});
+    } else if (vary != "*" && !HasToken(vary, kAcceptEncoding)) {
+        response.SetHeader(USERVER_NAMESPACE::http::headers::kVary, fmt::format("{}, {}", vary, kAcceptEncoding));
+    }
+}
+
+ResponseBodyCompressor::~ResponseBodyCompressor() = default;
+
+std::unique_ptr<ResponseBodyCompressor> MakeResponseBodyCompressor(ContentCoding coding, int level) {
+    switch (coding) {
+        case ContentCoding::kGzip:
+            return std::make_unique<ResponseBodyCompressorImpl<compression::gzip::Compressor>>(coding, level);
+        case ContentCoding::kZstd:
+            return std::make_unique<ResponseBodyCompressorImpl<compression::zstd::Compressor>>(coding, level);
+    }
+
+    UINVARIANT(false, "Unexpected content coding");
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class HttpResponse;
+
+namespace impl {
+
+/// Content codings that the server is able to apply to response bodies
+enum class ContentCoding {
+    kGzip,
+    kZstd,
+};
+
+std::string_view ToString(ContentCoding coding);
+
+/// Chooses the content coding for the response according to the
+/// Accept-Encoding request header value, RFC 9110, 12.5.3. Codings with
+/// the same quality are preferred in the order of ContentCoding declaration
+/// from the last one to the first one.
+std::optional<ContentCoding> NegotiateContentCoding(std::string_view accept_encoding);
+
+/// Sets Content-Encoding and adds Accept-Encoding to the Vary header
+void SetContentCodingHeaders(HttpResponse& response, ContentCoding coding);
+
+/// Incrementally compresses chunks of a streamed response body. Each chunk is
+/// flushed, so the client is able to decode all the data pushed so far.
+///
+/// Unlike the one-shot compression::*::Compress functions, the compression
+/// context is owned by the stream, because the stream may outlive
+/// any number of context switches.
+class ResponseBodyCompressor {
+public:
+    virtual ~ResponseBodyCompressor();
+
+    ContentCoding GetCoding() const { return coding_; }
+
+    /// @returns compressed and flushed representation of `chunk`
+    virtual std::string Compress(std::string_view chunk) = 0;
+
+    /// @returns the end of the compressed stream
+    virtual std::string Finish() = 0;
+
+protected:
+    explicit ResponseBodyCompressor(ContentCoding coding) : coding_(coding) {}
+
+private:
+    const ContentCoding coding_;
+};
+
+std::unique_ptr<ResponseBodyCompressor> MakeResponseBodyCompressor(ContentCoding coding, int level);
+
+}  // namespace impl
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
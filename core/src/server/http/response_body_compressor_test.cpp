@@ -0,0 +1,84 @@
+#include <server/http/response_body_compressor.hpp>
+
+#include <gtest/gtest.h>
+
+#include <compression/gzip.hpp>
+#include <userver/compression/zstd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::ContentCoding;
+using server::http::impl::NegotiateContentCoding;
+
+std::string Decompress(ContentCoding coding, std::string_view compressed, std::size_t max_size) {
+    switch (coding) {
+        case ContentCoding::kGzip:
+            return compression::gzip::Decompress(compressed, max_size);
+        case ContentCoding::kZstd:
+            return compression::zstd::Decompress(compressed, max_size);
+    }
+    return {};
+}
+
+}  // namespace
+
+TEST(ResponseBodyCompressor, Negotiate) {
+    EXPECT_EQ(NegotiateContentCoding(""), std::nullopt);
+    EXPECT_EQ(NegotiateContentCoding("identity"), std::nullopt);
+    EXPECT_EQ(NegotiateContentCoding("br, deflate"), std::nullopt);
+
+    EXPECT_EQ(NegotiateContentCoding("gzip"), ContentCoding::kGzip);
+    EXPECT_EQ(NegotiateContentCoding("x-gzip"), ContentCoding::kGzip);
+    EXPECT_EQ(NegotiateContentCoding("GZip"), ContentCoding::kGzip);
+    EXPECT_EQ(NegotiateContentCoding("zstd"), ContentCoding::kZstd);
+
+    // Equal qualities, server preference wins
+    EXPECT_EQ(NegotiateContentCoding("gzip, deflate, br, zstd"), ContentCoding::kZstd);
+    EXPECT_EQ(NegotiateContentCoding("*"), ContentCoding::kZstd);
+
+    EXPECT_EQ(NegotiateContentCoding("gzip;q=1.0, zstd;q=0.5"), ContentCoding::kGzip);
+    EXPECT_EQ(NegotiateContentCoding("gzip ; q=0.8 , zstd;q=0.801"), ContentCoding::kZstd);
+    EXPECT_EQ(NegotiateContentCoding("zstd;q=0, *"), ContentCoding::kGzip);
+    EXPECT_EQ(NegotiateContentCoding("zstd;q=0, gzip;q=0"), std::nullopt);
+    EXPECT_EQ(NegotiateContentCoding("*;q=0"), std::nullopt);
+    EXPECT_EQ(NegotiateContentCoding("gzip, *;q=0"), ContentCoding::kGzip);
+
+    // Malformed quality values make the element unacceptable
+    EXPECT_EQ(NegotiateContentCoding("zstd;q=2, gzip;q=0.5"), ContentCoding::kGzip);
+    EXPECT_EQ(NegotiateContentCoding("zstd;q=0.5555"), std::nullopt);
+}
+
+TEST(ResponseBodyCompressor, StreamRoundtrip) {
+    const std::string chunk = std::string(1000, 'a') + "some chunk" + std::string(1000, 'b');
+    constexpr std::size_t kChunks = 100;
+
+    for (const auto coding : {ContentCoding::kGzip, ContentCoding::kZstd}) {
+        auto compressor = server::http::impl::MakeResponseBodyCompressor(coding, 1);
+        ASSERT_EQ(compressor->GetCoding(), coding);
+
+        std::string expected;
+        std::string compressed;
+        for (std::size_t i = 0; i < kChunks; ++i) {
+            const auto compressed_chunk = compressor->Compress(chunk);
+            // Every chunk is flushed to be sent immediately
+            EXPECT_FALSE(compressed_chunk.empty());
+            compressed += compressed_chunk;
+            expected += chunk;
+        }
+        compressed += compressor->Finish();
+
+        EXPECT_LT(compressed.size(), expected.size());
+        EXPECT_EQ(Decompress(coding, compressed, expected.size()), expected);
+    }
+}
+
+TEST(ResponseBodyCompressor, EmptyStream) {
+    for (const auto coding : {ContentCoding::kGzip, ContentCoding::kZstd}) {
+        auto compressor = server::http::impl::MakeResponseBodyCompressor(coding, 1);
+        EXPECT_EQ(Decompress(coding, compressor->Finish(), 0), "");
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -14,6 +14,7 @@
 #include <server/middlewares/handler_adapter.hpp>
 #include <server/middlewares/handler_metrics.hpp>
 #include <server/middlewares/rate_limit.hpp>
+#include <server/middlewares/response_compression.hpp>
 #include <server/middlewares/tracing.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,6 +31,8 @@ MiddlewaresList DefaultPipeline() {
         std::string{builtin::kTracing},
         // Ditto
         std::string{builtin::kSetAcceptEncoding},
+        // Should see the final response body, including the error ones
+        std::string{builtin::kResponseCompression},
 
         // Every exception caught here is transformed into Http500 without
         // context.
@@ -68,6 +71,7 @@ components::ComponentList DefaultMiddlewareComponents() {
         .Append<DeadlinePropagationFactory>()
         .Append<DecompressionFactory>()
         .Append<SetAcceptEncodingFactory>()
+        .Append<ResponseCompressionFactory>()
         .Append<ExceptionsHandlingFactory>()
         .Append<UnknownExceptionsHandlingFactory>()
         .Append<testsuite::ExceptionsHandlingMiddlewareFactory>();
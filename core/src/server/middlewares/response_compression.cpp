@@ -0,0 +1,175 @@
+#include <server/middlewares/response_compression.hpp>
+
+#include <userver/components/component_config.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+constexpr std::string_view kSettingsSchema = R"(
+type: object
+description: Http response compression middleware
+additionalProperties: false
+properties:
+    enabled:
+        type: boolean
+        description: whether to compress the responses
+        defaultDescription: false
+    min-size:
+        type: integer
+        description: responses with smaller bodies are sent uncompressed; streamed responses are always compressed
+        defaultDescription: 1024
+        minimum: 0
+    gzip-level:
+        type: integer
+        description: gzip compression level
+        defaultDescription: 6
+        minimum: 1
+        maximum: 9
+    zstd-level:
+        type: integer
+        description: zstd compression level
+        defaultDescription: 3
+        minimum: 1
+        maximum: 19
+)";
+
+bool IsBodilessStatus(http::HttpStatus status) {
+    const auto code = static_cast<int>(status);
+    return (code >= 100 && code < 200) || status == http::HttpStatus::kNoContent ||
+           status == http::HttpStatus::kNotModified;
+}
+
+}  // namespace
+
+ResponseCompressionSettings
+ParseResponseCompressionSettings(const yaml_config::YamlConfig& config, const ResponseCompressionSettings& defaults) {
+    ResponseCompressionSettings settings;
+    settings.enabled = config["enabled"].As<bool>(defaults.enabled);
+    settings.min_size = config["min-size"].As<std::size_t>(defaults.min_size);
+    settings.gzip_level = config["gzip-level"].As<int>(defaults.gzip_level);
+    settings.zstd_level = config["zstd-level"].As<int>(defaults.zstd_level);
+    return settings;
+}
+
+bool IsResponseCompressible(const http::HttpRequest& request, const http::HttpResponse& response) {
+    if (request.GetMethod() == http::HttpMethod::kHead) return false;
+    if (IsBodilessStatus(response.GetStatus())) return false;
+
+    // Content-Range refers to the offsets in the uncompressed representation
+    if (response.GetStatus() == http::HttpStatus::kPartialContent ||
+        response.HasHeader(USERVER_NAMESPACE::http::headers::kContentRange)) {
+        return false;
+    }
+
+    // The handler has encoded the body by itself
+    return !response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding);
+}
+
+ResponseCompression::ResponseCompression(const handlers::HttpHandlerBase&, ResponseCompressionSettings settings)
+    : settings_(settings) {}
+
+void ResponseCompression::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
+    if (!settings_.enabled) {
+        Next(request, context);
+        return;
+    }
+
+    const auto coding =
+        http::impl::NegotiateContentCoding(request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding));
+    if (!coding || request.GetMethod() == http::HttpMethod::kHead) {
+        Next(request, context);
+        return;
+    }
+
+    auto& response = request.GetHttpResponse();
+    if (response.IsBodyStreamed()) {
+        try {
+            // The chunks are compressed by ResponseBodyStream as they are pushed
+            response.SetBodyStreamCompressor(http::impl::MakeResponseBodyCompressor(*coding, GetLevel(*coding)));
+        } catch (const std::exception& e) {
+            LOG_ERROR() << "Failed to set up the response body compression, sending it as is: " << e;
+        }
+        Next(request, context);
+        return;
+    }
+
+    Next(request, context);
+    if (IsResponseCompressible(request, response)) CompressResponseBody(response, *coding);
+}
+
+void ResponseCompression::CompressResponseBody(http::HttpResponse& response, http::impl::ContentCoding coding) const {
+    const auto& body = response.GetData();
+    if (body.size() < settings_.min_size || body.empty()) return;
+
+    const auto scope_time = tracing::ScopeTime::CreateOptionalScopeTime("http_compress_response_body");
+
+    std::string compressed;
+    try {
+        switch (coding) {
+            case http::impl::ContentCoding::kGzip:
+                compressed = compression::gzip::Compress(body, settings_.gzip_level);
+                break;
+            case http::impl::ContentCoding::kZstd:
+                compressed = compression::zstd::Compress(body, settings_.zstd_level);
+                break;
+        }
+    } catch (const std::exception& e) {
+        // Middlewares should not throw, the uncompressed body is still a valid response
+        LOG_ERROR() << "Failed to compress the response body, sending it as is: " << e;
+        return;
+    }
+
+    // Incompressible data, e.g. an image
+    if (compressed.size() >= body.size()) return;
+
+    response.SetData(std::move(compressed));
+    http::impl::SetContentCodingHeaders(response, coding);
+}
+
+int ResponseCompression::GetLevel(http::impl::ContentCoding coding) const {
+    switch (coding) {
+        case http::impl::ContentCoding::kGzip:
+            return settings_.gzip_level;
+        case http::impl::ContentCoding::kZstd:
+            return settings_.zstd_level;
+    }
+
+    UINVARIANT(false, "Unexpected content coding");
+}
+
+ResponseCompressionFactory::ResponseCompressionFactory(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context
+)
+    : HttpMiddlewareFactoryBase(config, context), settings_(ParseResponseCompressionSettings(config, {})) {}
+
+std::unique_ptr<HttpMiddlewareBase> ResponseCompressionFactory::Create(
+    const handlers::HttpHandlerBase& handler,
+    yaml_config::YamlConfig middleware_config
+) const {
+    auto settings = ParseResponseCompressionSettings(middleware_config, settings_);
+    return std::make_unique<ResponseCompression>(handler, settings);
+}
+
+yaml_config::Schema ResponseCompressionFactory::GetMiddlewareConfigSchema() const {
+    return yaml_config::impl::SchemaFromString(std::string{kSettingsSchema});
+}
+
+yaml_config::Schema ResponseCompressionFactory::GetStaticConfigSchema() {
+    return yaml_config::MergeSchemas<components::ComponentBase>(std::string{kSettingsSchema});
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+
+#include <userver/compression/zstd.hpp>
+#include <userver/server/middlewares/builtin.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+#include <compression/gzip.hpp>
+#include <server/http/response_body_compressor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+struct ResponseCompressionSettings final {
+    bool enabled{false};
+    std::size_t min_size{1024};
+    int gzip_level{compression::gzip::kDefaultLevel};
+    int zstd_level{compression::zstd::kDefaultLevel};
+};
+
+/// Parses the settings, taking the missing values from `defaults`
+ResponseCompressionSettings
+ParseResponseCompressionSettings(const yaml_config::YamlConfig& config, const ResponseCompressionSettings& defaults);
+
+/// Returns false for the responses whose body must be sent as is: replies to
+/// HEAD, bodiless statuses, partial content and already encoded bodies
+bool IsResponseCompressible(const http::HttpRequest& request, const http::HttpResponse& response);
+
+class ResponseCompression final : public HttpMiddlewareBase {
+public:
+    static constexpr std::string_view kName = builtin::kResponseCompression;
+
+    ResponseCompression(const handlers::HttpHandlerBase&, ResponseCompressionSettings settings);
+
+private:
+    void HandleRequest(http::HttpRequest& request, request::RequestContext& context) const override;
+
+    void CompressResponseBody(http::HttpResponse& response, http::impl::ContentCoding coding) const;
+
+    int GetLevel(http::impl::ContentCoding coding) const;
+
+    const ResponseCompressionSettings settings_;
+};
+
+class ResponseCompressionFactory final : public HttpMiddlewareFactoryBase {
+public:
+    static constexpr std::string_view kName = ResponseCompression::kName;
+
+    ResponseCompressionFactory(const components::ComponentConfig&, const components::ComponentContext&);
+
+    static yaml_config::Schema GetStaticConfigSchema();
+
+private:
+    std::unique_ptr<HttpMiddlewareBase>
+    Create(const handlers::HttpHandlerBase&, yaml_config::YamlConfig middleware_config) const override;
+
+    yaml_config::Schema GetMiddlewareConfigSchema() const override;
+
+    const ResponseCompressionSettings settings_;
+};
+
+}  // namespace server::middlewares
+
+template <>
+inline constexpr bool components::kHasValidate<server::middlewares::ResponseCompressionFactory> = true;
+
+template <>
+inline constexpr auto components::kConfigFileMode<server::middlewares::ResponseCompressionFactory> =
+    ConfigFileMode::kNotRequired;
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,89 @@
+#include <server/middlewares/response_compression.hpp>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/server/http/http_request_builder.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utest/utest.hpp>
+
+#include <server/http/response_body_compressor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::shared_ptr<server::http::HttpRequest> MakeRequest(
+    server::http::HttpMethod method,
+    server::http::HttpStatus status,
+    server::request::ResponseDataAccounter& accounter
+) {
+    auto request = server::http::HttpRequestBuilder{accounter}.SetMethod(method).Build();
+    auto& response = request->GetHttpResponse();
+    response.SetStatus(status);
+    response.SetData(std::string(4096, 'a'));
+    return request;
+}
+
+}  // namespace
+
+UTEST(ResponseCompression, Compressible) {
+    server::request::ResponseDataAccounter accounter;
+    const auto request = MakeRequest(server::http::HttpMethod::kGet, server::http::HttpStatus::kOk, accounter);
+    EXPECT_TRUE(server::middlewares::IsResponseCompressible(*request, request->GetHttpResponse()));
+}
+
+UTEST(ResponseCompression, RangeResponse) {
+    server::request::ResponseDataAccounter accounter;
+
+    const auto partial =
+        MakeRequest(server::http::HttpMethod::kGet, server::http::HttpStatus::kPartialContent, accounter);
+    partial->GetHttpResponse().SetHeader(http::headers::kContentRange, "bytes 0-4095/10000");
+    EXPECT_FALSE(server::middlewares::IsResponseCompressible(*partial, partial->GetHttpResponse()));
+
+    const auto not_satisfiable =
+        MakeRequest(server::http::HttpMethod::kGet, server::http::HttpStatus::kRangeNotSatisfiable, accounter);
+    not_satisfiable->GetHttpResponse().SetHeader(http::headers::kContentRange, "bytes */10000");
+    EXPECT_FALSE(server::middlewares::IsResponseCompressible(*not_satisfiable, not_satisfiable->GetHttpResponse()));
+}
+
+UTEST(ResponseCompression, HeadAndBodiless) {
+    server::request::ResponseDataAccounter accounter;
+
+    const auto head = MakeRequest(server::http::HttpMethod::kHead, server::http::HttpStatus::kOk, accounter);
+    EXPECT_FALSE(server::middlewares::IsResponseCompressible(*head, head->GetHttpResponse()));
+
+    for (const auto status : {server::http::HttpStatus::kNoContent, server::http::HttpStatus::kNotModified}) {
+        const auto request = MakeRequest(server::http::HttpMethod::kGet, status, accounter);
+        EXPECT_FALSE(server::middlewares::IsResponseCompressible(*request, request->GetHttpResponse()));
+    }
+}
+
+UTEST(ResponseCompression, AlreadyEncoded) {
+    server::request::ResponseDataAccounter accounter;
+    const auto request = MakeRequest(server::http::HttpMethod::kGet, server::http::HttpStatus::kOk, accounter);
+    request->GetHttpResponse().SetHeader(http::headers::kContentEncoding, "br");
+    EXPECT_FALSE(server::middlewares::IsResponseCompressible(*request, request->GetHttpResponse()));
+}
+
+UTEST(ResponseCompression, StreamedBodiless) {
+    server::request::ResponseDataAccounter accounter;
+
+    for (const auto status : {server::http::HttpStatus::kNoContent, server::http::HttpStatus::kNotModified}) {
+        const auto request = MakeRequest(server::http::HttpMethod::kGet, status, accounter);
+        auto& response = request->GetHttpResponse();
+        response.SetStreamBody();
+        response.SetBodyStreamCompressor(
+            server::http::impl::MakeResponseBodyCompressor(server::http::impl::ContentCoding::kGzip, 1)
+        );
+        EXPECT_EQ(response.ExtractBodyStreamCompressor(), nullptr);
+    }
+
+    const auto request = MakeRequest(server::http::HttpMethod::kGet, server::http::HttpStatus::kOk, accounter);
+    auto& response = request->GetHttpResponse();
+    response.SetStreamBody();
+    response.SetBodyStreamCompressor(
+        server::http::impl::MakeResponseBodyCompressor(server::http::impl::ContentCoding::kGzip, 1)
+    );
+    EXPECT_NE(response.ExtractBodyStreamCompressor(), nullptr);
+}
+
+USERVER_NAMESPACE_END
@@ -310,6 +310,7 @@ void Connection::SendResponse(http::HttpRequest& request) {
     auto& response = request.GetHttpResponse();
     UASSERT(!response.IsSent());
     request.SetStartSendResponseTime();
+    response.SetZeroCopyThreshold(config_.zerocopy_threshold, config_.zerocopy_timeout);
     if (is_response_chain_valid_ && peer_socket_) {
         try {
             // Might be a stream reading or a fully constructed response
@@ -358,6 +359,9 @@ void Connection::SendResponse(http::HttpRequest& request) {
         } catch (const std::exception& ex) {
             LOG_ERROR() << "Error while sending data: " << ex;
             response.SetSendFailed(std::chrono::steady_clock::now());
+            // The response could have been sent partially, the peer would not be
+            // able to parse the following responses
+            is_response_chain_valid_ = false;
         }
     } else {
         response.SetSendFailed(std::chrono::steady_clock::now());
@@ -365,6 +369,11 @@ void Connection::SendResponse(http::HttpRequest& request) {
     request.SetFinishSendResponseTime();
     stats_->active_request_count.Subtract(1);
     stats_->requests_processed_count.Add(1);
+    {
+        const auto bytes_sent_zero_copy = response.BytesSentZeroCopy();
+        stats_->bytes_sent_zero_copy.Add(utils::statistics::Rate{bytes_sent_zero_copy});
+        stats_->bytes_sent_copied.Add(utils::statistics::Rate{response.BytesSent() - bytes_sent_zero_copy});
+    }
 
     request.WriteAccessLogs(request_handler_.LoggerAccess(), request_handler_.LoggerAccessTskv(), peer_name_);
 }
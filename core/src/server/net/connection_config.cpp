@@ -21,6 +21,8 @@ ConnectionConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<
     config.requests_queue_size_threshold =
         value["requests_queue_size_threshold"].As<size_t>(config.requests_queue_size_threshold);
     config.keepalive_timeout = value["keepalive_timeout"].As<std::chrono::seconds>(config.keepalive_timeout);
+    config.zerocopy_threshold = value["zerocopy_threshold"].As<std::optional<std::size_t>>();
+    config.zerocopy_timeout = value["zerocopy_timeout"].As<std::chrono::seconds>(config.zerocopy_timeout);
 
     if (!value["stream_close_check_delay"].IsMissing()) {
         config.abort_check_delay = utils::StringToDuration(value["stream_close_check_delay"].As<std::string>());
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include <userver/http/http_version.hpp>
@@ -29,6 +30,8 @@ struct ConnectionConfig {
     size_t requests_queue_size_threshold = 100;
     std::chrono::seconds keepalive_timeout{10 * 60};
     std::chrono::milliseconds abort_check_delay{kDefaultAbortCheckDelay};
+    std::optional<std::size_t> zerocopy_threshold;
+    std::chrono::seconds zerocopy_timeout{60};
     USERVER_NAMESPACE::http::HttpVersion http_version = USERVER_NAMESPACE::http::HttpVersion::k11;
     Http2SessionConfig http2_session_config;
 };
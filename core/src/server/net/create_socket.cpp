@@ -1,6 +1,12 @@
 #include "create_socket.hpp"
 
+#ifdef __linux__
+#include <linux/filter.h>
+#include <sys/socket.h>
+#endif
+
 #include <string>
+#include <system_error>
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
@@ -8,8 +14,11 @@
 #include <userver/engine/io/socket.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/net/blocking/get_addr_info.hpp>
 
+#include <utils/check_syscall.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
@@ -69,6 +78,40 @@ engine::io::Socket CreateSocket(const ListenerConfig& config, const PortConfig&
         return CreateUnixSocket(port_config.unix_socket_path, config.backlog, port_config.unix_socket_perms);
 }
 
+void SetReuseportCpuSteering(engine::io::Socket& socket, std::size_t group_size) {
+    UASSERT(group_size > 0);
+#if defined(__linux__) && defined(SO_ATTACH_REUSEPORT_CBPF)
+    // Returns `cpu % group_size` as the index of the socket in the group
+    sock_filter code[] = {
+        {BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+        {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<std::uint32_t>(group_size)},
+        {BPF_RET | BPF_A, 0, 0, 0},
+    };
+    sock_fprog program{static_cast<unsigned short>(std::size(code)), code};
+
+    utils::CheckSyscall(
+        ::setsockopt(socket.Fd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)),
+        "attaching SO_REUSEPORT CPU steering program, fd={}",
+        socket.Fd()
+    );
+#else
+    throw std::system_error(
+        std::make_error_code(std::errc::not_supported),
+        fmt::format("SO_REUSEPORT CPU steering for fd={} is not supported on this platform", socket.Fd())
+    );
+#endif
+}
+
+bool TrySetReuseportCpuSteering(engine::io::Socket& socket, std::size_t group_size) noexcept {
+    try {
+        SetReuseportCpuSteering(socket, group_size);
+        return true;
+    } catch (const std::exception& e) {
+        LOG_WARNING() << "Connections are distributed between the listener shards by hash: " << e;
+        return false;
+    }
+}
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
@@ -9,6 +9,16 @@ namespace server::net {
 
 engine::io::Socket CreateSocket(const ListenerConfig& config, const PortConfig& port_config);
 
+/// Makes the kernel pick the socket of the SO_REUSEPORT group for a new
+/// connection by the number of the CPU that received it, so connections
+/// received by the same CPU are accepted by the same shard.
+/// @throws std::system_error on failure or if unsupported by the platform
+void SetReuseportCpuSteering(engine::io::Socket& socket, std::size_t group_size);
+
+/// Same as SetReuseportCpuSteering(), but logs the failure and returns false,
+/// leaving the kernel to distribute connections by the hash of the connection
+bool TrySetReuseportCpuSteering(engine::io::Socket& socket, std::size_t group_size) noexcept;
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
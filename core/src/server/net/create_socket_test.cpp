@@ -0,0 +1,68 @@
+#include <server/net/create_socket.hpp>
+
+#include <sys/socket.h>
+
+#include <system_error>
+#include <vector>
+
+#include <userver/engine/io/socket.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kGroupSize = 3;
+constexpr std::chrono::milliseconds kNotSelectedWait{100};
+
+// Sockets listening on the same port, as the listener shards do
+std::vector<engine::io::Socket> MakeReuseportGroup() {
+    const server::net::ListenerConfig config;
+    server::net::PortConfig port_config;
+    port_config.address = "127.0.0.1";
+
+    std::vector<engine::io::Socket> group;
+    group.push_back(server::net::CreateSocket(config, port_config));
+    port_config.port = group.front().Getsockname().Port();
+    while (group.size() < kGroupSize) {
+        group.push_back(server::net::CreateSocket(config, port_config));
+    }
+    return group;
+}
+
+}  // namespace
+
+UTEST(ReuseportCpuSteering, Attach) {
+#if !defined(__linux__) || !defined(SO_ATTACH_REUSEPORT_CBPF)
+    GTEST_SKIP() << "SO_ATTACH_REUSEPORT_CBPF is not supported on this platform";
+#endif
+    auto group = MakeReuseportGroup();
+    UEXPECT_NO_THROW(server::net::SetReuseportCpuSteering(group.front(), kGroupSize));
+
+    const auto addr = group.front().Getsockname();
+    engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+    client.Connect(addr, engine::Deadline::FromDuration(utest::kMaxTestWaitTime));
+
+    // The program selects exactly one socket of the group for the connection
+    std::size_t accepted = 0;
+    for (auto& socket : group) {
+        if (socket.WaitReadable(engine::Deadline::FromDuration(kNotSelectedWait))) {
+            [[maybe_unused]] auto connection = socket.Accept(engine::Deadline::FromDuration(utest::kMaxTestWaitTime));
+            ++accepted;
+        }
+    }
+    EXPECT_EQ(accepted, 1);
+}
+
+UTEST(ReuseportCpuSteering, FallbackOnFailure) {
+    // Not a part of any SO_REUSEPORT group, the kernel refuses the program
+    engine::io::Socket socket{engine::io::AddrDomain::kInet, engine::io::SocketType::kStream};
+    UEXPECT_THROW(server::net::SetReuseportCpuSteering(socket, kGroupSize), std::system_error);
+    EXPECT_FALSE(server::net::TrySetReuseportCpuSteering(socket, kGroupSize));
+
+    // The socket stays usable without the program
+    socket.Bind(engine::io::Sockaddr::MakeIPv4LoopbackAddress());
+    UEXPECT_NO_THROW(socket.Listen());
+}
+
+USERVER_NAMESPACE_END
@@ -16,6 +16,8 @@ struct EndpointInfo {
     const ListenerConfig& listener_config;
     http::HttpRequestHandler& request_handler;
     Connection::Type connection_type{Connection::Type::kRequest};
+    // Number of listeners sharing the SO_REUSEPORT sockets of each port
+    std::size_t listener_shards{1};
 
     std::atomic<size_t> connection_count{0};
 };
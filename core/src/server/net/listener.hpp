@@ -17,7 +17,8 @@ public:
     Listener(
         std::shared_ptr<EndpointInfo> endpoint_info,
         engine::TaskProcessor& task_processor,
-        request::ResponseDataAccounter& data_accounter
+        request::ResponseDataAccounter& data_accounter,
+        std::size_t shard
     );
     ~Listener();
 
@@ -30,10 +31,13 @@ public:
 
     StatsAggregation GetStats() const;
 
+    std::vector<AcceptorStatsAggregation> GetAcceptorStats() const;
+
 private:
     engine::TaskProcessor* task_processor_;
     std::shared_ptr<EndpointInfo> endpoint_info_;
     request::ResponseDataAccounter* data_accounter_;
+    std::size_t shard_;
 
     std::unique_ptr<ListenerImpl> impl_;
 };
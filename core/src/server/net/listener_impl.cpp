@@ -1,6 +1,7 @@
 #include "listener_impl.hpp"
 
 #include <netinet/tcp.h>
+#include <sys/socket.h>
 
 #include <cstdint>
 #include <cstring>
@@ -8,6 +9,8 @@
 #include <string>
 #include <system_error>
 
+#include <fmt/format.h>
+
 #include <server/net/create_socket.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/io/exception.hpp>
@@ -19,6 +22,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -27,19 +31,28 @@ namespace server::net {
 ListenerImpl::ListenerImpl(
     engine::TaskProcessor& task_processor,
     std::shared_ptr<EndpointInfo> endpoint_info,
-    request::ResponseDataAccounter& data_accounter
+    request::ResponseDataAccounter& data_accounter,
+    std::size_t shard
 )
     : task_processor_(task_processor),
       endpoint_info_(std::move(endpoint_info)),
+      shard_(shard),
       stats_(std::make_shared<Stats>()),
       data_accounter_(data_accounter) {
-    for (const auto& port : endpoint_info_->listener_config.ports) {
+    const auto& listener_config = endpoint_info_->listener_config;
+    for (const auto& port : listener_config.ports) {
+        auto& acceptor = acceptors_.emplace_back(Acceptor{CreateSocket(listener_config, port), port});
+        if (listener_config.shards_cpu_steering && port.unix_socket_path.empty()) {
+            // All the sockets of a port share the program, the last attached one wins
+            TrySetReuseportCpuSteering(acceptor.socket, endpoint_info_->listener_shards);
+        }
+
         socket_listener_tasks.push_back(engine::CriticalAsyncNoSpan(
             task_processor_,
-            [this](engine::io::Socket&& request_socket) {
+            [this, &acceptor] {
                 while (!engine::current_task::ShouldCancel()) {
                     try {
-                        AcceptConnection(request_socket, endpoint_info_->listener_config.ports[0]);
+                        AcceptConnection(acceptor);
                     } catch (const engine::io::IoCancelled&) {
                         break;
                     } catch (const std::exception& ex) {
@@ -50,8 +63,7 @@ ListenerImpl::ListenerImpl(
                         engine::Yield();
                     }
                 }
-            },
-            CreateSocket(endpoint_info_->listener_config, port)
+            }
         ));
     }
 }
@@ -66,8 +78,44 @@ ListenerImpl::~ListenerImpl() {
 
 StatsAggregation ListenerImpl::GetStats() const { return StatsAggregation{*stats_}; }
 
-void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket, const PortConfig& port_config) {
-    auto peer_socket = request_socket.Accept({});
+std::vector<AcceptorStatsAggregation> ListenerImpl::GetAcceptorStats() const {
+    std::vector<AcceptorStatsAggregation> result;
+    result.reserve(acceptors_.size());
+    for (const auto& acceptor : acceptors_) {
+        auto& stats = result.emplace_back();
+        const auto& port_config = acceptor.port_config;
+        stats.address = port_config.unix_socket_path.empty()
+                            ? fmt::format("[{}]:{}", port_config.address, port_config.port)
+                            : port_config.unix_socket_path;
+        stats.shard = shard_;
+        stats.accepted = acceptor.accepted.Load();
+
+#ifdef __linux__
+        // For a listening socket the kernel reports the accept queue length in
+        // tcpi_unacked and its limit in tcpi_sacked, same as `ss -lt` does
+        if (port_config.unix_socket_path.empty()) {
+            tcp_info info{};
+            socklen_t info_len = sizeof(info);
+            if (::getsockopt(acceptor.socket.Fd(), IPPROTO_TCP, TCP_INFO, &info, &info_len) == 0) {
+                stats.queue_length = info.tcpi_unacked;
+                stats.queue_limit = info.tcpi_sacked;
+            }
+        }
+#endif
+    }
+    return result;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const AcceptorStatsAggregation& stats) {
+    writer["accepted"] = stats.accepted;
+    if (stats.queue_length) writer["accept-queue-length"] = *stats.queue_length;
+    if (stats.queue_limit) writer["accept-queue-limit"] = *stats.queue_limit;
+}
+
+void ListenerImpl::AcceptConnection(Acceptor& acceptor) {
+    auto peer_socket = acceptor.socket.Accept({});
+    ++acceptor.accepted;
+    const auto& port_config = acceptor.port_config;
 
     const auto new_connection_count = ++endpoint_info_->connection_count;
     utils::FastScopeGuard guard{[this]() noexcept { --endpoint_info_->connection_count; }};
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <deque>
 #include <memory>
+#include <vector>
 
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 
 #include "connection.hpp"
 #include "endpoint_info.hpp"
@@ -20,24 +23,37 @@ public:
     ListenerImpl(
         engine::TaskProcessor& task_processor,
         std::shared_ptr<EndpointInfo> endpoint_info,
-        request::ResponseDataAccounter& data_accounter
+        request::ResponseDataAccounter& data_accounter,
+        std::size_t shard
     );
     ~ListenerImpl();
 
     StatsAggregation GetStats() const;
 
+    std::vector<AcceptorStatsAggregation> GetAcceptorStats() const;
+
 private:
-    void AcceptConnection(engine::io::Socket& request_socket, const PortConfig& port_config);
+    struct Acceptor {
+        engine::io::Socket socket;
+        const PortConfig& port_config;
+        utils::statistics::RateCounter accepted{0};
+    };
+
+    void AcceptConnection(Acceptor& acceptor);
     void ProcessConnection(engine::io::Socket peer_socket, const PortConfig& port_config);
 
     engine::TaskProcessor& task_processor_;
     std::shared_ptr<EndpointInfo> endpoint_info_;
+    const std::size_t shard_;
 
     std::shared_ptr<Stats> stats_;
     request::ResponseDataAccounter& data_accounter_;
 
     concurrent::BackgroundTaskStorageCore connections_;
 
+    // Listener tasks reference the elements, so the container must not move them
+    std::deque<Acceptor> acceptors_;
+
     std::vector<engine::TaskWithResult<void>> socket_listener_tasks;
 };
 
@@ -3,9 +3,11 @@
 #include <atomic>
 #include <cstddef>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include <userver/concurrent/striped_counter.hpp>
+#include <userver/utils/statistics/fwd.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -66,6 +68,8 @@ struct Stats {
     ParserStats parser_stats;
     concurrent::StripedCounter active_request_count;
     concurrent::StripedCounter requests_processed_count;
+    utils::statistics::RateCounter bytes_sent_zero_copy{0};
+    utils::statistics::RateCounter bytes_sent_copied{0};
 };
 
 struct StatsAggregation final {
@@ -77,7 +81,9 @@ struct StatsAggregation final {
           connections_closed{stats.connections_closed.load()},
           parser_stats{stats.parser_stats},
           active_request_count{stats.active_request_count.NonNegativeRead()},
-          requests_processed_count{stats.requests_processed_count.Read()} {}
+          requests_processed_count{stats.requests_processed_count.Read()},
+          bytes_sent_zero_copy{stats.bytes_sent_zero_copy.Load()},
+          bytes_sent_copied{stats.bytes_sent_copied.Load()} {}
 
     StatsAggregation& operator+=(const StatsAggregation& other) {
         active_connections += other.active_connections;
@@ -87,6 +93,8 @@ struct StatsAggregation final {
         parser_stats += other.parser_stats;
         active_request_count += other.active_request_count;
         requests_processed_count += other.requests_processed_count;
+        bytes_sent_zero_copy += other.bytes_sent_zero_copy;
+        bytes_sent_copied += other.bytes_sent_copied;
 
         return *this;
     }
@@ -99,8 +107,22 @@ struct StatsAggregation final {
     ParserStatsAggregation parser_stats;
     std::size_t active_request_count{0};
     std::size_t requests_processed_count{0};
+    utils::statistics::Rate bytes_sent_zero_copy{0};
+    utils::statistics::Rate bytes_sent_copied{0};
 };
 
+// Per listening socket, one socket per port in each shard
+struct AcceptorStatsAggregation final {
+    std::string address;
+    std::size_t shard{0};
+    utils::statistics::Rate accepted{0};
+    // Connections waiting for accept() and the effective backlog, Linux only
+    std::optional<std::size_t> queue_length;
+    std::optional<std::size_t> queue_limit;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const AcceptorStatsAggregation& stats);
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
@@ -36,6 +36,10 @@ HttpRequestConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To
     conf.deadline_expired_status_code =
         value["deadline_expired_status_code"].As<http::HttpStatus>(conf.deadline_expired_status_code);
 
+    conf.http1_fast_path_enabled = value["http1_fast_path_enabled"].As<bool>(conf.http1_fast_path_enabled);
+
+    conf.copy_headers_on_access = value["copy_headers_on_access"].As<bool>(conf.copy_headers_on_access);
+
     return conf;
 }
 
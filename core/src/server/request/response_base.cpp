@@ -71,9 +71,20 @@ ResponseBase::~ResponseBase() noexcept {
 }
 
 void ResponseBase::SetData(std::string data) {
-    create_time_ = std::chrono::steady_clock::now();
     data_ = std::move(data);
-    guard_.emplace(accounter_, create_time_, data_.size());
+    AccountData(data_.size());
+}
+
+void ResponseBase::SetBodyChain(utils::impl::BufferChain body) {
+    body_chain_ = std::move(body);
+    AccountData(body_chain_.GetSize());
+}
+
+void ResponseBase::FlattenBodyChain() const {
+    UASSERT(!body_chain_.IsEmpty());
+    // The accounted size stays the same
+    if (data_.empty()) data_ = body_chain_.ToString();
+    body_chain_.Clear();
 }
 
 void ResponseBase::SetReady() { SetReady(std::chrono::steady_clock::now()); }
@@ -96,6 +107,11 @@ void ResponseBase::SetSent(std::size_t bytes_sent, std::chrono::steady_clock::ti
     guard_.reset();
 }
 
+void ResponseBase::AccountData(std::size_t size) {
+    create_time_ = std::chrono::steady_clock::now();
+    guard_.emplace(accounter_, create_time_, size);
+}
+
 void ResponseBase::SetStreamId(std::int32_t stream_id) {
     UASSERT(!stream_id_.has_value());
     stream_id_.emplace(stream_id);
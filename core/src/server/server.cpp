@@ -63,11 +63,12 @@ void PortInfo::Init(
     endpoint_info_ = std::make_shared<net::EndpointInfo>(listener_config, *request_handler_);
 
     const auto& event_thread_pool = task_processor.EventThreadPool();
-    size_t listener_shards = listener_config.shards ? *listener_config.shards : event_thread_pool.GetSize();
+    const size_t listener_shards = listener_config.shards ? *listener_config.shards : event_thread_pool.GetSize();
+    endpoint_info_->listener_shards = listener_shards;
 
     listeners_.reserve(listener_shards);
-    while (listener_shards--) {
-        listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_);
+    for (size_t shard = 0; shard < listener_shards; ++shard) {
+        listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_, shard);
     }
 }
 
@@ -115,6 +116,7 @@ public:
     std::chrono::milliseconds GetAvgRequestTimeMs() const;
     const http::HttpRequestHandler& GetHttpRequestHandler(bool is_monitor) const;
     net::StatsAggregation GetServerStats() const;
+    std::vector<net::AcceptorStatsAggregation> GetAcceptorStats() const;
     const ServerConfig& GetServerConfig() const { return config_; }
     const std::vector<std::string>& GetMiddlewares() const;
 
@@ -261,6 +263,19 @@ net::StatsAggregation ServerImpl::GetServerStats() const {
     return summary;
 }
 
+std::vector<net::AcceptorStatsAggregation> ServerImpl::GetAcceptorStats() const {
+    std::vector<net::AcceptorStatsAggregation> result;
+
+    std::shared_lock lock{on_stop_mutex_};
+    if (is_stopping_) return result;
+    for (const auto& listener : main_port_info_.listeners_) {
+        auto stats = listener.GetAcceptorStats();
+        result.insert(result.end(), std::make_move_iterator(stats.begin()), std::make_move_iterator(stats.end()));
+    }
+
+    return result;
+}
+
 const std::vector<std::string>& ServerImpl::GetMiddlewares() const { return middlewares_; }
 
 RequestsView& ServerImpl::GetRequestsView() {
@@ -344,6 +359,19 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
         http2_request_stats["reset-streams"] = server_stats.parser_stats.reset_streams;
         http2_request_stats["goaway"] = server_stats.parser_stats.goaway;
     }
+
+    if (auto response_stats = writer["responses"]) {
+        auto bytes_sent_stats = response_stats["bytes-sent"];
+        bytes_sent_stats["zero-copy"] = server_stats.bytes_sent_zero_copy;
+        bytes_sent_stats["copied"] = server_stats.bytes_sent_copied;
+    }
+
+    if (auto acceptors_stats = writer["acceptors"]) {
+        for (const auto& acceptor : pimpl->GetAcceptorStats()) {
+            const auto shard = std::to_string(acceptor.shard);
+            acceptors_stats.ValueWithLabels(acceptor, {{"address", acceptor.address}, {"shard", shard}});
+        }
+    }
 }
 
 void Server::WriteTotalHandlerStatistics(utils::statistics::Writer& writer) const {
@@ -1,5 +1,7 @@
 #include <userver/tracing/manager.hpp>
 
+#include <charconv>
+
 #include <userver/engine/task/inherited_variable.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -40,6 +42,13 @@ engine::TaskInheritedVariable<OTelTracingHeadersInheritedData> kOTelTracingHeade
 /// @see TracingHeadersInheritedData for details on the contents.
 engine::TaskInheritedVariable<std::string> kB3TracingSampledInheritedData;
 
+// The lowest bit of the trace-flags is the sampled flag
+bool IsOtelSampled(std::string_view trace_flags) {
+    unsigned flags = 1;
+    std::from_chars(trace_flags.data(), trace_flags.data() + trace_flags.size(), flags, 16);
+    return (flags & 1) != 0;
+}
+
 bool B3TryFillSpanBuilderFromRequest(const server::http::HttpRequest& request, tracing::SpanBuilder& span_builder) {
     namespace b3 = http::headers::b3;
     const auto& trace_id = request.GetHeader(b3::kTraceId);
@@ -56,6 +65,8 @@ bool B3TryFillSpanBuilderFromRequest(const server::http::HttpRequest& request, t
     span_builder.SetTraceId(trace_id);
     span_builder.SetParentSpanId(request.GetHeader(b3::kSpanId));
     span_builder.AddTagFrozen(std::string{kSampledTag}, sampled);
+    // "d" is the debug flag that implies sampling
+    span_builder.SetSampled(sampled != "0" && sampled != "false");
     return true;
 }
 
@@ -100,6 +111,8 @@ bool OpenTelemetryTryFillSpanBuilderFromRequest(
     span_builder.SetParentSpanId(std::move(data.span_id));
     if (data.trace_flags.empty()) {
         data.trace_flags = std::string{kDefaultOtelTraceFlags};
+    } else {
+        span_builder.SetSampled(IsOtelSampled(data.trace_flags));
     }
 
     const auto& tracestate = request.GetHeader(opentelemetry::kTraceState);
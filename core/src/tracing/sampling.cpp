@@ -0,0 +1,177 @@
+#include <tracing/sampling.hpp>
+
+#include <algorithm>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/logging/level.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <tracing/span_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace {
+
+constexpr std::chrono::seconds kAdaptiveWindow{1};
+constexpr double kMinAdaptiveFactor = 1e-4;
+// Do not let the rate grow too fast after a quiet period
+constexpr double kMaxAdaptiveGrowth = 2.0;
+
+}  // namespace
+
+SamplingConfig Parse(const formats::json::Value& value, formats::parse::To<SamplingConfig>) {
+    SamplingConfig ret;
+    ret.enabled = value["enabled"].As<bool>(ret.enabled);
+    ret.default_rate = value["default-rate"].As<double>(ret.default_rate);
+    ret.rates = value["rates"].As<std::unordered_map<std::string, double>>({});
+    ret.spans_per_second = value["spans-per-second"].As<std::size_t>(ret.spans_per_second);
+
+    const auto tail = value["tail"];
+    ret.tail_enabled = tail["enabled"].As<bool>(ret.tail_enabled);
+    ret.tail_latency_threshold =
+        std::chrono::milliseconds{tail["latency-threshold-ms"].As<std::int64_t>(ret.tail_latency_threshold.count())};
+    ret.tail_max_buffered_spans = tail["max-buffered-spans"].As<std::size_t>(ret.tail_max_buffered_spans);
+    ret.tail_max_total_buffered_spans =
+        tail["max-total-buffered-spans"].As<std::size_t>(ret.tail_max_total_buffered_spans);
+
+    return ret;
+}
+
+namespace impl {
+
+double AdaptiveRate::GetFactor(std::size_t spans_per_second, std::chrono::steady_clock::time_point now) noexcept {
+    if (spans_per_second == 0) return 1.0;
+
+    const auto now_ticks = now.time_since_epoch().count();
+    auto window_start = window_start_.load(std::memory_order_relaxed);
+    const auto elapsed = std::chrono::steady_clock::duration{now_ticks - window_start};
+    if (elapsed < kAdaptiveWindow ||
+        !window_start_.compare_exchange_strong(window_start, now_ticks, std::memory_order_relaxed)) {
+        return factor_.load(std::memory_order_relaxed);
+    }
+
+    // Only one thread gets here per window
+    const auto spans = window_spans_.exchange(0, std::memory_order_relaxed);
+    const auto observed = spans / std::chrono::duration<double>(elapsed).count();
+    const auto growth =
+        observed > 0 ? std::min(static_cast<double>(spans_per_second) / observed, kMaxAdaptiveGrowth)
+                     : kMaxAdaptiveGrowth;
+    const auto factor = std::clamp(factor_.load(std::memory_order_relaxed) * growth, kMinAdaptiveFactor, 1.0);
+    factor_.store(factor, std::memory_order_relaxed);
+    return factor;
+}
+
+bool TailBudget::TryAcquire(std::size_t limit) noexcept {
+    if (buffered_spans_.fetch_add(1, std::memory_order_relaxed) < limit) return true;
+
+    buffered_spans_.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const TailBudget& budget) {
+    writer["buffered-spans"] = budget.buffered_spans_.load(std::memory_order_relaxed);
+    writer["dropped-by-budget"] = budget.dropped_spans_;
+}
+
+TraceSampling::TraceSampling(
+    Decision decision,
+    const SamplingConfig& config,
+    AdaptiveRate& adaptive_rate,
+    TailBudget& tail_budget
+)
+    : decision_(decision),
+      tail_enabled_(config.tail_enabled),
+      latency_threshold_(config.tail_latency_threshold),
+      max_buffered_spans_(config.tail_max_buffered_spans),
+      max_total_buffered_spans_(config.tail_max_total_buffered_spans),
+      adaptive_rate_(adaptive_rate),
+      tail_budget_(tail_budget) {}
+
+TraceSampling::~TraceSampling() {
+    // The root span was lost without a decision, do not log partial traces
+    tail_budget_.Release(buffered_.size());
+    for (auto& span : buffered_) {
+        span->log_level_ = logging::Level::kNone;
+    }
+}
+
+TraceSampling::Decision TraceSampling::Defer(std::unique_ptr<Span::Impl>& span) {
+    // Destroyed after the mutex is unlocked
+    std::vector<std::unique_ptr<Span::Impl>> dropped;
+
+    const std::lock_guard lock{mutex_};
+    const auto decision = GetDecision();
+    if (decision != Decision::kPending) return decision;
+
+    // A partial trace is useless, so the whole trace falls back to the head
+    // decision if the span does not fit
+    if (buffered_.size() >= max_buffered_spans_) {
+        DropLocked(dropped);
+        return Decision::kDropped;
+    }
+    if (!tail_budget_.TryAcquire(max_total_buffered_spans_)) {
+        tail_budget_.AccountDropped(DropLocked(dropped) + 1);
+        return Decision::kDropped;
+    }
+
+    has_error_ = has_error_ || span->HasErrorFlag();
+    buffered_.push_back(std::move(span));
+    return Decision::kPending;
+}
+
+void TraceSampling::ApplyUpstreamDecision(bool sampled) {
+    const std::lock_guard lock{mutex_};
+    UASSERT(buffered_.empty());
+
+    if (sampled) {
+        decision_.store(Decision::kSampled, std::memory_order_release);
+    } else if (GetDecision() == Decision::kSampled) {
+        decision_.store(tail_enabled_ ? Decision::kPending : Decision::kDropped, std::memory_order_release);
+    }
+}
+
+std::size_t TraceSampling::DropLocked(std::vector<std::unique_ptr<Span::Impl>>& dropped) {
+    decision_.store(Decision::kDropped, std::memory_order_release);
+    const auto spans = buffered_.size();
+    tail_budget_.Release(spans);
+    for (auto& buffered_span : buffered_) {
+        buffered_span->log_level_ = logging::Level::kNone;
+    }
+    dropped.swap(buffered_);
+    return spans;
+}
+
+void TraceSampling::Decide(std::chrono::steady_clock::duration root_duration, bool root_has_error) {
+    if (GetDecision() != Decision::kPending) return;
+
+    std::vector<std::unique_ptr<Span::Impl>> buffered;
+    {
+        const std::lock_guard lock{mutex_};
+        if (GetDecision() != Decision::kPending) return;
+
+        const bool keep = root_has_error || has_error_ || root_duration >= latency_threshold_;
+        decision_.store(keep ? Decision::kSampled : Decision::kDropped, std::memory_order_release);
+        buffered.swap(buffered_);
+    }
+    tail_budget_.Release(buffered.size());
+
+    if (GetDecision() == Decision::kSampled) {
+        adaptive_rate_.AccountEmitted(buffered.size());
+    } else {
+        for (auto& span : buffered) {
+            span->log_level_ = logging::Level::kNone;
+        }
+    }
+
+    // Buffered spans are written to the log by their destructors
+    buffered.clear();
+}
+
+}  // namespace impl
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+class Value;
+}
+
+namespace tracing {
+
+/// Sampling of whole traces, decided by the root span of the trace.
+/// See @ref USERVER_TRACING_SAMPLING for the meaning of the fields.
+struct SamplingConfig {
+    bool enabled{false};
+
+    // Head sampling: probability to log a trace by the name of its root span
+    double default_rate{1.0};
+    std::unordered_map<std::string, double> rates;
+
+    // Adaptive rate control, 0 means no limit
+    std::size_t spans_per_second{0};
+
+    // Tail-based retention of traces that were not head-sampled
+    bool tail_enabled{false};
+    std::chrono::milliseconds tail_latency_threshold{1000};
+    std::size_t tail_max_buffered_spans{1000};
+    std::size_t tail_max_total_buffered_spans{100000};
+};
+
+SamplingConfig Parse(const formats::json::Value&, formats::parse::To<SamplingConfig>);
+
+namespace impl {
+
+/// Scales head sampling rates to keep the emitted spans count per second
+/// around the configured budget.
+class AdaptiveRate final {
+public:
+    void AccountEmitted(std::size_t spans) noexcept { window_spans_.fetch_add(spans, std::memory_order_relaxed); }
+
+    /// Returns the multiplier for the head sampling rate, recalculating it
+    /// once per second.
+    double GetFactor(std::size_t spans_per_second, std::chrono::steady_clock::time_point now) noexcept;
+
+private:
+    std::atomic<double> factor_{1.0};
+    std::atomic<std::chrono::steady_clock::rep> window_start_{0};
+    std::atomic<std::size_t> window_spans_{0};
+};
+
+/// Process-wide limit on the spans kept in memory by the traces that wait for
+/// the tail decision.
+class TailBudget final {
+public:
+    /// Reserves a place for one more span, returns false if `limit` spans are
+    /// buffered already
+    bool TryAcquire(std::size_t limit) noexcept;
+
+    void Release(std::size_t spans) noexcept { buffered_spans_.fetch_sub(spans, std::memory_order_relaxed); }
+
+    void AccountDropped(std::size_t spans) noexcept { dropped_spans_.Add(utils::statistics::Rate{spans}); }
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const TailBudget& budget);
+
+private:
+    std::atomic<std::size_t> buffered_spans_{0};
+    utils::statistics::RateCounter dropped_spans_;
+};
+
+/// Sampling state of a single trace, shared by all of its local spans.
+class TraceSampling final {
+public:
+    enum class Decision {
+        kPending,
+        kSampled,
+        kDropped,
+    };
+
+    TraceSampling(
+        Decision decision,
+        const SamplingConfig& config,
+        AdaptiveRate& adaptive_rate,
+        TailBudget& tail_budget
+    );
+    ~TraceSampling();
+
+    Decision GetDecision() const noexcept { return decision_.load(std::memory_order_acquire); }
+
+    /// Replaces the local head decision with the one propagated by the
+    /// upstream service. A trace that is not sampled upstream may still be
+    /// kept by the tail sampling. Is called for the root span before any span
+    /// of the trace has finished.
+    void ApplyUpstreamDecision(bool sampled);
+
+    /// Takes ownership of a finished span until the decision is made. If the
+    /// decision has already been made, the span is left in `span` and the
+    /// decision for it is returned. If the trace or the process-wide
+    /// TailBudget has no room for the span, the trace falls back to the head
+    /// decision and is dropped.
+    Decision Defer(std::unique_ptr<Span::Impl>& span);
+
+    /// Makes the tail decision on root span completion, then emits or drops
+    /// the buffered spans. Does nothing if the trace was head-sampled.
+    void Decide(std::chrono::steady_clock::duration root_duration, bool root_has_error);
+
+    void AccountEmitted() noexcept { adaptive_rate_.AccountEmitted(1); }
+
+private:
+    // Drops the trace together with the spans that are already buffered,
+    // returns the buffered spans count
+    std::size_t DropLocked(std::vector<std::unique_ptr<Span::Impl>>& dropped);
+
+    std::atomic<Decision> decision_;
+    const bool tail_enabled_;
+    const std::chrono::steady_clock::duration latency_threshold_;
+    const std::size_t max_buffered_spans_;
+    const std::size_t max_total_buffered_spans_;
+    AdaptiveRate& adaptive_rate_;
+    TailBudget& tail_budget_;
+
+    std::mutex mutex_;
+    bool has_error_{false};
+    std::vector<std::unique_ptr<Span::Impl>> buffered_;
+};
+
+/// Returns the sampling state for a new trace, or nullptr if sampling is
+/// disabled and the trace should be logged as usual.
+std::shared_ptr<TraceSampling> StartTraceSampling(const std::string& root_name);
+
+/// Writes the metrics of the process-wide sampling state
+void WriteSamplingStatistics(utils::statistics::Writer& writer);
+
+}  // namespace impl
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,233 @@
+#include <tracing/sampling.hpp>
+
+#include <gmock/gmock.h>
+
+#include <logging/logging_test.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/tracing/span_builder.hpp>
+#include <userver/tracing/tags.hpp>
+#include <userver/tracing/tracer.hpp>
+#include <userver/utest/utest.hpp>
+
+using testing::HasSubstr;
+using testing::Not;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class SpanSampling : public LoggingTest {
+protected:
+    ~SpanSampling() override { tracing::Tracer::SetSamplingConfig(tracing::SamplingConfig{}); }
+
+    static void SetTailSampling(std::chrono::milliseconds latency_threshold) {
+        tracing::SamplingConfig config;
+        config.enabled = true;
+        config.default_rate = 0.0;
+        config.tail_enabled = true;
+        config.tail_latency_threshold = latency_threshold;
+        tracing::Tracer::SetSamplingConfig(std::move(config));
+    }
+
+    static std::string Logged(std::string_view span_name) { return fmt::format("stopwatch_name={}\t", span_name); }
+};
+
+}  // namespace
+
+UTEST_F(SpanSampling, HeadByName) {
+    tracing::SamplingConfig config;
+    config.enabled = true;
+    config.rates = {{"root_dropped", 0.0}};
+    tracing::Tracer::SetSamplingConfig(std::move(config));
+
+    {
+        auto root = tracing::Span::MakeRootSpan("root_dropped");
+        const tracing::Span child{"child_dropped"};
+    }
+    {
+        auto root = tracing::Span::MakeRootSpan("root_sampled");
+        const tracing::Span child{"child_sampled"};
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("root_dropped"))));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("child_dropped"))));
+    EXPECT_THAT(GetStreamString(), HasSubstr(Logged("root_sampled")));
+    EXPECT_THAT(GetStreamString(), HasSubstr(Logged("child_sampled")));
+}
+
+UTEST_F(SpanSampling, TailDropsFast) {
+    SetTailSampling(std::chrono::seconds{10});
+
+    {
+        auto root = tracing::Span::MakeRootSpan("root_fast");
+        const tracing::Span child{"child_fast"};
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("root_fast"))));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("child_fast"))));
+}
+
+UTEST_F(SpanSampling, TailKeepsSlow) {
+    SetTailSampling(std::chrono::milliseconds{10});
+
+    {
+        auto root = tracing::Span::MakeRootSpan("root_slow");
+        {
+            const tracing::Span child{"child_of_slow"};
+        }
+        engine::SleepFor(std::chrono::milliseconds{20});
+
+        logging::LogFlush();
+        EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("child_of_slow"))));
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), HasSubstr(Logged("root_slow")));
+    EXPECT_THAT(GetStreamString(), HasSubstr(Logged("child_of_slow")));
+}
+
+UTEST_F(SpanSampling, TailKeepsErrors) {
+    SetTailSampling(std::chrono::seconds{10});
+
+    {
+        auto root = tracing::Span::MakeRootSpan("root_failed");
+        tracing::Span child{"child_failed"};
+        child.AddTag(tracing::kErrorFlag, true);
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), HasSubstr(Logged("root_failed")));
+    EXPECT_THAT(GetStreamString(), HasSubstr(Logged("child_failed")));
+}
+
+UTEST_F(SpanSampling, TailChildOutlivesRoot) {
+    SetTailSampling(std::chrono::seconds{10});
+
+    std::optional<tracing::Span> child;
+    {
+        auto root = tracing::Span::MakeRootSpan("root_short");
+        child.emplace(root.CreateChild("child_long"));
+    }
+    child.reset();
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("root_short"))));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("child_long"))));
+}
+
+UTEST_F(SpanSampling, TailBudgetExhausted) {
+    tracing::SamplingConfig config;
+    config.enabled = true;
+    config.default_rate = 0.0;
+    config.tail_enabled = true;
+    config.tail_latency_threshold = std::chrono::milliseconds{10};
+    config.tail_max_total_buffered_spans = 1;
+    tracing::Tracer::SetSamplingConfig(std::move(config));
+
+    {
+        auto root = tracing::Span::MakeRootSpan("root_over_budget");
+        {
+            const tracing::Span child{"child_buffered"};
+        }
+        {
+            // Does not fit into the budget, the whole trace is dropped
+            const tracing::Span child{"child_over_budget"};
+        }
+        engine::SleepFor(std::chrono::milliseconds{20});
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("root_over_budget"))));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("child_buffered"))));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("child_over_budget"))));
+}
+
+UTEST_F(SpanSampling, TailTraceOverflow) {
+    tracing::SamplingConfig config;
+    config.enabled = true;
+    config.default_rate = 0.0;
+    config.tail_enabled = true;
+    config.tail_latency_threshold = std::chrono::milliseconds{10};
+    config.tail_max_buffered_spans = 1;
+    tracing::Tracer::SetSamplingConfig(std::move(config));
+
+    {
+        auto root = tracing::Span::MakeRootSpan("root_overflow");
+        {
+            const tracing::Span child{"child_buffered"};
+        }
+        {
+            // Does not fit into the trace buffer, the whole trace is dropped
+            const tracing::Span child{"child_overflow"};
+        }
+        engine::SleepFor(std::chrono::milliseconds{20});
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("root_overflow"))));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("child_buffered"))));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("child_overflow"))));
+}
+
+UTEST_F(SpanSampling, UpstreamDecision) {
+    tracing::SamplingConfig config;
+    config.enabled = true;
+    config.rates = {{"root_upstream_sampled", 0.0}};
+    tracing::Tracer::SetSamplingConfig(std::move(config));
+
+    for (const bool sampled : {true, false}) {
+        tracing::SpanBuilder builder{sampled ? "root_upstream_sampled" : "root_upstream_dropped"};
+        builder.SetTraceId("0123456789abcdef0123456789abcdef");
+        builder.SetParentSpanId("0123456789abcdef");
+        builder.SetSampled(sampled);
+        auto root = std::move(builder).Build();
+        const tracing::Span child{sampled ? "child_upstream_sampled" : "child_upstream_dropped"};
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), HasSubstr(Logged("root_upstream_sampled")));
+    EXPECT_THAT(GetStreamString(), HasSubstr(Logged("child_upstream_sampled")));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("root_upstream_dropped"))));
+    EXPECT_THAT(GetStreamString(), Not(HasSubstr(Logged("child_upstream_dropped"))));
+}
+
+TEST(SpanSamplingTailBudget, Limit) {
+    tracing::impl::TailBudget budget;
+
+    EXPECT_TRUE(budget.TryAcquire(2));
+    EXPECT_TRUE(budget.TryAcquire(2));
+    EXPECT_FALSE(budget.TryAcquire(2));
+
+    budget.Release(1);
+    EXPECT_TRUE(budget.TryAcquire(2));
+    EXPECT_FALSE(budget.TryAcquire(2));
+}
+
+TEST(SpanSamplingAdaptiveRate, Factor) {
+    tracing::impl::AdaptiveRate rate;
+    auto now = std::chrono::steady_clock::now();
+
+    EXPECT_EQ(rate.GetFactor(0, now), 1.0);
+    EXPECT_EQ(rate.GetFactor(100, now), 1.0);
+
+    rate.AccountEmitted(400);
+    now += std::chrono::seconds{1};
+    EXPECT_DOUBLE_EQ(rate.GetFactor(100, now), 0.25);
+
+    // The factor is updated once per second
+    rate.AccountEmitted(50);
+    now += std::chrono::milliseconds{500};
+    EXPECT_DOUBLE_EQ(rate.GetFactor(100, now), 0.25);
+
+    // Growth is limited
+    now += std::chrono::milliseconds{500};
+    EXPECT_DOUBLE_EQ(rate.GetFactor(100, now), 0.5);
+
+    now += std::chrono::seconds{1};
+    EXPECT_DOUBLE_EQ(rate.GetFactor(100, now), 1.0);
+}
+
+USERVER_NAMESPACE_END
@@ -1,12 +1,15 @@
 #include <tracing/span_impl.hpp>
 
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
@@ -15,8 +18,6 @@
 #include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/encoding/hex.hpp>
-#include <userver/utils/rand.hpp>
 #include <userver/utils/uuid4.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -61,13 +62,49 @@ TsBuffer StartTsToString(std::chrono::system_clock::time_point start) {
 // Maintain coro-local span stack to identify "current span" in O(1).
 engine::TaskLocalVariable<SpanStack> task_local_spans;
 
-std::string GenerateSpanId() {
-    std::uniform_int_distribution<std::uint64_t> dist;
-    const auto random_value = utils::WithDefaultRandom(dist);
+// Keeps the memory of destroyed Span::Impl objects for reuse by the spans
+// created on the same thread
+class SpanImplPool final {
+public:
+    static constexpr std::size_t kMaxSize = 32;
 
-    static_assert(sizeof(random_value) == 8);
-    return utils::encoding::ToHex(&random_value, 8);
-}
+    SpanImplPool() = default;
+    SpanImplPool(SpanImplPool&&) = delete;
+    SpanImplPool& operator=(SpanImplPool&&) = delete;
+
+    ~SpanImplPool() {
+        while (head_) {
+            ::operator delete(std::exchange(head_, head_->next));
+        }
+    }
+
+    void* Allocate() {
+        if (!head_) return ::operator new(sizeof(Span::Impl));
+
+        --size_;
+        return std::exchange(head_, head_->next);
+    }
+
+    void Deallocate(void* storage) noexcept {
+        if (size_ == kMaxSize) {
+            ::operator delete(storage);
+            return;
+        }
+
+        ++size_;
+        head_ = new (storage) FreeNode{head_};
+    }
+
+private:
+    struct FreeNode final {
+        FreeNode* next;
+    };
+
+    FreeNode* head_{nullptr};
+    std::size_t size_{0};
+};
+
+compiler::ThreadLocal local_span_impl_pool = [] { return SpanImplPool{}; };
 
 std::string MakeTagFromEvents(const std::vector<SpanEvent>& events) {
     formats::json::StringBuilder builder;
@@ -106,19 +143,27 @@ Span::Impl::Impl(
       tracer_(std::move(tracer)),
       start_system_time_(std::chrono::system_clock::now()),
       start_steady_time_(std::chrono::steady_clock::now()),
-      trace_id_(parent ? parent->GetTraceId() : utils::generators::GenerateUuid()),
-      span_id_(GenerateSpanId()),
+      trace_id_(parent ? parent->trace_id_ : impl::TracingId::GenerateTraceId()),
+      span_id_(impl::TracingId::GenerateSpanId()),
       parent_id_(GetParentIdForLogging(parent)),
       reference_type_(reference_type),
       source_location_(source_location) {
     if (parent) {
         log_extra_inheritable_ = parent->log_extra_inheritable_;
         local_log_level_ = parent->local_log_level_;
+        trace_sampling_ = parent->trace_sampling_;
+    } else {
+        trace_sampling_ = impl::StartTraceSampling(name_);
+        is_sampling_root_ = (trace_sampling_ != nullptr);
     }
 }
 
 Span::Impl::~Impl() {
-    if (!ShouldLog()) {
+    if (is_sampling_root_ && trace_sampling_) {
+        trace_sampling_->Decide(std::chrono::steady_clock::now() - start_steady_time_, HasErrorFlag());
+    }
+
+    if (!ShouldLog() || !PassSampling()) {
         return;
     }
 
@@ -130,7 +175,7 @@ Span::Impl::~Impl() {
 }
 
 void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
-    const auto steady_now = std::chrono::steady_clock::now();
+    const auto steady_now = finish_steady_time_ ? *finish_steady_time_ : std::chrono::steady_clock::now();
     const auto duration = steady_now - start_steady_time_;
     const auto total_time_ms = std::chrono::duration_cast<RealMilliseconds>(duration).count();
     const auto timestamp_buffer = StartTsToString(start_system_time_);
@@ -168,6 +213,19 @@ void Span::Impl::LogTo(logging::impl::TagWriter writer) {
     tracer_->LogSpanContextTo(*this, writer);
 }
 
+void Span::Impl::SetUpstreamSampled(bool sampled) {
+    if (is_sampling_root_) trace_sampling_->ApplyUpstreamDecision(sampled);
+}
+
+bool Span::Impl::HasErrorFlag() const {
+    const auto has_error = [](const logging::LogExtra& log_extra) {
+        // bool tags are stored as int
+        const auto* flag = std::get_if<int>(&log_extra.GetValue(tracing::kErrorFlag));
+        return flag && *flag != 0;
+    };
+    return has_error(log_extra_inheritable_) || (log_extra_local_ && has_error(*log_extra_local_));
+}
+
 void Span::Impl::DetachFromCoroStack() { unlink(); }
 
 void Span::Impl::AttachToCoroStack() {
@@ -175,11 +233,11 @@ void Span::Impl::AttachToCoroStack() {
     task_local_spans->push_back(*this);
 }
 
-std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
+impl::TracingId Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
     if (!parent) return {};
 
     if (!parent->is_linked()) {
-        return parent->GetSpanId();
+        return parent->span_id_;
     }
 
     const auto* spans_ptr = task_local_spans.GetOptional();
@@ -192,8 +250,8 @@ std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
     // orphaned. It's still possible for chaining to break in case parent span
     // becomes non-loggable after child span is created, but that we can't control
     for (auto current = spans_ptr->iterator_to(*parent);; --current) {
-        if (current->GetParentId().empty() /* won't find better candidate */ || current->ShouldLog()) {
-            return current->GetSpanId();
+        if (current->parent_id_.IsEmpty() /* won't find better candidate */ || current->ShouldLog()) {
+            return current->span_id_;
         }
         if (current == spans_ptr->begin()) break;
     }
@@ -209,9 +267,39 @@ bool Span::Impl::ShouldLog() const {
            local_log_level_.value_or(logging::Level::kTrace) <= log_level_;
 }
 
+bool Span::Impl::PassSampling() {
+    if (!trace_sampling_) return true;
+
+    using Decision = impl::TraceSampling::Decision;
+    auto decision = trace_sampling_->GetDecision();
+    if (decision == Decision::kPending) {
+        // Keep the span until the root span decides the fate of the trace.
+        // The moved out copy has no sampling state and is logged as usual
+        // by its destructor, unless the trace gets dropped.
+        auto sampling = std::move(trace_sampling_);
+        finish_steady_time_ = std::chrono::steady_clock::now();
+        auto deferred = std::make_unique<Impl>(std::move(*this));
+        decision = sampling->Defer(deferred);
+        if (deferred) {
+            // The decision has been made concurrently, or the buffer is full
+            if (decision == Decision::kSampled) {
+                sampling->AccountEmitted();
+            } else {
+                deferred->log_level_ = logging::Level::kNone;
+            }
+        }
+        return false;
+    }
+
+    if (decision == Decision::kDropped) return false;
+    trace_sampling_->AccountEmitted();
+    return true;
+}
+
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
     if (do_delete) {
-        std::default_delete<Impl>{}(impl);
+        impl->~Impl();
+        impl::DeallocateSpanImplStorage(impl);
     }
 }
 
@@ -260,7 +348,7 @@ Span::Span(
           Span::OptionalDeleter{OptionalDeleter::ShouldDelete()}
       ) {
     AttachToCoroStack();
-    if (pimpl_->GetParentId().empty()) {
+    if (pimpl_->GetRawParentId().IsEmpty()) {
         SetLink(utils::generators::GenerateUuid());
     }
     pimpl_->span_ = this;
@@ -429,6 +517,16 @@ const Span::Impl* GetParentSpanImpl() {
 
 namespace impl {
 
+void* AllocateSpanImplStorage() {
+    auto pool = local_span_impl_pool.Use();
+    return pool->Allocate();
+}
+
+void DeallocateSpanImplStorage(void* storage) noexcept {
+    auto pool = local_span_impl_pool.Use();
+    pool->Deallocate(storage);
+}
+
 struct DetachLocalSpansScope::Impl {
     SpanStack old_spans;
 };
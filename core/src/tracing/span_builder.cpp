@@ -22,7 +22,7 @@ SpanBuilder::SpanBuilder(std::string name, const utils::impl::SourceLocation& lo
           Span::OptionalDeleter{Span::OptionalDeleter::ShouldDelete()}
       ) {
     pimpl_->AttachToCoroStack();
-    if (pimpl_->GetParentId().empty()) {
+    if (pimpl_->GetRawParentId().IsEmpty()) {
         AddTagFrozen(kLinkTag, utils::generators::GenerateUuid());
     }
 }
@@ -46,6 +46,8 @@ void SpanBuilder::AddNonInheritableTag(std::string key, logging::LogExtra::Value
 
 void SpanBuilder::SetParentLink(std::string parent_link) { AddTagFrozen(kParentLinkTag, std::move(parent_link)); }
 
+void SpanBuilder::SetSampled(bool sampled) { pimpl_->SetUpstreamSampled(sampled); }
+
 Span SpanBuilder::Build() && { return Span(std::move(pimpl_)); }
 
 }  // namespace tracing
@@ -18,7 +18,9 @@
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
 
+#include <tracing/sampling.hpp>
 #include <tracing/time_storage.hpp>
+#include <tracing/tracing_id.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -58,20 +60,27 @@ public:
     // Add the context of this Span a non-Span-specific log record
     void LogTo(logging::impl::TagWriter writer);
 
-    const std::string& GetTraceId() const& noexcept { return trace_id_; }
-    const std::string& GetSpanId() const& noexcept { return span_id_; }
-    const std::string& GetParentId() const& noexcept { return parent_id_; }
+    const std::string& GetTraceId() const& { return trace_id_.GetString(); }
+    const std::string& GetSpanId() const& { return span_id_.GetString(); }
+    const std::string& GetParentId() const& { return parent_id_.GetString(); }
 
-    std::string GetTraceId() && noexcept { return std::move(trace_id_); }
-    std::string GetSpanId() && noexcept { return std::move(span_id_); }
-    std::string GetParentId() && noexcept { return std::move(parent_id_); }
+    // Ids without the string encoding, for writing them to logs
+    const impl::TracingId& GetRawTraceId() const noexcept { return trace_id_; }
+    const impl::TracingId& GetRawSpanId() const noexcept { return span_id_; }
+    const impl::TracingId& GetRawParentId() const noexcept { return parent_id_; }
 
-    void SetTraceId(std::string&& id) noexcept { trace_id_ = std::move(id); }
-    void SetSpanId(std::string&& id) noexcept { span_id_ = std::move(id); }
-    void SetParentId(std::string&& id) noexcept { parent_id_ = std::move(id); }
+    void SetTraceId(std::string&& id) noexcept { trace_id_ = impl::TracingId{std::move(id)}; }
+    void SetSpanId(std::string&& id) noexcept { span_id_ = impl::TracingId{std::move(id)}; }
+    void SetParentId(std::string&& id) noexcept { parent_id_ = impl::TracingId{std::move(id)}; }
+
+    // Makes a trace that continues the upstream one follow its sampling
+    void SetUpstreamSampled(bool sampled);
 
     ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
+    // Whether the span or its inherited tags mark the operation as failed
+    bool HasErrorFlag() const;
+
     void DetachFromCoroStack();
     void AttachToCoroStack();
 
@@ -80,11 +89,15 @@ private:
     void DoLogOpenTracing(logging::impl::TagWriter writer) const;
     static void AddOpentracingTags(formats::json::StringBuilder& output, const logging::LogExtra& input);
 
-    static std::string GetParentIdForLogging(const Span::Impl* parent);
+    static impl::TracingId GetParentIdForLogging(const Span::Impl* parent);
     bool ShouldLog() const;
 
+    // Returns false if the span was buffered or dropped by the trace sampling
+    bool PassSampling();
+
     const std::string name_;
     const bool is_no_log_span_;
+    bool is_sampling_root_{false};
     logging::Level log_level_;
     std::optional<logging::Level> local_log_level_;
 
@@ -99,17 +112,22 @@ private:
     const std::chrono::system_clock::time_point start_system_time_;
     const std::chrono::steady_clock::time_point start_steady_time_;
 
-    std::string trace_id_;
-    std::string span_id_;
-    std::string parent_id_;
+    impl::TracingId trace_id_;
+    impl::TracingId span_id_;
+    impl::TracingId parent_id_;
     const ReferenceType reference_type_;
     utils::impl::SourceLocation source_location_;
 
     std::vector<SpanEvent> events_;
 
+    std::shared_ptr<impl::TraceSampling> trace_sampling_;
+    // Set for the spans that are logged after they have finished
+    std::optional<std::chrono::steady_clock::time_point> finish_steady_time_;
+
     friend class Span;
     friend class SpanBuilder;
     friend class TagScope;
+    friend class impl::TraceSampling;
 };
 
 // Use list instead of stack to avoid UB in case of "pop non-last item"
@@ -118,9 +136,24 @@ using SpanStack = boost::intrusive::list<Span::Impl, boost::intrusive::constant_
 
 const Span::Impl* GetParentSpanImpl();
 
+namespace impl {
+
+// Memory for Span::Impl is reused through a small thread-local pool, as
+// spans are created and destroyed for every request, client call and query
+void* AllocateSpanImplStorage();
+void DeallocateSpanImplStorage(void* storage) noexcept;
+
+}  // namespace impl
+
 template <typename... Args>
 Span::Impl* AllocateImpl(Args&&... args) {
-    return new Span::Impl(std::forward<Args>(args)...);
+    void* storage = impl::AllocateSpanImplStorage();
+    try {
+        return new (storage) Span::Impl(std::forward<Args>(args)...);
+    } catch (...) {
+        impl::DeallocateSpanImplStorage(storage);
+        throw;
+    }
 }
 
 }  // namespace tracing
@@ -4,6 +4,7 @@
 #include <logging/log_helper_impl.hpp>
 #include <logging/logging_test.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/span_impl.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/tracing/opentelemetry.hpp>
@@ -779,4 +780,30 @@ UTEST_F(Span, IsCompatibleWithOpentelemetry) {
     EXPECT_EQ(otel_data.value().trace_flags, kFlags);
 }
 
+UTEST_F(Span, IdsInLogs) {
+    const auto& parent = tracing::Span::CurrentSpan();
+    std::string expected_ids;
+    {
+        const tracing::Span span{"span_with_ids"};
+        EXPECT_EQ(span.GetTraceId(), parent.GetTraceId());
+        EXPECT_EQ(span.GetParentId(), parent.GetSpanId());
+        EXPECT_EQ(span.GetSpanId().size(), 16);
+        expected_ids = fmt::format(
+            "trace_id={}\tspan_id={}\tparent_id={}", span.GetTraceId(), span.GetSpanId(), span.GetParentId()
+        );
+    }
+    logging::LogFlush();
+
+    EXPECT_THAT(GetStreamString(), HasSubstr(expected_ids));
+}
+
+UTEST(SpanImplStorage, Reused) {
+    auto* storage = tracing::impl::AllocateSpanImplStorage();
+    tracing::impl::DeallocateSpanImplStorage(storage);
+
+    auto* reused = tracing::impl::AllocateSpanImplStorage();
+    EXPECT_EQ(reused, storage);
+    tracing::impl::DeallocateSpanImplStorage(reused);
+}
+
 USERVER_NAMESPACE_END
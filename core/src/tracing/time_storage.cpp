@@ -4,7 +4,6 @@
 #include <fmt/format.h>
 
 #include <userver/logging/impl/tag_writer.hpp>
-#include <userver/utils/algo.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -18,10 +17,21 @@ constexpr auto kNsInMs = 1'000'000;
 
 namespace tracing::impl {
 
-void TimeStorage::PushLap(const std::string& key, Duration value) { data_[key] += value; }
+void TimeStorage::PushLap(const std::string& key, Duration value) {
+    for (auto& [stored_key, total] : data_) {
+        if (stored_key == key) {
+            total += value;
+            return;
+        }
+    }
+    data_.emplace_back(key, value);
+}
 
 TimeStorage::Duration TimeStorage::DurationTotal(const std::string& key) const {
-    return utils::FindOrDefault(data_, key, Duration{0});
+    for (const auto& [stored_key, total] : data_) {
+        if (stored_key == key) return total;
+    }
+    return Duration{0};
 }
 
 void TimeStorage::MergeInto(logging::impl::TagWriter writer) {
@@ -2,7 +2,9 @@
 
 #include <chrono>
 #include <string>
-#include <unordered_map>
+#include <utility>
+
+#include <boost/container/small_vector.hpp>
 
 #include <userver/logging/log_extra.hpp>
 
@@ -33,7 +35,11 @@ public:
     void MergeInto(logging::impl::TagWriter writer);
 
 private:
-    std::unordered_map<std::string, Duration> data_;
+    // Spans rarely have more than a few scopes, a linear search in the inline
+    // storage is faster than hashing and does not allocate
+    static constexpr std::size_t kInlineScopes = 4;
+
+    boost::container::small_vector<std::pair<std::string, Duration>, kInlineScopes> data_;
 };
 
 }  // namespace tracing::impl
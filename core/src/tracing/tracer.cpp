@@ -4,9 +4,11 @@
 
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/utils/rand.hpp>
 #include <userver/utils/uuid4.hpp>
 
 #include <tracing/no_log_spans.hpp>
+#include <tracing/sampling.hpp>
 #include <tracing/span_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -27,9 +29,10 @@ public:
 };
 
 void NoopTracer::LogSpanContextTo(const Span::Impl& span, logging::impl::TagWriter writer) const {
-    writer.PutTag(kTraceIdName, span.GetTraceId());
-    writer.PutTag(kSpanIdName, span.GetSpanId());
-    writer.PutTag(kParentIdName, span.GetParentId());
+    impl::TracingId::Buffer buffer;
+    writer.PutTag(kTraceIdName, span.GetRawTraceId().ToStringView(buffer));
+    writer.PutTag(kSpanIdName, span.GetRawSpanId().ToStringView(buffer));
+    writer.PutTag(kParentIdName, span.GetRawParentId().ToStringView(buffer));
 }
 
 auto& GlobalNoLogSpans() {
@@ -37,6 +40,21 @@ auto& GlobalNoLogSpans() {
     return spans;
 }
 
+auto& GlobalSamplingConfig() {
+    static rcu::Variable<SamplingConfig> config{};
+    return config;
+}
+
+auto& GlobalAdaptiveRate() {
+    static impl::AdaptiveRate adaptive_rate;
+    return adaptive_rate;
+}
+
+auto& GlobalTailBudget() {
+    static impl::TailBudget tail_budget;
+    return tail_budget;
+}
+
 auto& GlobalTracer() {
     static rcu::Variable<TracerPtr> tracer(tracing::MakeTracer({}, {}));
     return tracer;
@@ -77,6 +95,8 @@ bool Tracer::IsNoLogSpan(const std::string& name) {
     return ValueMatchesOneOfPrefixes(name, spans->prefixes) || spans->names.find(name) != spans->names.end();
 }
 
+void Tracer::SetSamplingConfig(SamplingConfig&& config) { GlobalSamplingConfig().Assign(std::move(config)); }
+
 void Tracer::SetTracer(std::shared_ptr<Tracer> tracer) { GlobalTracer().Assign(std::move(tracer)); }
 
 std::shared_ptr<Tracer> Tracer::GetTracer() { return GlobalTracer().ReadCopy(); }
@@ -102,6 +122,30 @@ Span Tracer::CreateSpan(std::string name, const Span& parent, ReferenceType refe
     return Span(shared_from_this(), std::move(name), &parent, reference_type);
 }
 
+namespace impl {
+
+std::shared_ptr<TraceSampling> StartTraceSampling(const std::string& root_name) {
+    const auto config = GlobalSamplingConfig().Read();
+    if (!config->enabled) return nullptr;
+
+    const auto it = config->rates.find(root_name);
+    const auto rate = (it == config->rates.end() ? config->default_rate : it->second);
+
+    auto& adaptive_rate = GlobalAdaptiveRate();
+    const auto factor = adaptive_rate.GetFactor(config->spans_per_second, std::chrono::steady_clock::now());
+
+    using Decision = TraceSampling::Decision;
+    auto decision = Decision::kSampled;
+    if (rate * factor < 1.0 && utils::RandRange(1.0) >= rate * factor) {
+        decision = config->tail_enabled ? Decision::kPending : Decision::kDropped;
+    }
+    return std::make_shared<TraceSampling>(decision, *config, adaptive_rate, GlobalTailBudget());
+}
+
+void WriteSamplingStatistics(utils::statistics::Writer& writer) { writer["tail"] = GlobalTailBudget(); }
+
+}  // namespace impl
+
 tracing::TracerPtr MakeTracer(std::string_view service_name, logging::LoggerPtr logger, std::string_view tracer_type) {
     UINVARIANT(tracer_type == "native", "Only 'native' tracer type is available at the moment");
     return std::make_shared<tracing::NoopTracer>(service_name, std::move(logger));
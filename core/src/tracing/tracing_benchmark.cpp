@@ -3,6 +3,7 @@
 #include <userver/engine/run_standalone.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/null_logger.hpp>
+#include <userver/tracing/span.hpp>
 #include <userver/tracing/tracer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -32,6 +33,34 @@ void tracing_happy_log(benchmark::State& state) {
 }
 BENCHMARK(tracing_happy_log);
 
+void tracing_child_ctr(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        tracing::Span parent{"parent"};
+
+        for ([[maybe_unused]] auto _ : state) {
+            tracing::Span span{"child"};
+            benchmark::DoNotOptimize(span);
+        }
+    });
+}
+BENCHMARK(tracing_child_ctr);
+
+void tracing_child_scope_time(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        tracing::Span parent{"parent"};
+
+        for ([[maybe_unused]] auto _ : state) {
+            tracing::Span span{"child"};
+            {
+                const auto scope_time = span.CreateScopeTime("connect");
+            }
+            const auto scope_time = span.CreateScopeTime("query");
+            benchmark::DoNotOptimize(span);
+        }
+    });
+}
+BENCHMARK(tracing_child_scope_time);
+
 tracing::Span GetSpanWithOpentracingHttpTags(tracing::TracerPtr tracer) {
     auto span = tracer->CreateSpanWithoutParent("name");
     span.AddTag("meta_code", 200);
@@ -0,0 +1,90 @@
+#include <tracing/tracing_id.hpp>
+
+#include <cstring>
+#include <random>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/boost_uuid4.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+namespace {
+
+constexpr std::string_view kXdigits = "0123456789abcdef";
+
+}  // namespace
+
+TracingId::TracingId(const TracingId& other)
+    : binary_(other.binary_), binary_size_(other.binary_size_), foreign_(other.foreign_) {}
+
+TracingId::TracingId(TracingId&& other) noexcept
+    : binary_(other.binary_),
+      binary_size_(other.binary_size_),
+      foreign_(std::move(other.foreign_)),
+      encoded_(other.encoded_.exchange(nullptr)) {}
+
+TracingId& TracingId::operator=(TracingId&& other) noexcept {
+    if (this == &other) return *this;
+
+    binary_ = other.binary_;
+    binary_size_ = other.binary_size_;
+    foreign_ = std::move(other.foreign_);
+    delete encoded_.exchange(other.encoded_.exchange(nullptr));
+    return *this;
+}
+
+TracingId::~TracingId() { delete encoded_.load(); }
+
+TracingId TracingId::GenerateTraceId() {
+    const auto uuid = utils::generators::GenerateBoostUuid();
+    static_assert(sizeof(uuid.data) == kMaxBinarySize);
+
+    TracingId result;
+    std::memcpy(result.binary_.data(), uuid.data, sizeof(uuid.data));
+    result.binary_size_ = sizeof(uuid.data);
+    return result;
+}
+
+TracingId TracingId::GenerateSpanId() {
+    std::uniform_int_distribution<std::uint64_t> dist;
+    const auto random_value = utils::WithDefaultRandom(dist);
+
+    TracingId result;
+    std::memcpy(result.binary_.data(), &random_value, sizeof(random_value));
+    result.binary_size_ = sizeof(random_value);
+    return result;
+}
+
+std::string_view TracingId::ToStringView(Buffer& buffer) const noexcept {
+    if (binary_size_ == 0) return foreign_;
+
+    UASSERT(binary_size_ <= kMaxBinarySize);
+    for (std::size_t i = 0; i < binary_size_; ++i) {
+        buffer[i * 2] = kXdigits[binary_[i] >> 4];
+        buffer[i * 2 + 1] = kXdigits[binary_[i] & 0xf];
+    }
+    return {buffer.data(), binary_size_ * std::size_t{2}};
+}
+
+const std::string& TracingId::GetString() const {
+    if (binary_size_ == 0) return foreign_;
+
+    auto* encoded = encoded_.load(std::memory_order_acquire);
+    if (encoded) return *encoded;
+
+    Buffer buffer;
+    auto* result = new std::string(ToStringView(buffer));
+    if (!encoded_.compare_exchange_strong(encoded, result, std::memory_order_acq_rel)) {
+        // Another thread has encoded the id concurrently
+        delete result;
+        return *encoded;
+    }
+    return *result;
+}
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+/// Trace, span or parent span id of a tracing::Span.
+///
+/// Generated ids are kept in binary form and are hex-encoded only when
+/// written or requested as a string. Ids received from the outside are kept
+/// as is.
+class TracingId final {
+public:
+    static constexpr std::size_t kMaxBinarySize = 16;
+    using Buffer = std::array<char, kMaxBinarySize * 2>;
+
+    TracingId() noexcept = default;
+    explicit TracingId(std::string id) noexcept : foreign_(std::move(id)) {}
+
+    TracingId(const TracingId& other);
+    TracingId(TracingId&& other) noexcept;
+    TracingId& operator=(TracingId&& other) noexcept;
+    ~TracingId();
+
+    /// Random id in the format of utils::generators::GenerateUuid
+    static TracingId GenerateTraceId();
+
+    /// Random 64-bit id
+    static TracingId GenerateSpanId();
+
+    bool IsEmpty() const noexcept { return binary_size_ == 0 && foreign_.empty(); }
+
+    /// Returns the encoded id, `buffer` should outlive the result
+    std::string_view ToStringView(Buffer& buffer) const noexcept;
+
+    /// Returns the encoded id that lives as long as *this, the encoding is
+    /// done once. Thread-safe.
+    const std::string& GetString() const;
+
+private:
+    std::array<unsigned char, kMaxBinarySize> binary_{};
+    std::uint8_t binary_size_{0};
+    std::string foreign_;
+    mutable std::atomic<std::string*> encoded_{nullptr};
+};
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
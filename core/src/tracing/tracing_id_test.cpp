@@ -0,0 +1,54 @@
+#include <tracing/tracing_id.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/encoding/hex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+using tracing::impl::TracingId;
+
+TEST(TracingId, Generated) {
+    TracingId::Buffer buffer;
+
+    const auto trace_id = TracingId::GenerateTraceId();
+    EXPECT_EQ(trace_id.ToStringView(buffer).size(), 32);
+    EXPECT_EQ(trace_id.ToStringView(buffer), trace_id.GetString());
+    EXPECT_TRUE(utils::encoding::IsHexData(trace_id.GetString()));
+
+    const auto span_id = TracingId::GenerateSpanId();
+    EXPECT_EQ(span_id.ToStringView(buffer).size(), 16);
+    EXPECT_EQ(span_id.ToStringView(buffer), span_id.GetString());
+    EXPECT_TRUE(utils::encoding::IsHexData(span_id.GetString()));
+
+    EXPECT_NE(TracingId::GenerateSpanId().GetString(), span_id.GetString());
+}
+
+TEST(TracingId, Foreign) {
+    const TracingId id{std::string{"some-trace-id"}};
+    TracingId::Buffer buffer;
+
+    EXPECT_FALSE(id.IsEmpty());
+    EXPECT_EQ(id.ToStringView(buffer), "some-trace-id");
+    EXPECT_EQ(id.GetString(), "some-trace-id");
+
+    EXPECT_TRUE(TracingId{}.IsEmpty());
+    EXPECT_EQ(TracingId{}.GetString(), "");
+}
+
+TEST(TracingId, CopyAndMove) {
+    const auto span_id = TracingId::GenerateSpanId();
+    const auto& encoded = span_id.GetString();
+
+    TracingId copy{span_id};
+    EXPECT_EQ(copy.GetString(), encoded);
+
+    TracingId moved{std::move(copy)};
+    EXPECT_EQ(moved.GetString(), encoded);
+
+    moved = TracingId{std::string{"other"}};
+    EXPECT_EQ(moved.GetString(), "other");
+    EXPECT_EQ(span_id.GetString(), encoded);
+}
+
+USERVER_NAMESPACE_END
@@ -39,6 +39,10 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config, cons
     LoggerConfig logger_config;
     logger_config.max_queue_size = config["max-queue-size"].As<size_t>(65535);
     logger_config.max_batch_delay = config["max-batch-delay"].As<std::chrono::milliseconds>(100);
+    logger_config.max_batch_size = config["max-batch-size"].As<size_t>(logger_config.max_batch_size);
+    if (config["compression"].As<std::string>("none") == "gzip") {
+        logger_config.compression = GRPC_COMPRESS_GZIP;
+    }
     logger_config.service_name = config["service-name"].As<std::string>("unknown_service");
     logger_config.log_level = config["log-level"].As<USERVER_NAMESPACE::logging::Level>();
     logger_config.extra_attributes = config["extra-attributes"].As<std::unordered_map<std::string, std::string>>({});
@@ -85,6 +89,9 @@ LoggerComponent::LoggerComponent(const components::ComponentConfig& config, cons
         statistics_holder_ =
             statistics_storage->GetStorage().RegisterWriter("logger", [this](utils::statistics::Writer& writer) {
                 writer.ValueWithLabels(logger_->GetStatistics(), {"logger", "default"});
+
+                auto exporter_writer = writer["otlp-exporter"];
+                logger_->WriteExporterStatistics(exporter_writer);
             });
     }
 }
@@ -119,6 +126,16 @@ properties:
     max-batch-delay:
         type: string
         description: max delay between send batches (e.g. 100ms or 1s)
+    max-batch-size:
+        type: integer
+        description: max number of logs or spans in a batch, a full batch is sent without waiting for max-batch-delay
+        defaultDescription: 512
+        minimum: 1
+    compression:
+        type: string
+        enum: [none, gzip]
+        description: compression of the export requests
+        defaultDescription: none
     service-name:
         type: string
         description: service name
@@ -1,8 +1,10 @@
 #include "logger.hpp"
 
+#include <array>
 #include <chrono>
 
 #include <fmt/format.h>
+#include <google/protobuf/arena.h>
 
 #include <userver/engine/async.hpp>
 #include <userver/formats/json.hpp>
@@ -31,6 +33,65 @@ constexpr std::string_view kServiceName = "service.name";
 
 const std::string kTimestampFormat = "%Y-%m-%dT%H:%M:%E*S";
 
+// Batches are built in arenas that keep this block between the batches
+constexpr std::size_t kArenaInitialBlockSize = 256 * 1024;
+constexpr std::size_t kArenaMaxBlockSize = 4 * 1024 * 1024;
+
+using LogRecord = ::opentelemetry::proto::logs::v1::LogRecord;
+using Span = ::opentelemetry::proto::trace::v1::Span;
+using LogsRequest = ::opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest;
+using TraceRequest = ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest;
+using Resource = ::opentelemetry::proto::resource::v1::Resource;
+
+template <typename Record>
+struct RequestFor;
+
+template <>
+struct RequestFor<LogRecord> {
+    using Type = LogsRequest;
+    static constexpr std::string_view kName = "log(s)";
+};
+
+template <>
+struct RequestFor<Span> {
+    using Type = TraceRequest;
+    static constexpr std::string_view kName = "trace(s)";
+};
+
+google::protobuf::RepeatedPtrField<LogRecord>& AddBatch(LogsRequest& request, const Resource& resource) {
+    auto* resource_logs = request.add_resource_logs();
+    *resource_logs->mutable_resource() = resource;
+    return *resource_logs->add_scope_logs()->mutable_log_records();
+}
+
+google::protobuf::RepeatedPtrField<Span>& AddBatch(TraceRequest& request, const Resource& resource) {
+    auto* resource_spans = request.add_resource_spans();
+    *resource_spans->mutable_resource() = resource;
+    return *resource_spans->add_scope_spans()->mutable_spans();
+}
+
+class BatchArena final {
+public:
+    BatchArena() : initial_block_(std::make_unique<char[]>(kArenaInitialBlockSize)), arena_(MakeOptions()) {}
+
+    google::protobuf::Arena& Get() noexcept { return arena_; }
+
+    // Frees everything except the initial block
+    void Reset() { arena_.Reset(); }
+
+private:
+    google::protobuf::ArenaOptions MakeOptions() {
+        google::protobuf::ArenaOptions options;
+        options.initial_block = initial_block_.get();
+        options.initial_block_size = kArenaInitialBlockSize;
+        options.max_block_size = kArenaMaxBlockSize;
+        return options;
+    }
+
+    std::unique_ptr<char[]> initial_block_;
+    google::protobuf::Arena arena_;
+};
+
 template <class Item, class Value>
 void AddAttribute(Item& item, std::string_view key, const Value& value) {
     auto* attribute = item.add_attributes();
@@ -73,6 +134,21 @@ void WriteEventsFromValue(::opentelemetry::proto::trace::v1::Span& span, std::st
     }
 }
 
+template <typename Record, typename ResponseFuture>
+void FinishExport(ResponseFuture& future, std::size_t records, ExporterStatistics& stats) {
+    try {
+        [[maybe_unused]] auto response = future.Get();
+        stats.exported += utils::statistics::Rate{records};
+    } catch (const ugrpc::client::RpcCancelledError&) {
+        std::cerr << "Stopping OTLP sender task\n";
+        throw;
+    } catch (const std::exception& e) {
+        stats.failed += utils::statistics::Rate{records};
+        std::cerr << "Failed to write down OTLP " << RequestFor<Record>::kName << ": " << e.what() << typeid(e).name()
+                  << "\n";
+    }
+}
+
 }  // namespace
 
 Formatter::Formatter(
@@ -149,6 +225,7 @@ void Formatter::AddTag(std::string_view key, const logging::LogExtra::Value& val
                     AddAttribute(log_record, logger_.MapAttribute(key), value);
                 }
             },
+            [](std::monostate) {},
         },
         item_.otlp
     );
@@ -193,35 +270,60 @@ SinkType Parse(const yaml_config::YamlConfig& value, formats::parse::To<SinkType
     throw std::runtime_error("OTLP logger: unknown sink type:" + destination);
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const ExporterStatistics& stats) {
+    writer["exported"] = stats.exported;
+    writer["dropped"] = stats.dropped;
+    writer["failed"] = stats.failed;
+    writer["batches"] = stats.batches;
+    writer["full_batches"] = stats.full_batches;
+}
+
+template <typename Record>
+Logger::Exporter<Record>::Exporter(std::size_t max_queue_size)
+    : queue(Queue::Create(max_queue_size)), producer(queue->GetMultiProducer()) {}
+
 Logger::Logger(
     opentelemetry::proto::collector::logs::v1::LogsServiceClient client,
     opentelemetry::proto::collector::trace::v1::TraceServiceClient trace_client,
     LoggerConfig&& config
 )
-    : config_(std::move(config)),
-      queue_(Queue::Create(config_.max_queue_size)),
-      queue_producer_(queue_->GetMultiProducer()) {
+    : config_(std::move(config)), logs_exporter_(config_.max_queue_size), traces_exporter_(config_.max_queue_size) {
+    UINVARIANT(config_.max_batch_size > 0, "max_batch_size must be positive");
     SetLevel(config_.log_level);
+    FillAttributes(resource_);
     std::cerr << "OTLP logger has started\n";
 
-    sender_task_ = engine::CriticalAsyncNoSpan([this,
-                                                consumer = queue_->GetConsumer(),
-                                                log_client = std::move(client),
-                                                trace_client = std::move(trace_client)]() mutable {
-        SendingLoop(consumer, log_client, trace_client);
-    });
-    ;
+    // Logs and traces are sent independently, so that a peak of one does not delay the other
+    logs_sender_task_ = engine::CriticalAsyncNoSpan(
+        [this, consumer = logs_exporter_.queue->GetConsumer(), log_client = std::move(client)]() mutable {
+            SendingLoop<LogClient, LogRecord>(consumer, log_client, logs_exporter_.stats);
+        }
+    );
+    traces_sender_task_ = engine::CriticalAsyncNoSpan(
+        [this, consumer = traces_exporter_.queue->GetConsumer(), trace_client = std::move(trace_client)]() mutable {
+            SendingLoop<TraceClient, Span>(consumer, trace_client, traces_exporter_.stats);
+        }
+    );
 }
 
 Logger::~Logger() { Stop(); }
 
 void Logger::Stop() noexcept {
-    sender_task_.SyncCancel();
-    sender_task_ = {};
+    logs_sender_task_.SyncCancel();
+    logs_sender_task_ = {};
+    traces_sender_task_.SyncCancel();
+    traces_sender_task_ = {};
 }
 
 const logging::impl::LogStatistics& Logger::GetStatistics() const { return stats_; }
 
+void Logger::WriteExporterStatistics(utils::statistics::Writer& writer) const {
+    writer.ValueWithLabels(logs_exporter_.stats, {"signal", "logs"});
+    writer.ValueWithLabels(traces_exporter_.stats, {"signal", "traces"});
+    writer["queue_size"].ValueWithLabels(logs_exporter_.queue->GetSizeApproximate(), {"signal", "logs"});
+    writer["queue_size"].ValueWithLabels(traces_exporter_.queue->GetSizeApproximate(), {"signal", "traces"});
+}
+
 void Logger::PrependCommonTags(logging::impl::TagWriter writer) const {
     logging::impl::default_::PrependCommonTags(writer);
 }
@@ -234,11 +336,14 @@ void Logger::Log(logging::Level level, logging::impl::formatters::LoggerItemRef
     auto& log = static_cast<Item&>(item);
 
     if (!log.otlp.valueless_by_exception()) {
-        bool ok = queue_producer_.PushNoblock(std::move(log.otlp));
-        if (!ok) {
-            // Drop a log/trace if overflown
-            ++stats_.dropped;
-        }
+        std::visit(
+            utils::Overloaded{
+                [](std::monostate) {},
+                [this](LogRecord& log_record) { Push(logs_exporter_, std::move(log_record)); },
+                [this](Span& span) { Push(traces_exporter_, std::move(span)); },
+            },
+            log.otlp
+        );
     }
 
     if (default_logger_ && log.forwarded_formatter) {
@@ -247,58 +352,94 @@ void Logger::Log(logging::Level level, logging::impl::formatters::LoggerItemRef
     }
 }
 
+template <typename Record>
+void Logger::Push(Exporter<Record>& exporter, Record&& record) {
+    if (!exporter.producer.PushNoblock(std::move(record))) {
+        // Drop a log/trace if overflown
+        ++exporter.stats.dropped;
+        ++stats_.dropped;
+    }
+}
+
 logging::impl::formatters::BasePtr
 Logger::MakeFormatter(logging::Level level, logging::LogClass log_class, const utils::impl::SourceLocation& location) {
     auto sink = log_class == logging::LogClass::kLog ? config_.logs_sink : config_.tracing_sink;
     return std::make_unique<Formatter>(level, log_class, location, sink, default_logger_, *this);
 }
 
-void Logger::SendingLoop(Queue::Consumer& consumer, LogClient& log_client, TraceClient& trace_client) {
+template <typename Client, typename Record>
+void Logger::SendingLoop(
+    typename Exporter<Record>::Queue::Consumer& consumer,
+    Client& client,
+    ExporterStatistics& stats
+) {
+    using Request = typename RequestFor<Record>::Type;
+
     // Create dummy span to completely disable logging in current coroutine
     tracing::Span span("");
     span.SetLocalLogLevel(logging::Level::kNone);
 
-    ::opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest log_request;
-    auto resource_logs = log_request.add_resource_logs();
-    auto scope_logs = resource_logs->add_scope_logs();
-    FillAttributes(*resource_logs->mutable_resource());
-
-    ::opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest trace_request;
-    auto resource_spans = trace_request.add_resource_spans();
-    auto scope_spans = resource_spans->add_scope_spans();
-    FillAttributes(*resource_spans->mutable_resource());
-
-    Action action{};
-    while (consumer.Pop(action)) {
-        scope_logs->clear_log_records();
-        scope_spans->clear_spans();
+    // A batch is collected in one arena while the previous one is being sent from the other
+    std::array<BatchArena, 2> arenas;
+    std::size_t current_arena = 0;
+    std::optional<typename Client::ExportResponseFuture> in_flight;
+    std::size_t in_flight_records = 0;
+
+    const auto finish_in_flight = [&] {
+        if (!in_flight) return;
+        FinishExport<Record>(*in_flight, in_flight_records, stats);
+        in_flight.reset();
+        arenas[current_arena ^ 1].Reset();
+    };
+
+    Record record;
+    while (true) {
+        if (!consumer.PopNoblock(record)) {
+            finish_in_flight();
+            if (!consumer.Pop(record)) break;
+        }
 
-        auto deadline = engine::Deadline::FromDuration(config_.max_batch_delay);
+        auto& arena = arenas[current_arena];
+        auto* request = google::protobuf::Arena::CreateMessage<Request>(&arena.Get());
+        auto& records = AddBatch(*request, resource_);
+        const auto max_batch_size = static_cast<int>(config_.max_batch_size);
+        const auto deadline = engine::Deadline::FromDuration(config_.max_batch_delay);
 
         do {
-            std::visit(
-                utils::Overloaded{
-                    [&scope_spans](const opentelemetry::proto::trace::v1::Span& action) {
-                        auto span = scope_spans->add_spans();
-                        *span = action;
-                    },
-                    [&scope_logs](const opentelemetry::proto::logs::v1::LogRecord& action) {
-                        auto log_records = scope_logs->add_log_records();
-                        *log_records = action;
-                    }},
-                action
-            );
-        } while (consumer.Pop(action, deadline));
-
-        if (utils::UnderlyingValue(config_.logs_sink) & utils::UnderlyingValue(SinkType::kOtlp)) {
-            DoLog(log_request, log_client);
-        }
-        if (utils::UnderlyingValue(config_.tracing_sink) & utils::UnderlyingValue(SinkType::kOtlp)) {
-            DoTrace(trace_request, trace_client);
+            // The arena takes the ownership of a heap-allocated record without copying it
+            records.AddAllocated(new Record(std::move(record)));
+        } while (records.size() < max_batch_size && consumer.Pop(record, deadline));
+
+        ++stats.batches;
+        if (records.size() >= max_batch_size) ++stats.full_batches;
+
+        finish_in_flight();
+
+        const auto batch_size = static_cast<std::size_t>(records.size());
+        try {
+            in_flight.emplace(client.AsyncExport(*request, MakeClientContext()));
+            in_flight_records = batch_size;
+            current_arena ^= 1;
+        } catch (const ugrpc::client::RpcCancelledError&) {
+            std::cerr << "Stopping OTLP sender task\n";
+            throw;
+        } catch (const std::exception& e) {
+            stats.failed += utils::statistics::Rate{batch_size};
+            std::cerr << "Failed to write down OTLP " << RequestFor<Record>::kName << ": " << e.what()
+                      << typeid(e).name() << "\n";
+            arena.Reset();
         }
     }
 }
 
+std::unique_ptr<grpc::ClientContext> Logger::MakeClientContext() const {
+    auto context = std::make_unique<grpc::ClientContext>();
+    if (config_.compression != GRPC_COMPRESS_NONE) {
+        context->set_compression_algorithm(config_.compression);
+    }
+    return context;
+}
+
 void Logger::FillAttributes(::opentelemetry::proto::resource::v1::Resource& resource) {
     {
         auto* attr = resource.add_attributes();
@@ -325,36 +466,6 @@ void Logger::FillAttributes(::opentelemetry::proto::resource::v1::Resource& reso
     }
 }
 
-void Logger::DoLog(
-    const opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest& request,
-    LogClient& client
-) {
-    try {
-        auto response = client.Export(request);
-    } catch (const ugrpc::client::RpcCancelledError&) {
-        std::cerr << "Stopping OTLP sender task\n";
-        throw;
-    } catch (const std::exception& e) {
-        std::cerr << "Failed to write down OTLP log(s): " << e.what() << typeid(e).name() << "\n";
-    }
-    // TODO: count exceptions
-}
-
-void Logger::DoTrace(
-    const opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest& request,
-    TraceClient& trace_client
-) {
-    try {
-        auto response = trace_client.Export(request);
-    } catch (const ugrpc::client::RpcCancelledError&) {
-        std::cerr << "Stopping OTLP sender task\n";
-        throw;
-    } catch (const std::exception& e) {
-        std::cerr << "Failed to write down OTLP trace(s): " << e.what() << typeid(e).name() << "\n";
-    }
-    // TODO: count exceptions
-}
-
 std::string_view Logger::MapAttribute(std::string_view attr) const {
     for (const auto& [key, value] : config_.attributes_mapping) {
         if (key == attr) return value;
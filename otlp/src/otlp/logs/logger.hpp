@@ -2,8 +2,11 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <variant>
 
+#include <grpc/compression.h>
+
 #include <opentelemetry/proto/collector/logs/v1/logs_service_client.usrv.pb.hpp>
 #include <opentelemetry/proto/collector/trace/v1/trace_service_client.usrv.pb.hpp>
 
@@ -13,6 +16,8 @@
 #include <userver/logging/impl/log_stats.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/log_extra.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,6 +35,8 @@ SinkType Parse(const yaml_config::YamlConfig& value, formats::parse::To<SinkType
 struct LoggerConfig {
     size_t max_queue_size{10000};
     std::chrono::milliseconds max_batch_delay{};
+    size_t max_batch_size{512};
+    grpc_compression_algorithm compression{GRPC_COMPRESS_NONE};
     SinkType logs_sink{SinkType::kOtlp};
     SinkType tracing_sink{SinkType::kOtlp};
     std::string service_name;
@@ -39,13 +46,32 @@ struct LoggerConfig {
 };
 
 struct Item final : logging::impl::formatters::LoggerItemBase {
-    std::variant<::opentelemetry::proto::logs::v1::LogRecord, ::opentelemetry::proto::trace::v1::Span> otlp;
+    // std::monostate if the item is not sent to the OTLP collector
+    std::variant<std::monostate, ::opentelemetry::proto::logs::v1::LogRecord, ::opentelemetry::proto::trace::v1::Span>
+        otlp;
     double total_time{};
     double start_timestamp{};
 
     logging::impl::formatters::BasePtr forwarded_formatter;  // can be null
 };
 
+/// Statistics of sending either logs or traces
+struct ExporterStatistics final {
+    using Counter = utils::statistics::RateCounter;
+
+    // records sent to the collector
+    Counter exported{};
+    // records dropped because of the queue overflow
+    Counter dropped{};
+    // records lost because of the failed export calls
+    Counter failed{};
+    Counter batches{};
+    // batches sent on reaching max_batch_size, the exporter is under pressure
+    Counter full_batches{};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const ExporterStatistics& stats);
+
 class Logger;
 
 class Formatter final : public logging::impl::formatters::Base {
@@ -85,6 +111,8 @@ public:
 
     const logging::impl::LogStatistics& GetStatistics() const;
 
+    void WriteExporterStatistics(utils::statistics::Writer& writer) const;
+
     void SetDefaultLogger(logging::LoggerPtr default_logger) { default_logger_ = default_logger; }
 
     std::string_view MapAttribute(std::string_view attr) const;
@@ -93,26 +121,41 @@ protected:
     bool DoShouldLog(logging::Level level) const noexcept override;
 
 private:
-    using Action = std::variant<::opentelemetry::proto::logs::v1::LogRecord, ::opentelemetry::proto::trace::v1::Span>;
-    using Queue = concurrent::NonFifoMpscQueue<Action>;
+    using LogRecord = ::opentelemetry::proto::logs::v1::LogRecord;
+    using Span = ::opentelemetry::proto::trace::v1::Span;
+    using LogQueue = concurrent::NonFifoMpscQueue<LogRecord>;
+    using TraceQueue = concurrent::NonFifoMpscQueue<Span>;
 
-    void SendingLoop(Queue::Consumer& consumer, LogClient& log_client, TraceClient& trace_client);
+    template <typename Record>
+    struct Exporter final {
+        using Queue = concurrent::NonFifoMpscQueue<Record>;
 
-    void FillAttributes(::opentelemetry::proto::resource::v1::Resource& resource);
+        explicit Exporter(std::size_t max_queue_size);
+
+        std::shared_ptr<Queue> queue;
+        typename Queue::MultiProducer producer;
+        ExporterStatistics stats;
+    };
+
+    template <typename Client, typename Record>
+    void SendingLoop(typename Exporter<Record>::Queue::Consumer& consumer, Client& client, ExporterStatistics& stats);
 
-    void DoLog(const opentelemetry::proto::collector::logs::v1::ExportLogsServiceRequest& request, LogClient& client);
+    template <typename Record>
+    void Push(Exporter<Record>& exporter, Record&& record);
 
-    void DoTrace(
-        const opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest& request,
-        TraceClient& trace_client
-    );
+    std::unique_ptr<grpc::ClientContext> MakeClientContext() const;
+
+    void FillAttributes(::opentelemetry::proto::resource::v1::Resource& resource);
 
     logging::impl::LogStatistics stats_;
     const LoggerConfig config_;
-    std::shared_ptr<Queue> queue_;
-    Queue::MultiProducer queue_producer_;
+    ::opentelemetry::proto::resource::v1::Resource resource_;
+    Exporter<LogRecord> logs_exporter_;
+    Exporter<Span> traces_exporter_;
     logging::LoggerPtr default_logger_{};
-    engine::Task sender_task_;  // Must be the last member
+    // Must be the last members
+    engine::Task logs_sender_task_;
+    engine::Task traces_sender_task_;
 };
 
 }  // namespace otlp
@@ -18,6 +18,8 @@
 #include <userver/logging/impl/mem_logger.hpp>
 #include <userver/ugrpc/tests/service_fixtures.hpp>
 #include <userver/utest/default_logger_fixture.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
 
 namespace opentelemetry::proto::common::v1 {
 
@@ -107,9 +109,9 @@ public:
 // NOLINTNEXTLINE(fuchsia-multiple-inheritance)
 class LogServiceTest : public Service<LogService, TraceService>, public utest::DefaultLoggerFixture<::testing::Test> {
 public:
-    LogServiceTest() : Service({}) {
-        otlp::LoggerConfig config;
-        config.logs_sink = otlp::SinkType::kBoth;
+    LogServiceTest() : LogServiceTest(MakeConfig()) {}
+
+    explicit LogServiceTest(otlp::LoggerConfig config) : Service({}) {
         logger_ = std::make_shared<otlp::Logger>(
             MakeClient<opentelemetry::proto::collector::logs::v1::LogsServiceClient>(),
             MakeClient<opentelemetry::proto::collector::trace::v1::TraceServiceClient>(),
@@ -122,10 +124,46 @@ public:
 
     otlp::Logger& GetLogger() { return *logger_; }
 
+    static otlp::LoggerConfig MakeConfig() {
+        otlp::LoggerConfig config;
+        config.logs_sink = otlp::SinkType::kBoth;
+        return config;
+    }
+
 private:
     std::shared_ptr<otlp::Logger> logger_;
 };
 
+class LogServiceBatchingTest : public LogServiceTest {
+public:
+    LogServiceBatchingTest() : LogServiceTest(MakeBatchingConfig()) {
+        statistics_holder_ =
+            statistics_storage_.RegisterWriter("otlp-exporter", [this](utils::statistics::Writer& writer) {
+                GetLogger().WriteExporterStatistics(writer);
+            });
+    }
+
+    ~LogServiceBatchingTest() override { statistics_holder_.Unregister(); }
+
+    utils::statistics::Rate GetLogsMetric(std::string metric) const {
+        const auto snapshot = utils::statistics::Snapshot(statistics_storage_, "otlp-exporter");
+        return snapshot.SingleMetric(std::move(metric), {{"signal", "logs"}}).AsRate();
+    }
+
+private:
+    static otlp::LoggerConfig MakeBatchingConfig() {
+        auto config = MakeConfig();
+        config.max_batch_size = 3;
+        // Only full batches are sent during the test
+        config.max_batch_delay = std::chrono::minutes{1};
+        config.compression = GRPC_COMPRESS_GZIP;
+        return config;
+    }
+
+    utils::statistics::Storage statistics_storage_;
+    utils::statistics::Entry statistics_holder_;
+};
+
 }  // namespace
 
 UTEST_F(LogServiceTest, NoInfiniteLogsInTrace) {
@@ -263,4 +301,25 @@ UTEST_F(LogServiceTest, SpanEvent) {
     EXPECT_THAT(attributes, ::testing::UnorderedElementsAreArray(kExpectedAttributes));
 }
 
+UTEST_F(LogServiceBatchingTest, FullBatches) {
+    for (int i = 0; i < 6; ++i) {
+        LOG_INFO() << "log " << i;
+    }
+
+    while (GetLogsMetric("exported") < 6) {
+        engine::SleepFor(std::chrono::milliseconds(10));
+    }
+
+    std::vector<std::string> bodies;
+    for (const auto& log : GetService1().logs) {
+        bodies.push_back(log.body().string_value());
+    }
+    EXPECT_THAT(bodies, ::testing::UnorderedElementsAre("log 0", "log 1", "log 2", "log 3", "log 4", "log 5"));
+
+    EXPECT_EQ(GetLogsMetric("batches"), 2);
+    EXPECT_EQ(GetLogsMetric("full_batches"), 2);
+    EXPECT_EQ(GetLogsMetric("dropped"), 0);
+    EXPECT_EQ(GetLogsMetric("failed"), 0);
+}
+
 USERVER_NAMESPACE_END
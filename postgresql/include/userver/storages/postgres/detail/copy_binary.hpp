@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/compiler/demangle.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/pg_types.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// Appends the next portion of COPY data to the chunk, returns false if there
+/// is no more data.
+using CopyInDataSource = USERVER_NAMESPACE::utils::function_ref<bool(std::string& chunk)>;
+
+/// Receives a single CopyData message of COPY TO STDOUT
+using CopyOutDataSink = USERVER_NAMESPACE::utils::function_ref<void(std::string_view data)>;
+
+/// Signature, flags field and header extension length of the binary COPY
+/// format, see https://www.postgresql.org/docs/current/sql-copy.html
+inline constexpr std::string_view kCopyBinaryHeader{"PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0", 19};
+
+/// File trailer of the binary COPY format, a field count of -1
+inline constexpr std::string_view kCopyBinaryTrailer{"\377\377", 2};
+
+/// Rows are sent to the server when the chunk grows over this size
+inline constexpr std::size_t kCopyChunkSize = 64 * 1024;
+
+template <typename Row>
+void WriteCopyBinaryRow(const UserTypes& types, std::string& buffer, const Row& row) {
+    if constexpr (io::traits::kIsRowType<Row>) {
+        using RowType = io::RowType<Row>;
+        io::WriteBuffer(types, buffer, static_cast<Smallint>(RowType::size));
+        std::apply(
+            [&types, &buffer](const auto&... fields) { (io::WriteRawBinary(types, buffer, fields), ...); },
+            RowType::GetTuple(row)
+        );
+    } else {
+        io::WriteBuffer(types, buffer, Smallint{1});
+        io::WriteRawBinary(types, buffer, row);
+    }
+}
+
+template <typename T>
+void ReadCopyBinaryField(io::FieldBuffer& buffer, T& value, const io::TypeBufferCategory& categories) {
+    // COPY data carries no type oids, the buffer category is deduced from the
+    // C++ type
+    buffer.ReadRaw(value, categories, io::traits::kTypeBufferCategory<T>);
+}
+
+template <typename Row>
+void ReadCopyBinaryRow(std::string_view data, Row& row, const io::TypeBufferCategory& categories) {
+    io::FieldBuffer buffer{
+        false, io::BufferCategory::kPlainBuffer, data.size(), reinterpret_cast<const std::uint8_t*>(data.data())};
+
+    Smallint field_count{0};
+    buffer.Read(field_count, io::BufferCategory::kPlainBuffer);
+
+    if constexpr (io::traits::kIsRowType<Row>) {
+        using RowType = io::RowType<Row>;
+        if (field_count != static_cast<Smallint>(RowType::size)) {
+            throw InvalidTupleSizeRequested(field_count, RowType::size);
+        }
+        std::apply(
+            [&buffer, &categories](auto&... fields) { (ReadCopyBinaryField(buffer, fields, categories), ...); },
+            RowType::GetTuple(row)
+        );
+    } else {
+        if (field_count != 1) {
+            throw NonSingleColumnResultSet(field_count, compiler::GetTypeName<Row>(), "CopyOut");
+        }
+        ReadCopyBinaryField(buffer, row, categories);
+    }
+
+    if (buffer.length != 0) {
+        throw InvalidInputBufferSize(fmt::format("Unconsumed bytes in COPY row: {}.", buffer.length));
+    }
+}
+
+/// @brief Splits the stream of CopyData messages in binary format into rows.
+///
+/// Server sends the file header together with the first row and the trailer
+/// in a separate message.
+class CopyBinaryReader final {
+public:
+    /// @returns the row data or std::nullopt if the message carries no row
+    std::optional<std::string_view> GetRow(std::string_view data) {
+        if (!header_consumed_) {
+            if (data.substr(0, kCopyBinaryHeader.size()) != kCopyBinaryHeader) {
+                throw InvalidBinaryBuffer("Invalid binary COPY header, is the statement using FORMAT binary?");
+            }
+            data.remove_prefix(kCopyBinaryHeader.size());
+            header_consumed_ = true;
+        }
+        if (data.empty() || data == kCopyBinaryTrailer) return std::nullopt;
+        return data;
+    }
+
+private:
+    bool header_consumed_{false};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -44,6 +44,9 @@
 /// - Ability to manually control network roundtrips via
 ///   storages::postgres::QueryQueue to gain maximum efficiency
 ///   in case of multiple unrelated select statements;
+/// - Executing multiple statements of a transaction in one network roundtrip
+///   via storages::postgres::QueryBatch;
+/// - Binary COPY for bulk loading and exporting of rows;
 /// - Mapping PostgreSQL user types to C++ types;
 /// - Transaction error injection via pytest_userver.sql.RegisteredTrx;
 /// - LISTEN/NOTIFY support via storages::postgres::Cluster::Listen();
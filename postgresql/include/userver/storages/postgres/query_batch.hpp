@@ -0,0 +1,131 @@
+#pragma once
+
+/// @file userver/storages/postgres/query_batch.hpp
+/// @brief @copybrief storages::postgres::QueryBatch
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/io/user_types.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/utils/any_movable.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @ingroup userver_containers
+///
+/// @brief A list of statements to be executed in a transaction within a single
+/// network round-trip.
+///
+/// Statements are pushed into the batch and then executed in FIFO order by
+/// storages::postgres::Transaction::ExecuteBatch. Arguments are copied into
+/// the batch and are serialized right before the execution, so the batch may
+/// be filled before the transaction is started and may be executed several
+/// times.
+///
+/// @code
+/// storages::postgres::QueryBatch batch;
+/// batch.Push("insert into foo(id, name) values($1, $2)", id, name);
+/// batch.Push("update bar set counter = counter + 1 where id = $1", bar_id);
+/// batch.Push("select count(*) from foo");
+///
+/// auto trx = cluster->Begin(/* transaction options */);
+/// auto results = trx.ExecuteBatch(batch);
+/// trx.Commit();
+/// @endcode
+///
+/// @warning Transaction control statements ("BEGIN", "COMMIT", "SAVEPOINT"
+/// etc.) must not be added into the batch.
+class QueryBatch final {
+public:
+    QueryBatch() = default;
+
+    QueryBatch(QueryBatch&&) noexcept = default;
+    QueryBatch& operator=(QueryBatch&&) noexcept = default;
+
+    QueryBatch(const QueryBatch&) = delete;
+    QueryBatch& operator=(const QueryBatch&) = delete;
+
+    /// Reserve internal storage to hold this amount of statements.
+    void Reserve(std::size_t size) { statements_.reserve(size); }
+
+    /// Add a statement into the batch with specified command-control.
+    /// CommandControl::statement is used as a statement timeout,
+    /// CommandControl::execute is ignored as the network timeout is set for
+    /// the whole batch.
+    template <typename... Args>
+    void Push(CommandControl cc, const Query& query, const Args&... args) {
+        DoPush(cc, query, args...);
+    }
+    void Push(CommandControl cc, const Query& query, ParameterStore&& store);
+
+    /// Add a statement into the batch with the command-control of the batch.
+    template <typename... Args>
+    void Push(const Query& query, const Args&... args) {
+        DoPush(OptionalCommandControl{}, query, args...);
+    }
+    void Push(const Query& query, ParameterStore&& store);
+
+    /// Returns the number of statements in the batch.
+    std::size_t Size() const { return statements_.size(); }
+
+    /// Returns whether there are no statements in the batch.
+    bool IsEmpty() const { return statements_.empty(); }
+
+    /// @cond
+    /// Writes the arguments, `storage` is used if the arguments need to be
+    /// serialized
+    using ParamsWriter = detail::QueryParameters (*)(
+        const UserTypes& types,
+        const USERVER_NAMESPACE::utils::AnyMovable& args,
+        detail::DynamicQueryParameters& storage
+    );
+
+    struct Statement final {
+        Query query;
+        OptionalCommandControl statement_cmd_ctl;
+        USERVER_NAMESPACE::utils::AnyMovable args;
+        ParamsWriter write_params;
+    };
+
+    const std::vector<Statement>& GetStatements() const { return statements_; }
+    /// @endcond
+
+private:
+    template <typename... Args>
+    void DoPush(OptionalCommandControl cc, const Query& query, const Args&... args);
+
+    std::vector<Statement> statements_;
+};
+
+template <typename... Args>
+void QueryBatch::DoPush(OptionalCommandControl cc, const Query& query, const Args&... args) {
+    using ArgsTuple = std::tuple<Args...>;
+
+    USERVER_NAMESPACE::utils::AnyMovable holder;
+    holder.Emplace<ArgsTuple>(args...);
+    statements_.push_back(Statement{
+        query,
+        cc,
+        std::move(holder),
+        [](const UserTypes& types,
+           const USERVER_NAMESPACE::utils::AnyMovable& args,
+           detail::DynamicQueryParameters& storage) {
+            std::apply(
+                [&types, &storage](const auto&... values) { storage.Write(types, values...); },
+                USERVER_NAMESPACE::utils::AnyCast<const ArgsTuple&>(args)
+            );
+            return detail::QueryParameters{storage};
+        }});
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,9 @@
 /// @brief An utility to execute multiple queries in a single network
 /// round-trip.
 
+#include <exception>
+#include <vector>
+
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/result_set.hpp>
@@ -12,6 +15,7 @@
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 
 #include <userver/utils/any_movable.hpp>
+#include <userver/utils/expected.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,7 +34,8 @@ class ParameterStore;
 /// queries succeed or `Collect` rethrows the first error encountered. However,
 /// this is *NOT* the case for the server: server treats all the provided
 /// queries independently and is likely to  execute subsequent queries even
-/// after prior failures.
+/// after prior failures. Use `CollectWithErrors` to get the results of the
+/// queries that succeeded along with the errors of the ones that failed.
 ///
 /// @warning If an explicit transaction ("BEGIN") or a modifying query is added
 /// into the queue the behavior is unspecified. *Don't do that*.
@@ -42,6 +47,9 @@ class ParameterStore;
 /// ones) that on construction.
 class QueryQueue final {
 public:
+    /// Result of a single query, holds the exception if the query failed
+    using Result = USERVER_NAMESPACE::utils::expected<ResultSet, std::exception_ptr>;
+
     QueryQueue(CommandControl default_cc, detail::ConnectionPtr&& conn);
 
     QueryQueue(QueryQueue&&) noexcept;
@@ -80,6 +88,20 @@ public:
     /// execution error or a timeout.
     [[nodiscard]] std::vector<ResultSet> Collect();
 
+    /// Collect results of all the queued queries, with specified timeout.
+    /// Returns a vector of N results, where N is the number of queries
+    /// enqueued. Errors of the queries are stored in the corresponding results,
+    /// errors that affect all the queries (e.g. a timeout or a connection
+    /// failure) are thrown.
+    [[nodiscard]] std::vector<Result> CollectWithErrors(TimeoutDuration timeout);
+
+    /// Collect results of all the queued queries, with default timeout.
+    /// Returns a vector of N results, where N is the number of queries
+    /// enqueued. Errors of the queries are stored in the corresponding results,
+    /// errors that affect all the queries (e.g. a timeout or a connection
+    /// failure) are thrown.
+    [[nodiscard]] std::vector<Result> CollectWithErrors();
+
 private:
     struct ParamsHolder final {
         // We only need to know what's here at construction (and at construction we
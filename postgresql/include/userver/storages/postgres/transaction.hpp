@@ -3,10 +3,14 @@
 /// @file userver/storages/postgres/transaction.hpp
 /// @brief Transactions
 
+#include <iterator>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
+#include <userver/storages/postgres/detail/copy_binary.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/options.hpp>
@@ -14,6 +18,7 @@
 #include <userver/storages/postgres/portal.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -101,6 +106,41 @@ namespace storages::postgres {
 /// trx.Commit();
 /// @endcode
 ///
+/// @par Batches of statements
+///
+/// Each Execute call waits for the result, so a transaction of N statements
+/// takes N network round-trips. Statements that do not depend on each other's
+/// results can be pushed into a QueryBatch and executed within a single
+/// round-trip if the driver works in pipeline mode.
+///
+/// @code
+/// storages::postgres::QueryBatch batch;
+/// batch.Push("insert into foobar(foo, bar) values($1, $2)", 42, "baz");
+/// batch.Push("update counters set value = value + 1 where name = $1", "foobar");
+///
+/// auto trx = cluster->Begin(/* transaction options */);
+/// auto results = trx.ExecuteBatch(batch);
+/// trx.Commit();
+/// @endcode
+///
+/// @par Bulk load and export with COPY
+///
+/// Large amounts of rows are loaded and exported much faster with
+/// `COPY ... FROM STDIN` and `COPY ... TO STDOUT` in binary format than with
+/// multi-row statements. Rows are converted with the same formatters and
+/// parsers as query parameters and results, and are streamed to and from the
+/// server without buffering the whole data set.
+///
+/// @code
+/// auto trx = cluster->Begin(/* transaction options */);
+/// std::vector<std::tuple<int, std::string>> rows = /* ... */;
+/// trx.CopyIn("copy foobar (foo, bar) from stdin (format binary)", rows);
+/// trx.CopyOut<std::tuple<int, std::string>>(
+///     "copy foobar (foo, bar) to stdout (format binary)",
+///     [](std::tuple<int, std::string>&& row) { /* ... */ });
+/// trx.Commit();
+/// @endcode
+///
 /// @see Transaction
 /// @see ResultSet
 ///
@@ -213,6 +253,41 @@ public:
     /// separately, or use storages::postgres::ParameterScope.
     ResultSet Execute(OptionalCommandControl statement_cmd_ctl, const Query& query, const ParameterStore& store);
 
+    /// Execute all the statements of the batch within a single network
+    /// round-trip.
+    ///
+    /// The statements are sent to the server at once if the driver works in
+    /// pipeline mode (see storages::postgres::PipelineMode), otherwise they are
+    /// executed one by one.
+    ///
+    /// Suspends coroutine for execution.
+    ///
+    /// @returns results of the statements in the order they were pushed into
+    /// the batch
+    /// @throws the error of the first failed statement. The transaction is
+    /// aborted in that case, so the results of the other statements are not
+    /// reported.
+    std::vector<ResultSet> ExecuteBatch(const QueryBatch& batch) {
+        return ExecuteBatch(OptionalCommandControl{}, batch);
+    }
+
+    /// Execute all the statements of the batch within a single network
+    /// round-trip, CommandControl::execute is used as a network timeout for the
+    /// whole batch.
+    ///
+    /// The statements are sent to the server at once if the driver works in
+    /// pipeline mode (see storages::postgres::PipelineMode), otherwise they are
+    /// executed one by one.
+    ///
+    /// Suspends coroutine for execution.
+    ///
+    /// @returns results of the statements in the order they were pushed into
+    /// the batch
+    /// @throws the error of the first failed statement. The transaction is
+    /// aborted in that case, so the results of the other statements are not
+    /// reported.
+    std::vector<ResultSet> ExecuteBatch(OptionalCommandControl batch_cmd_ctl, const QueryBatch& batch);
+
     /// Execute statement that uses an array of arguments splitting that array in
     /// chunks and executing the statement with a chunk of arguments.
     ///
@@ -293,6 +368,52 @@ public:
     /// and per-statement command control.
     Portal MakePortal(OptionalCommandControl statement_cmd_ctl, const Query& query, const ParameterStore& store);
 
+    /// @brief Load rows with `COPY ... FROM STDIN (FORMAT binary)`.
+    ///
+    /// `rows` may be any input range of row types (a tuple, an aggregate or a
+    /// type with Introspect()) or of single values, fields are written in the
+    /// order of the column list of the statement. Rows are serialized and
+    /// sent in chunks while iterating the range, so a lazily generated range
+    /// is never materialized as a whole.
+    ///
+    /// If the iteration throws, the COPY is aborted and the transaction fails.
+    ///
+    /// Suspends coroutine for execution.
+    /// @returns number of loaded rows
+    template <typename Container>
+    std::size_t CopyIn(const Query& query, const Container& rows) {
+        return CopyIn(OptionalCommandControl{}, query, rows);
+    }
+
+    /// @brief Load rows with `COPY ... FROM STDIN (FORMAT binary)` and
+    /// per-statement command control.
+    /// @see CopyIn
+    template <typename Container>
+    std::size_t CopyIn(OptionalCommandControl statement_cmd_ctl, const Query& query, const Container& rows);
+
+    /// @brief Export rows with `COPY ... TO STDOUT (FORMAT binary)`.
+    ///
+    /// Every row is parsed into `Row` (a row type or a single value) as soon
+    /// as it is received and is passed to `on_row` as an rvalue, the result
+    /// is never buffered as a whole. COPY data has no type information, so
+    /// `Row` fields should match the column types exactly.
+    ///
+    /// If `on_row` throws, the statement is cancelled and the exception is
+    /// rethrown.
+    ///
+    /// Suspends coroutine for execution.
+    /// @returns number of exported rows
+    template <typename Row, typename Callback>
+    std::size_t CopyOut(const Query& query, Callback&& on_row) {
+        return CopyOut<Row>(OptionalCommandControl{}, query, std::forward<Callback>(on_row));
+    }
+
+    /// @brief Export rows with `COPY ... TO STDOUT (FORMAT binary)` and
+    /// per-statement command control.
+    /// @see CopyOut
+    template <typename Row, typename Callback>
+    std::size_t CopyOut(OptionalCommandControl statement_cmd_ctl, const Query& query, Callback&& on_row);
+
     /// Set a connection parameter
     /// https://www.postgresql.org/docs/current/sql-set.html
     /// The parameter is set for this transaction only
@@ -323,6 +444,10 @@ private:
         const detail::QueryParameters& params,
         OptionalCommandControl statement_cmd_ctl
     );
+    std::size_t
+    DoCopyIn(const Query& query, detail::CopyInDataSource next_chunk, OptionalCommandControl statement_cmd_ctl);
+    std::size_t
+    DoCopyOut(const Query& query, detail::CopyOutDataSink on_data, OptionalCommandControl statement_cmd_ctl);
 
     const UserTypes& GetConnectionUserTypes() const;
 
@@ -370,6 +495,52 @@ void Transaction::ExecuteDecomposeBulk(
     });
 }
 
+template <typename Container>
+std::size_t
+Transaction::CopyIn(OptionalCommandControl statement_cmd_ctl, const Query& query, const Container& rows) {
+    const auto& types = GetConnectionUserTypes();
+    auto it = std::begin(rows);
+    const auto end = std::end(rows);
+    bool header_written = false;
+
+    return DoCopyIn(
+        query,
+        [&](std::string& chunk) {
+            if (!header_written) {
+                chunk.append(detail::kCopyBinaryHeader);
+                header_written = true;
+            }
+            for (; it != end && chunk.size() < detail::kCopyChunkSize; ++it) {
+                detail::WriteCopyBinaryRow(types, chunk, *it);
+            }
+            if (it != end) return true;
+
+            chunk.append(detail::kCopyBinaryTrailer);
+            return false;
+        },
+        std::move(statement_cmd_ctl)
+    );
+}
+
+template <typename Row, typename Callback>
+std::size_t Transaction::CopyOut(OptionalCommandControl statement_cmd_ctl, const Query& query, Callback&& on_row) {
+    const auto& categories = GetConnectionUserTypes().GetTypeBufferCategories();
+    detail::CopyBinaryReader reader;
+
+    return DoCopyOut(
+        query,
+        [&](std::string_view data) {
+            const auto row_data = reader.GetRow(data);
+            if (!row_data) return;
+
+            Row row{};
+            detail::ReadCopyBinaryRow(*row_data, row, categories);
+            on_row(std::move(row));
+        },
+        std::move(statement_cmd_ctl)
+    );
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
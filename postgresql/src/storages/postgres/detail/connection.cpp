@@ -132,10 +132,16 @@ void Connection::AddIntoPipeline(
     pimpl_->AddIntoPipeline(cc, prepared_statement_name, params, description, scope);
 }
 
-std::vector<ResultSet> Connection::GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+std::vector<PipelineResult>
+Connection::GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
     return pimpl_->GatherPipeline(timeout, descriptions);
 }
 
+std::vector<PipelineResult>
+Connection::ExecuteBatch(const std::vector<BatchStatement>& statements, OptionalCommandControl batch_cmd_ctl) {
+    return pimpl_->ExecuteBatch(statements, std::move(batch_cmd_ctl));
+}
+
 ResultSet Connection::Execute(const Query& query, const ParameterStore& store) {
     return Execute(query, detail::QueryParameters{store.GetInternalData()});
 }
@@ -162,6 +168,15 @@ ResultSet Connection::PortalExecute(
     return pimpl_->PortalExecute(statement_id, portal_name, n_rows, std::move(statement_cmd_ctl));
 }
 
+std::size_t
+Connection::CopyIn(const Query& query, CopyInDataSource next_chunk, OptionalCommandControl statement_cmd_ctl) {
+    return pimpl_->CopyIn(query, next_chunk, std::move(statement_cmd_ctl));
+}
+
+std::size_t Connection::CopyOut(const Query& query, CopyOutDataSink on_data, OptionalCommandControl statement_cmd_ctl) {
+    return pimpl_->CopyOut(query, on_data, std::move(statement_cmd_ctl));
+}
+
 void Connection::CancelAndCleanup(TimeoutDuration timeout) { pimpl_->CancelAndCleanup(timeout); }
 
 bool Connection::Cleanup(TimeoutDuration timeout) { return pimpl_->Cleanup(timeout); }
@@ -2,7 +2,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <exception>
 #include <string>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -10,9 +12,11 @@
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/error_injection/settings.hpp>
 #include <userver/testsuite/postgres_control.hpp>
+#include <userver/utils/expected.hpp>
 #include <userver/utils/statistics/min_max_avg.hpp>
 #include <userver/utils/strong_typedef.hpp>
 
+#include <userver/storages/postgres/detail/copy_binary.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/dsn.hpp>
@@ -40,6 +44,10 @@ namespace detail {
 
 class ConnectionImpl;
 
+/// Result of a query sent in pipeline mode, holds the exception if the query
+/// failed
+using PipelineResult = USERVER_NAMESPACE::utils::expected<ResultSet, std::exception_ptr>;
+
 /// @brief PostreSQL connection class
 /// Handles connecting to Postgres, sending commands, processing command results
 /// and closing Postgres connection.
@@ -228,7 +236,21 @@ public:
         tracing::ScopeTime& scope
     );
 
-    std::vector<ResultSet> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+    std::vector<PipelineResult> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+
+    struct BatchStatement final {
+        const Query& query;
+        detail::QueryParameters params;
+        OptionalCommandControl statement_cmd_ctl;
+    };
+
+    /// Execute the statements within a single network round-trip if the
+    /// connection is in pipeline mode, otherwise execute them one by one.
+    /// Statements are not executed after the first failure in the latter case.
+    /// @returns results of the executed statements, a failed statement holds
+    /// the exception
+    std::vector<PipelineResult>
+    ExecuteBatch(const std::vector<BatchStatement>& statements, OptionalCommandControl batch_cmd_ctl);
 
     template <typename... T>
     ResultSet Execute(const Query& query, const T&... args) {
@@ -256,6 +278,18 @@ public:
     );
     ResultSet PortalExecute(StatementId, const std::string& portal_name, std::uint32_t n_rows, OptionalCommandControl);
 
+    /// Run `COPY ... FROM STDIN`, sending the data produced by `next_chunk`.
+    /// If `next_chunk` throws, the COPY is aborted and the exception is
+    /// rethrown.
+    /// @returns number of copied rows
+    std::size_t CopyIn(const Query& query, CopyInDataSource next_chunk, OptionalCommandControl);
+
+    /// Run `COPY ... TO STDOUT`, passing every received CopyData message to
+    /// `on_data`. If `on_data` throws, the statement is cancelled and the
+    /// exception is rethrown.
+    /// @returns number of copied rows
+    std::size_t CopyOut(const Query& query, CopyOutDataSink on_data, OptionalCommandControl);
+
     /// Send cancel to the database backend
     /// Try to return connection to idle state discarding all results.
     /// If there is a transaction in progress - roll it back.
@@ -1,4 +1,5 @@
 #include <cctype>
+#include <exception>
 #include <storages/postgres/detail/connection_impl.hpp>
 
 #include <boost/functional/hash.hpp>
@@ -56,28 +57,28 @@ std::size_t QueryHash(const std::string& statement, const QueryParameters& param
 
 class CountExecute {
 public:
-    CountExecute(Connection::Statistics& stats) : stats_(stats) {
-        ++stats_.execute_total;
+    CountExecute(Connection::Statistics& stats, std::size_t statements = 1) : stats_(stats), statements_(statements) {
+        stats_.execute_total += statements_;
         exec_begin_time = SteadyClock::now();
     }
 
     ~CountExecute() {
         auto now = SteadyClock::now();
-        if (!completed_) {
-            ++stats_.error_execute_total;
-        }
+        stats_.error_execute_total += statements_ - completed_;
         stats_.sum_query_duration += now - exec_begin_time;
         stats_.last_execute_finish = now;
     }
 
     void AccountResult(ResultSet& result) {
+        UASSERT(completed_ < statements_);
         if (result.FieldCount()) ++stats_.reply_total;
-        completed_ = true;
+        ++completed_;
     }
 
 private:
     Connection::Statistics& stats_;
-    bool completed_{false};
+    const std::size_t statements_;
+    std::size_t completed_{0};
     SteadyClock::time_point exec_begin_time;
 };
 
@@ -371,7 +372,7 @@ ResultSet ConnectionImpl::ExecuteCommand(
     auto pipeline_guard = std::optional<ScopeGuard>{};
     if (IsPipelineActive() && ICaseStartsWith(query.Statement(), kStatementVacuum)) {
         conn_wrapper_.ExitPipelineMode();
-        pipeline_guard.emplace([this]() { conn_wrapper_.EnterPipelineMode(); });
+        pipeline_guard.emplace([this]() noexcept { ReenterPipelineMode(); });
     }
 
     auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(ExecuteTimeout(statement_cmd_ctl));
@@ -393,6 +394,7 @@ void ConnectionImpl::Begin(
     ++stats_.trx_total;
     if (IsPipelineActive()) {
         SendCommandNoPrepare(Query{std::string{BeginStatement(options)}}, MakeCurrentDeadline());
+        conn_wrapper_.MarkBeginResultPending();
     } else {
         ExecuteCommandNoPrepare(Query{std::string{BeginStatement(options)}}, MakeCurrentDeadline());
     }
@@ -514,6 +516,98 @@ ResultSet ConnectionImpl::PortalExecute(
     );
 }
 
+std::size_t ConnectionImpl::CopyIn(
+    const Query& query,
+    CopyInDataSource next_chunk,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    CheckBusy();
+    const auto network_timeout = ExecuteTimeout(statement_cmd_ctl);
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+    SetStatementTimeout(std::move(statement_cmd_ctl));
+    CheckDeadlineReached(deadline);
+    auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime();
+    CountExecute count_execute(stats_);
+
+    auto pipeline_guard = std::optional<ScopeGuard>{};
+    try {
+        StartCopy(query, PGRES_COPY_IN, deadline, scope, pipeline_guard);
+
+        std::string chunk;
+        bool has_more = true;
+        while (has_more) {
+            chunk.clear();
+            try {
+                has_more = next_chunk(chunk);
+            } catch (const std::exception& e) {
+                // The server rolls back the rows that were sent and fails the
+                // statement, which is expected here and is not reported
+                conn_wrapper_.PutCopyEnd(e.what(), deadline, scope);
+                conn_wrapper_.DiscardInput(deadline);
+                throw;
+            }
+            conn_wrapper_.PutCopyData(chunk, deadline, scope);
+        }
+        conn_wrapper_.PutCopyEnd(nullptr, deadline, scope);
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        throw;
+    }
+
+    return WaitResult(query.Statement(), deadline, network_timeout, count_execute, span, scope, nullptr)
+        .RowsAffected();
+}
+
+std::size_t ConnectionImpl::CopyOut(
+    const Query& query,
+    CopyOutDataSink on_data,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    CheckBusy();
+    const auto network_timeout = ExecuteTimeout(statement_cmd_ctl);
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+    SetStatementTimeout(std::move(statement_cmd_ctl));
+    CheckDeadlineReached(deadline);
+    auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
+    auto scope = span.CreateScopeTime();
+    CountExecute count_execute(stats_);
+
+    auto pipeline_guard = std::optional<ScopeGuard>{};
+    std::exception_ptr exception;
+    try {
+        StartCopy(query, PGRES_COPY_OUT, deadline, scope, pipeline_guard);
+
+        while (true) {
+            const auto data = conn_wrapper_.GetCopyData(deadline, scope);
+            if (!data.buffer) break;
+
+            // After a failure the rest of the data is drained to return the
+            // connection to the idle state
+            if (exception) continue;
+            try {
+                on_data(std::string_view{data.buffer.get(), data.size});
+            } catch (const std::exception&) {
+                exception = std::current_exception();
+                Cancel();
+            }
+        }
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        throw;
+    }
+
+    if (exception) {
+        // The statement fails with QueryCancelled which is expected here
+        span.AddTag(tracing::kErrorFlag, true);
+        conn_wrapper_.DiscardInput(deadline);
+        std::rethrow_exception(exception);
+    }
+
+    return WaitResult(query.Statement(), deadline, network_timeout, count_execute, span, scope, nullptr)
+        .RowsAffected();
+}
+
 void ConnectionImpl::Listen(std::string_view channel, OptionalCommandControl cmd_ctl) {
     ExecuteCommandNoPrepare(
         fmt::format(kStatementListen, conn_wrapper_.EscapeIdentifier(channel)),
@@ -618,6 +712,18 @@ void ConnectionImpl::Ping() {
 
 void ConnectionImpl::MarkAsBroken() { conn_wrapper_.MarkAsBroken(); }
 
+void ConnectionImpl::ReenterPipelineMode() noexcept {
+    // Runs from scope guards, possibly during stack unwinding with the
+    // connection left in a state where libpq refuses to enter pipeline mode,
+    // e.g. in the middle of COPY. Such a connection can not be reused.
+    try {
+        conn_wrapper_.EnterPipelineMode();
+    } catch (const std::exception& e) {
+        LOG_LIMITED_WARNING() << "Failed to restore pipeline mode, the connection is dropped: " << e;
+        MarkAsBroken();
+    }
+}
+
 void ConnectionImpl::CheckBusy() const {
     if ((GetConnectionState() == ConnectionState::kTranActive) &&
         (!IsPipelineActive() || conn_wrapper_.IsSyncingPipeline())) {
@@ -819,6 +925,34 @@ ResultSet ConnectionImpl::ExecuteCommand(const Query& query, engine::Deadline de
     return ExecuteCommand(query, kNoParams, deadline);
 }
 
+void ConnectionImpl::StartCopy(
+    const Query& query,
+    ExecStatusType copy_status,
+    engine::Deadline deadline,
+    tracing::ScopeTime& scope,
+    std::optional<ScopeGuard>& pipeline_guard
+) {
+    if (testsuite::AreTestpointsAvailable() && query.GetName()) {
+        ReportStatement(query.GetName()->GetUnderlying());
+    }
+
+    try {
+        if (IsPipelineActive()) {
+            // COPY is not allowed in pipeline mode, commands that are already
+            // queued (e.g. BEGIN) have to be completed first
+            conn_wrapper_.WaitResult(deadline, scope, nullptr);
+            conn_wrapper_.ExitPipelineMode();
+            pipeline_guard.emplace([this]() noexcept { ReenterPipelineMode(); });
+        }
+
+        conn_wrapper_.SendQuery(query.Statement(), scope);
+        conn_wrapper_.WaitCopyStart(deadline, scope, copy_status);
+    } catch (const ConnectionTimeoutError&) {
+        ++stats_.execute_timeout;
+        throw;
+    }
+}
+
 ResultSet ConnectionImpl::ExecuteCommand(const Query& query, const QueryParameters& params, engine::Deadline deadline) {
     if (settings_.prepared_statements == ConnectionSettings::kNoPreparedStatements) {
         return ExecuteCommandNoPrepare(query, params, deadline);
@@ -891,11 +1025,15 @@ void ConnectionImpl::AddIntoPipeline(
     conn_wrapper_.PutPipelineSync();
 }
 
-std::vector<ResultSet>
+std::vector<PipelineResult>
 ConnectionImpl::GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
     const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
     CheckDeadlineReached(deadline);
+    return GatherPipeline(deadline, descriptions);
+}
 
+std::vector<PipelineResult>
+ConnectionImpl::GatherPipeline(engine::Deadline deadline, const std::vector<ResultSet>& descriptions) {
     std::vector<const PGresult*> native_descriptions(descriptions.size(), nullptr);
     if (IsOmitDescribeInExecuteEnabled()) {
         for (std::size_t i = 0; i < descriptions.size(); ++i) {
@@ -906,7 +1044,110 @@ ConnectionImpl::GatherPipeline(TimeoutDuration timeout, const std::vector<Result
     auto result = conn_wrapper_.GatherPipeline(deadline, native_descriptions);
 
     for (auto& single_result : result) {
-        FillBufferCategories(single_result);
+        if (single_result.has_value()) {
+            FillBufferCategories(single_result.value());
+        }
+    }
+
+    return result;
+}
+
+std::vector<PipelineResult> ConnectionImpl::ExecuteBatch(
+    const std::vector<Connection::BatchStatement>& statements,
+    OptionalCommandControl batch_cmd_ctl
+) {
+    std::vector<PipelineResult> result;
+    if (statements.empty()) {
+        return result;
+    }
+
+    CheckBusy();
+    const auto network_timeout = ExecuteTimeout(batch_cmd_ctl);
+    const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+    const auto statement_cmd_ctl = [&batch_cmd_ctl](const Connection::BatchStatement& statement) {
+        return statement.statement_cmd_ctl ? statement.statement_cmd_ctl : batch_cmd_ctl;
+    };
+
+    if (!IsPipelineActive() || settings_.prepared_statements == ConnectionSettings::kNoPreparedStatements) {
+        // Nothing to gain from batching here, but the deadline is still common
+        // for all the statements
+        result.reserve(statements.size());
+        for (const auto& statement : statements) {
+            SetStatementTimeout(statement_cmd_ctl(statement));
+            try {
+                result.emplace_back(ExecuteCommand(statement.query, statement.params, deadline));
+            } catch (const ConnectionError&) {
+                throw;
+            } catch (const Error&) {
+                result.emplace_back(USERVER_NAMESPACE::utils::unexpected{std::current_exception()});
+                break;
+            }
+        }
+        return result;
+    }
+
+    DiscardOldPreparedStatements(deadline);
+    CheckDeadlineReached(deadline);
+
+    tracing::Span span{scopes::kBatch};
+    conn_wrapper_.FillSpanTags(span, {network_timeout, GetStatementTimeout()});
+    span.AddTag("batch_size", statements.size());
+    auto scope = span.CreateScopeTime();
+    CountExecute count_execute(stats_, statements.size());
+
+    try {
+        // Preparing a statement waits for the result, so all the statements are
+        // prepared before any of them is sent
+        std::vector<std::string> statement_names;
+        std::vector<ResultSet> descriptions;
+        statement_names.reserve(statements.size());
+        descriptions.reserve(statements.size());
+        for (const auto& statement : statements) {
+            const auto& text = statement.query.Statement();
+            if (settings_.ignore_unused_query_params == ConnectionSettings::kCheckUnused) {
+                CheckQueryParameters(text, statement.params);
+            }
+            if (testsuite::AreTestpointsAvailable() && statement.query.GetName()) {
+                ReportStatement(statement.query.GetName()->GetUnderlying());
+            }
+
+            const auto& prepared_info = DoPrepareStatement(text, statement.params, deadline, span, scope);
+            statement_names.push_back(prepared_info.statement_name);
+            descriptions.push_back(prepared_info.description);
+        }
+
+        // Every statement gets its own pipeline sync, so a failed statement does
+        // not prevent the server from reporting results of the other ones
+        for (std::size_t i = 0; i < statements.size(); ++i) {
+            SetStatementTimeout(statement_cmd_ctl(statements[i]));
+
+            scope.Reset(scopes::kExec);
+            PGresult* description_to_send =
+                IsOmitDescribeInExecuteEnabled() ? descriptions[i].pimpl_->handle_.get() : nullptr;
+            conn_wrapper_.SendPreparedQuery(statement_names[i], statements[i].params, scope, description_to_send);
+            conn_wrapper_.PutPipelineSync();
+        }
+
+        result = GatherPipeline(deadline, descriptions);
+    } catch (const ConnectionTimeoutError&) {
+        ++stats_.execute_timeout;
+        span.AddTag(tracing::kErrorFlag, true);
+        throw;
+    } catch (const std::exception&) {
+        span.AddTag(tracing::kErrorFlag, true);
+        throw;
+    }
+
+    if (result.size() != statements.size()) {
+        throw RuntimeError{
+            fmt::format("Batch results count mismatch: expected {}, got {}", statements.size(), result.size())};
+    }
+    for (auto& single_result : result) {
+        if (single_result.has_value()) {
+            count_execute.AccountResult(single_result.value());
+        } else {
+            span.AddTag(tracing::kErrorFlag, true);
+        }
     }
 
     return result;
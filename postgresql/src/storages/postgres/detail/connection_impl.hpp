@@ -16,10 +16,12 @@
 #include <userver/error_injection/settings_fwd.hpp>
 #include <userver/testsuite/postgres_control.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/scope_guard.hpp>
 
 #include <storages/postgres/default_command_controls.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_connection_wrapper.hpp>
+#include <userver/storages/postgres/detail/copy_binary.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/options.hpp>
@@ -89,7 +91,9 @@ public:
         const ResultSet& description,
         tracing::ScopeTime& scope
     );
-    std::vector<ResultSet> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+    std::vector<PipelineResult> GatherPipeline(TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+    std::vector<PipelineResult>
+    ExecuteBatch(const std::vector<Connection::BatchStatement>& statements, OptionalCommandControl batch_cmd_ctl);
 
     void Begin(
         const TransactionOptions& options,
@@ -116,6 +120,9 @@ public:
         OptionalCommandControl statement_cmd_ctl
     );
 
+    std::size_t CopyIn(const Query& query, CopyInDataSource next_chunk, OptionalCommandControl statement_cmd_ctl);
+    std::size_t CopyOut(const Query& query, CopyOutDataSink on_data, OptionalCommandControl statement_cmd_ctl);
+
     void Listen(std::string_view channel, OptionalCommandControl);
     void Unlisten(std::string_view channel, OptionalCommandControl);
     Notification WaitNotify(engine::Deadline deadline);
@@ -167,6 +174,20 @@ private:
 
     ResultSet ExecuteCommand(const Query& query, engine::Deadline deadline);
 
+    std::vector<PipelineResult> GatherPipeline(engine::Deadline deadline, const std::vector<ResultSet>& descriptions);
+
+    void StartCopy(
+        const Query& query,
+        ExecStatusType copy_status,
+        engine::Deadline deadline,
+        tracing::ScopeTime& scope,
+        std::optional<USERVER_NAMESPACE::utils::ScopeGuard>& pipeline_guard
+    );
+
+    // Enters pipeline mode after it was left for a single command, marks the
+    // connection broken if the connection is not idle
+    void ReenterPipelineMode() noexcept;
+
     ResultSet ExecuteCommand(const Query& query, const detail::QueryParameters& params, engine::Deadline deadline);
 
     ResultSet ExecuteCommandNoPrepare(const Query& query, engine::Deadline deadline);
@@ -20,6 +20,9 @@ auto PQXsendQueryPrepared(PGconn* conn, const char* stmtName, int nParams, const
 #include <userver_libpq_version.hpp>  // Y_IGNORE
 #endif
 
+#include <exception>
+#include <utility>
+
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/crypto/openssl.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -84,6 +87,10 @@ namespace {
 // TODO move to config
 constexpr bool kVerboseErrors = false;
 
+// libpq does not limit its output buffer on a nonblocking connection, so
+// COPY data is passed to it by pieces that are flushed one by one
+constexpr std::size_t kMaxCopyDataPiece = 64 * 1024;
+
 const char* MsgForStatus(ConnStatusType status) {
     switch (status) {
         case CONNECTION_OK:
@@ -516,14 +523,18 @@ void PGConnectionWrapper::ConsumeInput(Deadline deadline, const PGresult* descri
             }
         }
 
-        if (engine::current_task::ShouldCancel()) {
-            throw ConnectionInterrupted("Task cancelled while consuming input" + additional_info);
-        }
+        ThrowInputTimeout(std::move(additional_info));
+    }
+}
 
-        auto message = "Timeout while consuming input from PostgreSQL connection" + std::move(additional_info);
-        PGCW_LOG_LIMITED_WARNING() << message;
-        throw ConnectionTimeoutError(std::move(message));
+void PGConnectionWrapper::ThrowInputTimeout(std::string additional_info) {
+    if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted("Task cancelled while consuming input" + additional_info);
     }
+
+    auto message = "Timeout while consuming input from PostgreSQL connection" + std::move(additional_info);
+    PGCW_LOG_LIMITED_WARNING() << message;
+    throw ConnectionTimeoutError(std::move(message));
 }
 
 ResultSet PGConnectionWrapper::WaitResult(Deadline deadline, tracing::ScopeTime& scope, const PGresult* description) {
@@ -560,6 +571,99 @@ ResultSet PGConnectionWrapper::WaitResult(Deadline deadline, tracing::ScopeTime&
     return MakeResult(std::move(handle));
 }
 
+void PGConnectionWrapper::WaitCopyStart(Deadline deadline, tracing::ScopeTime& scope, ExecStatusType copy_status) {
+    scope.Reset(scopes::kLibpqWaitResult);
+    Flush(deadline);
+    auto handle = MakeResultHandle(ReadResult(deadline, nullptr));
+    const auto status = handle ? PQresultStatus(handle.get()) : PGRES_EMPTY_QUERY;
+    if (status == copy_status) return;
+
+    // Bring the connection back to the idle state before reporting the error
+    switch (status) {
+        case PGRES_COPY_IN:
+            PutCopyEnd("COPY FROM STDIN is not expected", deadline, scope);
+            break;
+        case PGRES_COPY_OUT:
+            while (GetCopyData(deadline, scope).buffer) {
+            }
+            break;
+        case PGRES_COPY_BOTH:
+            CloseWithError(NotImplemented{"Replication COPY is not supported"});
+        default:
+            // Throws if the statement failed
+            MakeResult(std::move(handle));
+    }
+    DiscardInput(deadline);
+
+    throw LogicError{fmt::format(
+        "Statement is expected to be COPY {}", copy_status == PGRES_COPY_IN ? "FROM STDIN" : "TO STDOUT"
+    )};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data, Deadline deadline, tracing::ScopeTime& scope) {
+    scope.Reset(scopes::kLibpqPutCopyData);
+    while (!data.empty()) {
+        // Data boundaries do not have to match the rows
+        const auto piece = data.substr(0, kMaxCopyDataPiece);
+        const auto ret = PQputCopyData(conn_, piece.data(), static_cast<int>(piece.size()));
+        if (ret < 0) {
+            HandleSocketPostClose();
+            throw CommandError(std::string{"PQputCopyData execution error: "} + PQerrorMessage(conn_));
+        }
+        // Send the piece before queueing the next one. Nonblocking libpq
+        // grows the buffer instead of reporting it is full, so PQputCopyData
+        // returning 0 is not enough to keep the memory bounded.
+        Flush(deadline);
+        if (ret > 0) data.remove_prefix(piece.size());
+    }
+    UpdateLastUse();
+}
+
+void PGConnectionWrapper::PutCopyEnd(const char* error_message, Deadline deadline, tracing::ScopeTime& scope) {
+    scope.Reset(scopes::kLibpqPutCopyData);
+    while (true) {
+        const auto ret = PQputCopyEnd(conn_, error_message);
+        if (ret < 0) {
+            HandleSocketPostClose();
+            throw CommandError(std::string{"PQputCopyEnd execution error: "} + PQerrorMessage(conn_));
+        }
+        if (ret > 0) break;
+        Flush(deadline);
+    }
+    Flush(deadline);
+    UpdateLastUse();
+}
+
+PGConnectionWrapper::CopyData PGConnectionWrapper::GetCopyData(Deadline deadline, tracing::ScopeTime& scope) {
+    scope.Reset(scopes::kLibpqGetCopyData);
+    CopyData data;
+    while (true) {
+        char* buffer = nullptr;
+        const auto ret = PQgetCopyData(conn_, &buffer, /* async */ 1);
+        if (ret > 0) {
+            data.buffer.reset(buffer);
+            data.size = ret;
+            return data;
+        }
+        if (ret == -1) {
+            // COPY is done
+            return data;
+        }
+        if (ret < -1) {
+            HandleSocketPostClose();
+            throw CommandError(std::string{"PQgetCopyData execution error: "} + PQerrorMessage(conn_));
+        }
+
+        // No complete row is buffered yet
+        HandleSocketPostClose();
+        if (!WaitSocketReadable(deadline)) {
+            ThrowInputTimeout(" for 'COPY' command");
+        }
+        CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+        UpdateLastUse();
+    }
+}
+
 Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
     auto notify = std::unique_ptr<PGnotify, decltype(&PQfreemem)>(PQnotifies(conn_), &PQfreemem);
     while (!notify) {
@@ -577,7 +681,7 @@ Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
     return result;
 }
 
-std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
+std::vector<PipelineResult> PGConnectionWrapper::GatherPipeline(
     [[maybe_unused]] Deadline deadline,
     const std::vector<const PGresult*>& descriptions
 ) {
@@ -588,8 +692,18 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
 #else
     Flush(deadline);
 
-    std::vector<ResultSet> result{};
+    std::vector<PipelineResult> result{};
+    result.reserve(descriptions.size());
+    const auto next_description = [&result, &descriptions]() -> const PGresult* {
+        return result.size() < descriptions.size() ? descriptions[result.size()] : nullptr;
+    };
     const PGresult* current_description = descriptions.front();
+    // The result of a BEGIN that was not awaited comes before the results of
+    // the queries
+    bool skip_begin_result = is_begin_result_pending_;
+    // A failed BEGIN aborts the rest of its pipeline segment, i.e. the first
+    // query. The error is reported in place of the result of that query.
+    std::exception_ptr begin_error;
 
     std::size_t null_res_counter{0};
     while (IsSyncingPipeline() && PQstatus(conn_) != CONNECTION_BAD) {
@@ -601,6 +715,10 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
             const auto status = PQresultStatus(pg_res);
             if (status == PGRES_PIPELINE_SYNC) {
                 HandlePipelineSync();
+                if (begin_error) {
+                    result.emplace_back(USERVER_NAMESPACE::utils::unexpected{std::exchange(begin_error, nullptr)});
+                    current_description = next_description();
+                }
             } else if (status != PGRES_PIPELINE_ABORTED) {
                 handle = std::move(next_handle);
             }
@@ -622,8 +740,24 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
                 const auto* first_field_name = PQfname(handle.get(), 0);
                 return first_field_name != nullptr && std::string_view{first_field_name} == kSetConfigQueryResultName;
             }();
-            if (!is_set_config_response) {
-                result.push_back(MakeResult(std::move(handle)));
+            if (std::exchange(skip_begin_result, false)) {
+                if (PQresultStatus(handle.get()) != PGRES_COMMAND_OK) {
+                    try {
+                        MakeResult(std::move(handle));
+                    } catch (const Error&) {
+                        if (!conn_) throw;
+                        begin_error = std::current_exception();
+                    }
+                }
+            } else if (!is_set_config_response && !begin_error) {
+                try {
+                    result.emplace_back(MakeResult(std::move(handle)));
+                } catch (const Error&) {
+                    // The connection is closed on unrecoverable errors, there are
+                    // no more results to gather.
+                    if (!conn_) throw;
+                    result.emplace_back(USERVER_NAMESPACE::utils::unexpected{std::current_exception()});
+                }
             }
         }
 
@@ -633,9 +767,12 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
         // We do it this way instead of 1:1 matching because we need to feed
         // something into the last ReadResult call, which is expected to just return
         // null right away. And if it doesn't -- we get an error, as we should.
-        current_description = result.size() < descriptions.size() ? descriptions[result.size()] : nullptr;
+        current_description = next_description();
     }
 
+    if (begin_error) {
+        result.emplace_back(USERVER_NAMESPACE::utils::unexpected{std::move(begin_error)});
+    }
     return result;
 #endif
 }
@@ -672,7 +809,9 @@ void PGConnectionWrapper::FillSpanTags(tracing::Span& span, const CommandControl
 
 PGresult* PGConnectionWrapper::ReadResult(Deadline deadline, const PGresult* description) {
     ConsumeInput(deadline, description);
-    return PQXgetResult(conn_, description);
+    auto* result = PQXgetResult(conn_, description);
+    if (result) is_begin_result_pending_ = false;
+    return result;
 }
 
 ResultSet PGConnectionWrapper::MakeResult(ResultHandle&& handle) {
@@ -698,9 +837,10 @@ ResultSet PGConnectionWrapper::MakeResult(ResultHandle&& handle) {
         case PGRES_COPY_IN:
         case PGRES_COPY_OUT:
         case PGRES_COPY_BOTH:
-            PGCW_LOG_LIMITED_ERROR() << "PostgreSQL COPY command invoked which is not implemented"
+            PGCW_LOG_LIMITED_ERROR() << "PostgreSQL COPY command invoked via Execute, use Transaction::CopyIn or "
+                                        "Transaction::CopyOut instead"
                                      << logging::LogExtra::Stacktrace();
-            CloseWithError(NotImplemented{"Copy is not implemented"});
+            CloseWithError(NotImplemented{"COPY is only supported via Transaction::CopyIn and Transaction::CopyOut"});
         case PGRES_BAD_RESPONSE:
             CloseWithError(ConnectionError{"Failed to parse server response"});
         case PGRES_NONFATAL_ERROR: {
@@ -964,6 +1104,8 @@ std::string PGConnectionWrapper::EscapeIdentifier(std::string_view str) {
     return {result.get()};
 }
 
+void PGConnectionWrapper::MarkBeginResultPending() { is_begin_result_pending_ = true; }
+
 void PGConnectionWrapper::PutPipelineSync() {
 #if !LIBPQ_HAS_PIPELINING
     UINVARIANT(false, "Pipeline mode is not supported");
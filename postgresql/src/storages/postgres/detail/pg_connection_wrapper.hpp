@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
 #include <string_view>
 
 #include <libpq-fe.h>
@@ -109,6 +110,29 @@ public:
     /// @brief Wrapper for PQXSendPortalExecute
     void SendPortalExecute(const std::string& portal_name, std::uint32_t n_rows, tracing::ScopeTime&);
 
+    /// @brief Wait for the connection to enter COPY IN or COPY OUT state after
+    /// a COPY statement was sent
+    /// @throws LogicError if the statement is not a COPY of the expected
+    /// direction, or the error that the statement failed with
+    void WaitCopyStart(Deadline deadline, tracing::ScopeTime&, ExecStatusType copy_status);
+
+    /// @brief Wrapper for PQputCopyData, sends the data before returning
+    void PutCopyData(std::string_view data, Deadline deadline, tracing::ScopeTime&);
+
+    /// @brief Wrapper for PQputCopyEnd, non-null `error_message` makes the
+    /// server fail the COPY
+    void PutCopyEnd(const char* error_message, Deadline deadline, tracing::ScopeTime&);
+
+    struct CopyData {
+        std::unique_ptr<char, decltype(&PQfreemem)> buffer{nullptr, &PQfreemem};
+        std::size_t size{0};
+    };
+
+    /// @brief Wrapper for PQgetCopyData
+    /// Returns an empty buffer after the last message, the command result
+    /// should be read with WaitResult after that
+    CopyData GetCopyData(Deadline deadline, tracing::ScopeTime&);
+
     /// @brief Wait for query result
     /// Will return result or throw an exception
     ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&, const PGresult* description);
@@ -116,7 +140,13 @@ public:
     /// @brief Wait for notification
     Notification WaitNotify(Deadline deadline);
 
-    std::vector<ResultSet> GatherPipeline(Deadline deadline, const std::vector<const PGresult*>& descriptions);
+    /// @brief Gather results of the queries that were sent with a pipeline sync
+    /// after each of them.
+    /// Server errors are reported per query, so that all the results are
+    /// consumed even if some of the queries failed. Errors that make the
+    /// connection unusable are thrown.
+    std::vector<PipelineResult>
+    GatherPipeline(Deadline deadline, const std::vector<const PGresult*>& descriptions);
 
     /// Consume input from connection
     void ConsumeInput(Deadline deadline, const PGresult* description);
@@ -148,6 +178,11 @@ public:
 
     void PutPipelineSync();
 
+    /// Marks the last sent query as a BEGIN of a transaction that is not
+    /// awaited in pipeline mode. If no result was read since then, its result
+    /// comes first and GatherPipeline drops it.
+    void MarkBeginResultPending();
+
 private:
     PGTransactionStatusType GetTransactionStatus() const;
 
@@ -167,6 +202,8 @@ private:
 
     void Flush(Deadline deadline);
 
+    [[noreturn]] void ThrowInputTimeout(std::string additional_info);
+
     PGresult* ReadResult(Deadline deadline, const PGresult* description);
 
     ResultSet MakeResult(ResultHandle&& handle);
@@ -193,6 +230,7 @@ private:
     std::chrono::steady_clock::time_point last_use_;
     size_t pipeline_sync_counter_{0};
     bool is_broken_{false};
+    bool is_begin_result_pending_{false};
 };
 
 }  // namespace storages::postgres::detail
@@ -20,6 +20,8 @@ const std::string kPrepare = "pg_prepare";
 const std::string kBind = "pg_bind";
 /// Execute query, driver level
 const std::string kExec = "pg_exec";
+/// Execute a batch of queries, top driver level
+const std::string kBatch = "pg_batch";
 
 // libpq stages
 /// libpq async connect stage
@@ -36,6 +38,10 @@ const std::string kLibpqSendPrepare = "libpq_send_prepare";
 const std::string kLibpqSendDescribePrepared = "libpq_send_describe_prepared";
 /// libpq send query prepared stage
 const std::string kLibpqSendQueryPrepared = "libpq_send_query_prepared";
+/// libpq put copy data stage
+const std::string kLibpqPutCopyData = "libpq_put_copy_data";
+/// libpq get copy data stage
+const std::string kLibpqGetCopyData = "libpq_get_copy_data";
 /// libpq-missing send bind portal
 const std::string kPqSendPortalBind = "pq_send_portal_bind";
 /// libpq-missing send execute portal
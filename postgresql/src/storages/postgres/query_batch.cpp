@@ -0,0 +1,30 @@
+#include <userver/storages/postgres/query_batch.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+detail::QueryParameters WriteStoredParams(
+    const UserTypes&,
+    const USERVER_NAMESPACE::utils::AnyMovable& args,
+    detail::DynamicQueryParameters&
+) {
+    // Parameters of the store are already serialized
+    return detail::QueryParameters{USERVER_NAMESPACE::utils::AnyCast<const ParameterStore&>(args).GetInternalData()};
+}
+
+}  // namespace
+
+void QueryBatch::Push(CommandControl cc, const Query& query, ParameterStore&& store) {
+    statements_.push_back(Statement{query, cc, std::move(store), &WriteStoredParams});
+}
+
+void QueryBatch::Push(const Query& query, ParameterStore&& store) {
+    statements_.push_back(Statement{query, OptionalCommandControl{}, std::move(store), &WriteStoredParams});
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
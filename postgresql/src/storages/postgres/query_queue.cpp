@@ -1,5 +1,7 @@
 #include <userver/storages/postgres/query_queue.hpp>
 
+#include <exception>
+
 #include <fmt/format.h>
 
 #include <storages/postgres/detail/connection.hpp>
@@ -48,6 +50,24 @@ void QueryQueue::Reserve(std::size_t size) {
 std::vector<ResultSet> QueryQueue::Collect() { return QueryQueue::Collect(default_cc_.execute); }
 
 std::vector<ResultSet> QueryQueue::Collect(TimeoutDuration timeout) {
+    auto results = CollectWithErrors(timeout);
+
+    std::vector<ResultSet> result;
+    result.reserve(results.size());
+    for (auto& single_result : results) {
+        if (!single_result.has_value()) {
+            std::rethrow_exception(single_result.error());
+        }
+        result.push_back(std::move(single_result).value());
+    }
+    return result;
+}
+
+std::vector<QueryQueue::Result> QueryQueue::CollectWithErrors() {
+    return QueryQueue::CollectWithErrors(default_cc_.execute);
+}
+
+std::vector<QueryQueue::Result> QueryQueue::CollectWithErrors(TimeoutDuration timeout) {
     ValidateUsage();
 
     tracing::Span collect_span{"query_queue_collect"};
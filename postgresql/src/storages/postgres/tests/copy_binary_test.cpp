@@ -0,0 +1,84 @@
+#include <userver/storages/postgres/detail/copy_binary.hpp>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include <userver/storages/postgres/io/floating_point_types.hpp>
+#include <userver/storages/postgres/io/optional.hpp>
+#include <userver/storages/postgres/io/string_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+const pg::UserTypes types;
+
+struct Aggregate {
+    int id{};
+    std::string name;
+    std::optional<double> value;
+};
+
+}  // namespace
+
+TEST(PostgreCopyBinary, RowRoundtrip) {
+    const std::tuple<int, std::string, std::optional<double>> row{42, "forty two", std::nullopt};
+
+    std::string buffer;
+    pg::detail::WriteCopyBinaryRow(types, buffer, row);
+    // field count, 3 field lengths, int, string and no data for NULL
+    EXPECT_EQ(buffer.size(), 2 + 3 * 4 + 4 + 9);
+
+    Aggregate parsed;
+    pg::detail::ReadCopyBinaryRow(buffer, parsed, types.GetTypeBufferCategories());
+    EXPECT_EQ(parsed.id, 42);
+    EXPECT_EQ(parsed.name, "forty two");
+    EXPECT_FALSE(parsed.value);
+}
+
+TEST(PostgreCopyBinary, SingleValue) {
+    std::string buffer;
+    pg::detail::WriteCopyBinaryRow(types, buffer, std::string{"value"});
+
+    std::string parsed;
+    pg::detail::ReadCopyBinaryRow(buffer, parsed, types.GetTypeBufferCategories());
+    EXPECT_EQ(parsed, "value");
+
+    int not_enough_fields{};
+    EXPECT_THROW(
+        pg::detail::ReadCopyBinaryRow(buffer, not_enough_fields, types.GetTypeBufferCategories()),
+        pg::InvalidInputBufferSize
+    );
+
+    std::tuple<std::string, int> too_many_fields;
+    EXPECT_THROW(
+        pg::detail::ReadCopyBinaryRow(buffer, too_many_fields, types.GetTypeBufferCategories()),
+        pg::InvalidTupleSizeRequested
+    );
+}
+
+TEST(PostgreCopyBinary, Reader) {
+    std::string row;
+    pg::detail::WriteCopyBinaryRow(types, row, 1);
+
+    pg::detail::CopyBinaryReader reader;
+    EXPECT_EQ(reader.GetRow(std::string{pg::detail::kCopyBinaryHeader} + row), row);
+    EXPECT_EQ(reader.GetRow(row), row);
+    EXPECT_EQ(reader.GetRow(pg::detail::kCopyBinaryTrailer), std::nullopt);
+
+    pg::detail::CopyBinaryReader empty_reader;
+    EXPECT_EQ(
+        empty_reader.GetRow(std::string{pg::detail::kCopyBinaryHeader} + std::string{pg::detail::kCopyBinaryTrailer}),
+        std::nullopt
+    );
+
+    pg::detail::CopyBinaryReader text_reader;
+    EXPECT_THROW(text_reader.GetRow("1\tfoo\n"), pg::InvalidBinaryBuffer);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,121 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/io/floating_point_types.hpp>
+#include <userver/storages/postgres/io/optional.hpp>
+#include <userver/storages/postgres/io/string_types.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+struct CopyRow {
+    int id{};
+    std::string name;
+    std::optional<double> value;
+};
+
+constexpr std::size_t kRowsCount = 10'000;
+
+std::vector<CopyRow> MakeRows() {
+    std::vector<CopyRow> rows;
+    rows.reserve(kRowsCount);
+    for (std::size_t i = 0; i < kRowsCount; ++i) {
+        const auto value = i % 3 ? std::optional<double>{i * 0.5} : std::nullopt;
+        rows.push_back({static_cast<int>(i), "row " + std::to_string(i), value});
+    }
+    return rows;
+}
+
+}  // namespace
+
+UTEST_P(PostgreConnection, CopyInOut) {
+    CheckConnection(GetConn());
+
+    GetConn()->Execute("create temporary table copy_test(id integer, name text, value double precision)");
+    const auto rows = MakeRows();
+
+    pg::Transaction trx{std::move(GetConn())};
+    EXPECT_EQ(trx.CopyIn("copy copy_test (id, name, value) from stdin (format binary)", rows), kRowsCount);
+
+    auto res = trx.Execute("select count(*) from copy_test");
+    EXPECT_EQ(kRowsCount, res.Front().As<pg::Bigint>(pg::kFieldTag));
+
+    std::size_t received = 0;
+    const auto copied = trx.CopyOut<CopyRow>(
+        "copy (select id, name, value from copy_test order by id) to stdout (format binary)",
+        [&](CopyRow&& row) {
+            ASSERT_LT(received, rows.size());
+            const auto& expected = rows[received++];
+            EXPECT_EQ(expected.id, row.id);
+            EXPECT_EQ(expected.name, row.name);
+            EXPECT_EQ(expected.value, row.value);
+        }
+    );
+    EXPECT_EQ(copied, kRowsCount);
+    EXPECT_EQ(received, kRowsCount);
+
+    std::vector<int> ids;
+    trx.CopyOut<int>("copy (select id from copy_test where id < 10) to stdout (format binary)", [&](int id) {
+        ids.push_back(id);
+    });
+    EXPECT_EQ(ids.size(), 10);
+
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyEmpty) {
+    CheckConnection(GetConn());
+
+    GetConn()->Execute("create temporary table copy_empty_test(id integer)");
+
+    pg::Transaction trx{std::move(GetConn())};
+    EXPECT_EQ(trx.CopyIn("copy copy_empty_test from stdin (format binary)", std::vector<int>{}), 0);
+    EXPECT_EQ(trx.CopyOut<int>("copy copy_empty_test to stdout (format binary)", [](int) { FAIL(); }), 0);
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyOutCallbackThrows) {
+    CheckConnection(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    UEXPECT_THROW(
+        trx.CopyOut<pg::Bigint>(
+            "copy (select generate_series(1, 1000000)::bigint) to stdout (format binary)",
+            [](pg::Bigint value) {
+                if (value == 10) throw std::runtime_error{"stop"};
+            }
+        ),
+        std::runtime_error
+    );
+    trx.Rollback();
+}
+
+UTEST_P(PostgreConnection, CopyWrongStatement) {
+    CheckConnection(GetConn());
+
+    GetConn()->Execute("create temporary table copy_wrong_test(id integer)");
+
+    pg::Transaction trx{std::move(GetConn())};
+    UEXPECT_THROW(trx.CopyIn("copy copy_wrong_test to stdout (format binary)", std::vector<int>{1}), pg::LogicError);
+    UEXPECT_THROW(trx.CopyIn("select 1", std::vector<int>{1}), pg::LogicError);
+
+    // The connection is still usable
+    const auto res = trx.Execute("select 1");
+    EXPECT_EQ(1, res.Front().As<int>());
+
+    // COPY FROM STDIN is aborted, that fails the transaction
+    UEXPECT_THROW(trx.CopyOut<int>("copy copy_wrong_test from stdin (format binary)", [](int) {}), pg::LogicError);
+    trx.Rollback();
+}
+
+USERVER_NAMESPACE_END
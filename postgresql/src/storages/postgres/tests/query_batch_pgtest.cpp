@@ -0,0 +1,161 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/io/string_types.hpp>
+#include <userver/storages/postgres/query_batch.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+constexpr pg::TimeoutDuration kBatchTimeout{utest::kMaxTestWaitTime};
+constexpr pg::CommandControl kBatchCC{kBatchTimeout, kBatchTimeout};
+
+}  // namespace
+
+UTEST_P(PostgreConnection, QueryBatchSelectMultiple) {
+    CheckConnection(GetConn());
+
+    constexpr int kStatementsCount = 5;
+    pg::QueryBatch batch;
+    batch.Reserve(kStatementsCount);
+    for (int i = 0; i < kStatementsCount; ++i) {
+        batch.Push("select $1", i);
+    }
+    EXPECT_EQ(batch.Size(), kStatementsCount);
+
+    pg::Transaction trx{std::move(GetConn())};
+    std::vector<pg::ResultSet> results;
+    UEXPECT_NO_THROW(results = trx.ExecuteBatch(kBatchCC, batch));
+
+    ASSERT_EQ(results.size(), kStatementsCount);
+    for (int i = 0; i < kStatementsCount; ++i) {
+        EXPECT_EQ(i, results[i].AsSingleRow<int>());
+    }
+
+    // The batch stays usable after the execution
+    UEXPECT_NO_THROW(results = trx.ExecuteBatch(batch));
+    EXPECT_EQ(results.size(), kStatementsCount);
+
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, QueryBatchMixedStatements) {
+    CheckConnection(GetConn());
+
+    GetConn()->Execute("create temporary table batch_test(id integer primary key, name text)");
+
+    using RowTuple = std::tuple<int, std::string>;
+    pg::ParameterStore store;
+    store.PushBack(2).PushBack(std::string{"two"});
+
+    pg::QueryBatch batch;
+    batch.Push("insert into batch_test(id, name) values($1, $2)", 1, std::string{"one"});
+    batch.Push("insert into batch_test(id, name) values($1, $2)", std::move(store));
+    batch.Push(kBatchCC, "update batch_test set name = name || $1 where id = $2", std::string{"!"}, 1);
+    batch.Push("select id, name from batch_test order by id");
+
+    pg::Transaction trx{std::move(GetConn())};
+    const auto results = trx.ExecuteBatch(batch);
+    ASSERT_EQ(results.size(), 4);
+    EXPECT_EQ(results[0].RowsAffected(), 1);
+    EXPECT_EQ(results[1].RowsAffected(), 1);
+    EXPECT_EQ(results[2].RowsAffected(), 1);
+
+    const auto rows = results[3].AsContainer<std::vector<RowTuple>>(pg::kRowTag);
+    EXPECT_EQ(rows, (std::vector<RowTuple>{{1, "one!"}, {2, "two"}}));
+
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, QueryBatchEmpty) {
+    CheckConnection(GetConn());
+
+    pg::Transaction trx{std::move(GetConn())};
+    std::vector<pg::ResultSet> results;
+    UEXPECT_NO_THROW(results = trx.ExecuteBatch(pg::QueryBatch{}));
+    EXPECT_TRUE(results.empty());
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, QueryBatchUserBegin) {
+    CheckConnection(GetConn());
+
+    pg::QueryBatch batch;
+    // Only a warning inside of a transaction, the result must not be mistaken
+    // for the BEGIN of the transaction itself
+    batch.Push("begin");
+    batch.Push("select $1", 1);
+
+    pg::Transaction trx{std::move(GetConn())};
+    std::vector<pg::ResultSet> results;
+    UEXPECT_NO_THROW(results = trx.ExecuteBatch(batch));
+    ASSERT_EQ(results.size(), 2);
+    EXPECT_EQ(results[0].Size(), 0);
+    EXPECT_EQ(results[1].AsSingleRow<int>(), 1);
+    trx.Commit();
+}
+
+UTEST_P(PostgreConnection, QueryBatchFirstError) {
+    CheckConnection(GetConn());
+
+    GetConn()->Execute("create temporary table batch_test(id integer primary key)");
+
+    pg::QueryBatch batch;
+    batch.Push("insert into batch_test(id) values($1)", 1);
+    batch.Push("insert into batch_test(id) values($1)", 1);
+    batch.Push("select count(*) from batch_test");
+
+    pg::Transaction trx{std::move(GetConn())};
+    UEXPECT_THROW(trx.ExecuteBatch(batch), pg::UniqueViolation);
+    UEXPECT_NO_THROW(trx.Rollback());
+}
+
+UTEST_P(PostgreConnection, QueryBatchFailedBegin) {
+    CheckConnection(GetConn());
+    if (!GetConn()->IsPipelineActive()) {
+        GTEST_SKIP() << "The result of BEGIN is awaited without pipelining";
+    }
+    // The only BEGIN that reliably fails is a read-write one on a hot standby
+    if (!GetConn()->Execute("select pg_is_in_recovery()").AsSingleRow<bool>()) {
+        GTEST_SKIP() << "The server is not a hot standby";
+    }
+
+    // Prepared beforehand, so the BEGIN result is gathered with the batch
+    GetConn()->Execute("select $1", 0);
+
+    pg::QueryBatch batch;
+    batch.Push("select $1", 1);
+    batch.Push("select $1", 2);
+
+    // The BEGIN error takes the place of the first result instead of being an
+    // extra one, which would fail the results count check
+    pg::Transaction trx{
+        std::move(GetConn()),
+        pg::TransactionOptions{pg::IsolationLevel::kReadCommitted, pg::TransactionOptions::kReadWrite}};
+    UEXPECT_THROW(trx.ExecuteBatch(batch), pg::InvalidTransactionState);
+    UEXPECT_NO_THROW(trx.Rollback());
+}
+
+UTEST_P(PostgreConnection, QueryBatchTimeout) {
+    CheckConnection(GetConn());
+
+    pg::QueryBatch batch;
+    batch.Push("select 1");
+    batch.Push("select pg_sleep(5)");
+
+    pg::Transaction trx{std::move(GetConn())};
+    UEXPECT_THROW(
+        trx.ExecuteBatch(pg::CommandControl{std::chrono::milliseconds{100}, kBatchTimeout}, batch),
+        pg::ConnectionTimeoutError
+    );
+}
+
+USERVER_NAMESPACE_END
@@ -88,6 +88,30 @@ UTEST_P(PostgreConnection, QueryQueueTimeout) {
     UEXPECT_THROW(result = query_queue.Collect(std::chrono::milliseconds{100}), pg::ConnectionTimeoutError);
 }
 
+UTEST_P(PostgreConnection, QueryQueueCollectWithErrors) {
+    CheckConnection(GetConn());
+    if (!GetConn()->IsPipelineActive()) {
+        return;
+    }
+
+    pg::QueryQueue query_queue{kDefaultCC, std::move(GetConn())};
+
+    UEXPECT_NO_THROW(query_queue.Push(kDefaultCC, "SELECT 1"));
+    UEXPECT_NO_THROW(query_queue.Push(kDefaultCC, "SELECT 1 / $1", 0));
+    UEXPECT_NO_THROW(query_queue.Push(kDefaultCC, "SELECT 3"));
+
+    std::vector<pg::QueryQueue::Result> result{};
+    UEXPECT_NO_THROW(result = query_queue.CollectWithErrors(kCollectTimeout));
+
+    ASSERT_EQ(3, result.size());
+    ASSERT_TRUE(result[0].has_value());
+    EXPECT_EQ(1, result[0].value().AsSingleRow<int>());
+    ASSERT_FALSE(result[1].has_value());
+    UEXPECT_THROW(std::rethrow_exception(result[1].error()), pg::DataException);
+    ASSERT_TRUE(result[2].has_value());
+    EXPECT_EQ(3, result[2].value().AsSingleRow<int>());
+}
+
 UTEST_P(PostgreConnection, QueryQueueEmpty) {
     CheckConnection(GetConn());
     if (!GetConn()->IsPipelineActive()) {
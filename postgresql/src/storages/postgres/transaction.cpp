@@ -1,5 +1,7 @@
 #include <userver/storages/postgres/transaction.hpp>
 
+#include <exception>
+
 #include <storages/postgres/deadline.hpp>
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/statement_stats.hpp>
@@ -81,6 +83,66 @@ ResultSet Transaction::DoExecute(
     }
 }
 
+std::vector<ResultSet> Transaction::ExecuteBatch(OptionalCommandControl batch_cmd_ctl, const QueryBatch& batch) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "ExecuteBatch called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    const auto& batch_statements = batch.GetStatements();
+    if (batch_statements.empty()) {
+        return {};
+    }
+    auto source = conn_.GetConfigSource();
+    if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+    // Serialized parameters should not move until the batch is executed
+    std::vector<detail::DynamicQueryParameters> params_storage(batch_statements.size());
+    std::vector<detail::Connection::BatchStatement> statements;
+    std::vector<detail::StatementStats> stats;
+    statements.reserve(batch_statements.size());
+    stats.reserve(batch_statements.size());
+    for (std::size_t i = 0; i < batch_statements.size(); ++i) {
+        const auto& statement = batch_statements[i];
+        auto statement_cmd_ctl = statement.statement_cmd_ctl;
+        if (!statement_cmd_ctl) {
+            statement_cmd_ctl = conn_->GetQueryCmdCtl(statement.query.GetName());
+        }
+        statements.push_back(
+            {statement.query,
+             statement.write_params(conn_->GetUserTypes(), statement.args, params_storage[i]),
+             std::move(statement_cmd_ctl)}
+        );
+        stats.emplace_back(statement.query, conn_);
+    }
+
+    std::vector<detail::PipelineResult> results;
+    try {
+        results = conn_->ExecuteBatch(statements, std::move(batch_cmd_ctl));
+    } catch (const std::exception& e) {
+        for (auto& statement_stats : stats) statement_stats.AccountStatementError();
+        throw;
+    }
+
+    std::vector<ResultSet> result;
+    result.reserve(results.size());
+    std::exception_ptr first_error;
+    for (std::size_t i = 0; i < stats.size(); ++i) {
+        if (i < results.size() && results[i].has_value()) {
+            stats[i].AccountStatementExecution();
+            result.push_back(std::move(results[i]).value());
+        } else {
+            // Statements after the failed one are either not executed or fail
+            // because the transaction is aborted
+            stats[i].AccountStatementError();
+            if (!first_error && i < results.size()) first_error = results[i].error();
+        }
+    }
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+    return result;
+}
+
 Portal Transaction::MakePortal(
     const PortalName& portal_name,
     const Query& query,
@@ -104,6 +166,58 @@ Portal Transaction::MakePortal(
     return Portal{conn_.get(), portal_name, query, params, std::move(statement_cmd_ctl)};
 }
 
+std::size_t Transaction::DoCopyIn(
+    const Query& query,
+    detail::CopyInDataSource next_chunk,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "CopyIn called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    if (!statement_cmd_ctl) {
+        statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+    }
+    auto source = conn_.GetConfigSource();
+    if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+    detail::StatementStats stats{query, conn_};
+    try {
+        const auto rows = conn_->CopyIn(query, next_chunk, std::move(statement_cmd_ctl));
+        stats.AccountStatementExecution();
+        return rows;
+    } catch (const std::exception& e) {
+        stats.AccountStatementError();
+        throw;
+    }
+}
+
+std::size_t Transaction::DoCopyOut(
+    const Query& query,
+    detail::CopyOutDataSink on_data,
+    OptionalCommandControl statement_cmd_ctl
+) {
+    if (!conn_) {
+        LOG_LIMITED_ERROR() << "CopyOut called after transaction finished" << logging::LogExtra::Stacktrace();
+        throw NotInTransaction("Transaction handle is not valid");
+    }
+    if (!statement_cmd_ctl) {
+        statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+    }
+    auto source = conn_.GetConfigSource();
+    if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+    detail::StatementStats stats{query, conn_};
+    try {
+        const auto rows = conn_->CopyOut(query, on_data, std::move(statement_cmd_ctl));
+        stats.AccountStatementExecution();
+        return rows;
+    } catch (const std::exception& e) {
+        stats.AccountStatementError();
+        throw;
+    }
+}
+
 void Transaction::SetParameter(const std::string& param_name, const std::string& value) {
     if (!conn_) {
         LOG_LIMITED_ERROR() << "Set parameter called after transaction finished" << logging::LogExtra::Stacktrace();
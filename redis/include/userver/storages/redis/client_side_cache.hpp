@@ -0,0 +1,111 @@
+#pragma once
+
+/// @file userver/storages/redis/client_side_cache.hpp
+/// @brief @copybrief storages::redis::ClientSideCache
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/storages/redis/base.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_control.hpp>
+#include <userver/storages/redis/reply_types.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// Settings of the storages::redis::ClientSideCache
+struct ClientSideCacheSettings final {
+    /// Only the keys with this prefix are cached, empty prefix caches all the
+    /// keys
+    std::string key_prefix;
+
+    /// Maximum number of cached keys
+    std::size_t max_size{10000};
+
+    /// Number of independently locked LRU parts, reduces contention for hot
+    /// keys
+    std::size_t ways{16};
+
+    /// Cached values are dropped after this period even if no invalidation
+    /// arrived, bounds the staleness in case of lost notifications
+    std::chrono::milliseconds max_staleness{std::chrono::seconds{5}};
+};
+
+/// @ingroup userver_clients
+///
+/// @brief Opt-in local cache for GET/HGET/MGET reads of a Redis client.
+///
+/// Cached keys are invalidated by Redis keyspace notifications received over
+/// the connections of the storages::redis::SubscribeClient, so the
+/// `notify-keyspace-events` server option must include at least `K` and the
+/// event classes of the commands that modify the cached keys (e.g. `K$gh`).
+///
+/// Writes made through the cache invalidate the local values right away, the
+/// time until the server notification arrives is reported as the invalidation
+/// lag.
+///
+/// @code
+/// storages::redis::ClientSideCache cache{client, subscribe_client, {"hot:"}};
+/// auto value = cache.Get("hot:config", cc);  // goes to Redis
+/// value = cache.Get("hot:config", cc);       // served locally
+/// @endcode
+///
+/// @warning Redis does not guarantee the delivery of pub/sub messages, values
+/// may stay stale for up to ClientSideCacheSettings::max_staleness. In cluster
+/// mode the notifications are received from a single node only, so the cache
+/// is only consistent for the keys of that node.
+class ClientSideCache final {
+public:
+    ClientSideCache(ClientPtr client, SubscribeClientPtr subscribe_client, ClientSideCacheSettings settings);
+
+    ClientSideCache(ClientSideCache&&) = delete;
+    ClientSideCache& operator=(ClientSideCache&&) = delete;
+
+    ~ClientSideCache();
+
+    std::optional<std::string> Get(std::string key, const CommandControl& command_control);
+
+    std::optional<std::string> Hget(std::string key, std::string field, const CommandControl& command_control);
+
+    /// Only the keys missing in the cache are requested from Redis, same
+    /// sharding restrictions as for storages::redis::Client::Mget apply.
+    std::vector<std::optional<std::string>> Mget(std::vector<std::string> keys, const CommandControl& command_control);
+
+    void Set(std::string key, std::string value, const CommandControl& command_control);
+
+    std::size_t Del(std::string key, const CommandControl& command_control);
+
+    HsetReply Hset(std::string key, std::string field, std::string value, const CommandControl& command_control);
+
+    /// Drops the cached values of the key
+    void Invalidate(const std::string& key);
+
+    /// Drops all the cached values
+    void InvalidateAll();
+
+    /// Returns the number of cached keys
+    std::size_t GetSize() const;
+
+    /// @cond
+    /// For internal use and tests only
+    void OnKeyspaceNotification(const std::string& channel, const std::string& event);
+    /// @endcond
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const ClientSideCache& cache);
+
+private:
+    struct Impl;
+
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,366 @@
+#include <userver/storages/redis/client_side_cache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/cache/lru_map.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/subscribe_client.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/scope_guard.hpp>
+#include <userver/utils/statistics/percentile.hpp>
+#include <userver/utils/statistics/recentperiod.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+constexpr std::string_view kKeyspaceChannelPrefix = "__keyspace@";
+constexpr std::string_view kKeyspaceChannelKeyDelimiter = "__:";
+
+// Writes made through the cache are remembered to measure the invalidation
+// lag, the map is dropped if notifications do not arrive for too long
+constexpr std::size_t kMaxPendingWritesPerWay = 1024;
+
+using Clock = std::chrono::steady_clock;
+
+std::string EscapeGlob(std::string_view str) {
+    std::string result;
+    result.reserve(str.size());
+    for (const char c : str) {
+        if (c == '*' || c == '?' || c == '[' || c == ']' || c == '\\') result.push_back('\\');
+        result.push_back(c);
+    }
+    return result;
+}
+
+std::optional<std::string_view> ParseKeyspaceChannel(std::string_view channel) {
+    if (channel.substr(0, kKeyspaceChannelPrefix.size()) != kKeyspaceChannelPrefix) return std::nullopt;
+    const auto pos = channel.find(kKeyspaceChannelKeyDelimiter, kKeyspaceChannelPrefix.size());
+    if (pos == std::string_view::npos) return std::nullopt;
+    return channel.substr(pos + kKeyspaceChannelKeyDelimiter.size());
+}
+
+struct Entry final {
+    std::optional<std::string> value;
+    bool has_value{false};
+    std::unordered_map<std::string, std::optional<std::string>> fields;
+    Clock::time_point expires_at;
+};
+
+struct Way final {
+    explicit Way(std::size_t max_size) : entries(max_size) {}
+
+    mutable engine::Mutex mutex;
+    cache::LruMap<std::string, Entry> entries;
+    std::unordered_map<std::string, Clock::time_point> pending_writes;
+
+    // Incremented on every invalidation, values read from Redis before an
+    // invalidation are not stored
+    std::uint64_t generation{0};
+};
+
+using Percentile = utils::statistics::Percentile<2048>;
+using RecentPeriod = utils::statistics::RecentPeriod<Percentile, Percentile, utils::datetime::SteadyClock>;
+
+struct Statistics final {
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint64_t> misses{0};
+    std::atomic<std::uint64_t> invalidations{0};
+    std::atomic<std::uint64_t> discarded_fills{0};
+    RecentPeriod invalidation_lag_ms;
+};
+
+}  // namespace
+
+struct ClientSideCache::Impl final {
+    Impl(ClientPtr client, ClientSideCacheSettings settings);
+
+    Way& GetWay(const std::string& key) { return *ways[std::hash<std::string>{}(key) % ways.size()]; }
+
+    bool IsCacheable(std::string_view key) const {
+        return key.substr(0, settings.key_prefix.size()) == settings.key_prefix;
+    }
+
+    template <typename Func>
+    std::optional<std::optional<std::string>> Find(const std::string& key, Func&& get_cached);
+
+    template <typename Func>
+    void Store(const std::string& key, std::uint64_t generation, Func&& store);
+
+    std::uint64_t GetGeneration(const std::string& key) {
+        auto& way = GetWay(key);
+        const std::lock_guard lock{way.mutex};
+        return way.generation;
+    }
+
+    void Invalidate(const std::string& key, bool is_notification);
+    void AccountWrite(const std::string& key);
+
+    const ClientPtr client;
+    const ClientSideCacheSettings settings;
+    std::vector<std::unique_ptr<Way>> ways;
+    Statistics stats;
+
+    // Must be the last member, unsubscribes before the rest is destroyed
+    SubscriptionToken subscription;
+};
+
+ClientSideCache::Impl::Impl(ClientPtr client, ClientSideCacheSettings settings)
+    : client(std::move(client)), settings(std::move(settings)) {
+    UINVARIANT(this->client, "Redis client is required for the client-side cache");
+    const auto ways_count = std::max<std::size_t>(this->settings.ways, 1);
+    const auto way_size = std::max<std::size_t>(this->settings.max_size / ways_count, 1);
+    ways.reserve(ways_count);
+    for (std::size_t i = 0; i < ways_count; ++i) ways.push_back(std::make_unique<Way>(way_size));
+}
+
+template <typename Func>
+std::optional<std::optional<std::string>> ClientSideCache::Impl::Find(const std::string& key, Func&& get_cached) {
+    if (!IsCacheable(key)) return std::nullopt;
+
+    auto& way = GetWay(key);
+    std::optional<std::optional<std::string>> result;
+    {
+        const std::lock_guard lock{way.mutex};
+        auto* entry = way.entries.Get(key);
+        if (entry) {
+            if (entry->expires_at <= utils::datetime::SteadyNow()) {
+                way.entries.Erase(key);
+            } else {
+                result = get_cached(*entry);
+            }
+        }
+    }
+
+    if (result) {
+        ++stats.hits;
+    } else {
+        ++stats.misses;
+    }
+    return result;
+}
+
+template <typename Func>
+void ClientSideCache::Impl::Store(const std::string& key, std::uint64_t generation, Func&& store) {
+    auto& way = GetWay(key);
+    const std::lock_guard lock{way.mutex};
+    if (way.generation != generation) {
+        // The key could be modified while the value was in flight
+        ++stats.discarded_fills;
+        return;
+    }
+
+    auto* entry = way.entries.Get(key);
+    if (!entry) {
+        entry = way.entries.Emplace(key);
+        entry->expires_at = utils::datetime::SteadyNow() + settings.max_staleness;
+    }
+    store(*entry);
+}
+
+void ClientSideCache::Impl::Invalidate(const std::string& key, bool is_notification) {
+    auto& way = GetWay(key);
+    const std::lock_guard lock{way.mutex};
+    ++way.generation;
+    way.entries.Erase(key);
+    ++stats.invalidations;
+
+    if (!is_notification) return;
+    const auto it = way.pending_writes.find(key);
+    if (it == way.pending_writes.end()) return;
+
+    const auto lag = std::chrono::duration_cast<std::chrono::milliseconds>(utils::datetime::SteadyNow() - it->second);
+    stats.invalidation_lag_ms.GetCurrentCounter().Account(lag.count());
+    way.pending_writes.erase(it);
+}
+
+void ClientSideCache::Impl::AccountWrite(const std::string& key) {
+    if (!IsCacheable(key)) return;
+
+    auto& way = GetWay(key);
+    const std::lock_guard lock{way.mutex};
+    if (way.pending_writes.size() >= kMaxPendingWritesPerWay) way.pending_writes.clear();
+    way.pending_writes.try_emplace(key, utils::datetime::SteadyNow());
+}
+
+ClientSideCache::ClientSideCache(
+    ClientPtr client,
+    SubscribeClientPtr subscribe_client,
+    ClientSideCacheSettings settings
+)
+    : impl_(std::make_unique<Impl>(std::move(client), std::move(settings))) {
+    UINVARIANT(subscribe_client, "Redis subscribe client is required for the client-side cache");
+    if (subscribe_client->IsInClusterMode()) {
+        LOG_WARNING() << "Client-side cache receives keyspace notifications from a single node of the "
+                         "cluster, values of other nodes may stay stale for max_staleness="
+                      << impl_->settings.max_staleness.count() << "ms";
+    }
+
+    impl_->subscription = subscribe_client->Psubscribe(
+        std::string{kKeyspaceChannelPrefix} + "*" + std::string{kKeyspaceChannelKeyDelimiter} +
+            EscapeGlob(impl_->settings.key_prefix) + '*',
+        [this](const std::string&, const std::string& channel, const std::string& event) {
+            OnKeyspaceNotification(channel, event);
+        },
+        {}
+    );
+}
+
+ClientSideCache::~ClientSideCache() { impl_->subscription.Unsubscribe(); }
+
+std::optional<std::string> ClientSideCache::Get(std::string key, const CommandControl& command_control) {
+    auto cached = impl_->Find(key, [](const Entry& entry) -> std::optional<std::optional<std::string>> {
+        if (!entry.has_value) return std::nullopt;
+        return entry.value;
+    });
+    if (cached) return std::move(*cached);
+
+    if (!impl_->IsCacheable(key)) return impl_->client->Get(std::move(key), command_control).Get();
+
+    const auto generation = impl_->GetGeneration(key);
+    auto value = impl_->client->Get(key, command_control).Get();
+    impl_->Store(key, generation, [&value](Entry& entry) {
+        entry.value = value;
+        entry.has_value = true;
+    });
+    return value;
+}
+
+std::optional<std::string>
+ClientSideCache::Hget(std::string key, std::string field, const CommandControl& command_control) {
+    auto cached = impl_->Find(key, [&field](const Entry& entry) -> std::optional<std::optional<std::string>> {
+        const auto it = entry.fields.find(field);
+        if (it == entry.fields.end()) return std::nullopt;
+        return it->second;
+    });
+    if (cached) return std::move(*cached);
+
+    if (!impl_->IsCacheable(key)) {
+        return impl_->client->Hget(std::move(key), std::move(field), command_control).Get();
+    }
+
+    const auto generation = impl_->GetGeneration(key);
+    auto value = impl_->client->Hget(key, field, command_control).Get();
+    impl_->Store(key, generation, [&field, &value](Entry& entry) { entry.fields.insert_or_assign(field, value); });
+    return value;
+}
+
+std::vector<std::optional<std::string>>
+ClientSideCache::Mget(std::vector<std::string> keys, const CommandControl& command_control) {
+    std::vector<std::optional<std::string>> result(keys.size());
+    std::vector<std::size_t> missing_indices;
+    std::vector<std::string> missing_keys;
+    std::vector<std::uint64_t> generations;
+
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        auto cached = impl_->Find(keys[i], [](const Entry& entry) -> std::optional<std::optional<std::string>> {
+            if (!entry.has_value) return std::nullopt;
+            return entry.value;
+        });
+        if (cached) {
+            result[i] = std::move(*cached);
+            continue;
+        }
+
+        missing_indices.push_back(i);
+        missing_keys.push_back(keys[i]);
+        generations.push_back(impl_->IsCacheable(keys[i]) ? impl_->GetGeneration(keys[i]) : 0);
+    }
+    if (missing_keys.empty()) return result;
+
+    auto values = impl_->client->Mget(std::move(missing_keys), command_control).Get();
+    UINVARIANT(values.size() == missing_indices.size(), "Unexpected MGET reply size");
+
+    for (std::size_t i = 0; i < missing_indices.size(); ++i) {
+        const auto& key = keys[missing_indices[i]];
+        if (impl_->IsCacheable(key)) {
+            impl_->Store(key, generations[i], [&value = values[i]](Entry& entry) {
+                entry.value = value;
+                entry.has_value = true;
+            });
+        }
+        result[missing_indices[i]] = std::move(values[i]);
+    }
+    return result;
+}
+
+void ClientSideCache::Set(std::string key, std::string value, const CommandControl& command_control) {
+    impl_->AccountWrite(key);
+    const utils::ScopeGuard invalidate{[this, &key] { Invalidate(key); }};
+    impl_->client->Set(key, std::move(value), command_control).Get();
+}
+
+std::size_t ClientSideCache::Del(std::string key, const CommandControl& command_control) {
+    impl_->AccountWrite(key);
+    const utils::ScopeGuard invalidate{[this, &key] { Invalidate(key); }};
+    return impl_->client->Del(key, command_control).Get();
+}
+
+HsetReply
+ClientSideCache::Hset(std::string key, std::string field, std::string value, const CommandControl& command_control) {
+    impl_->AccountWrite(key);
+    const utils::ScopeGuard invalidate{[this, &key] { Invalidate(key); }};
+    return impl_->client->Hset(key, std::move(field), std::move(value), command_control).Get();
+}
+
+void ClientSideCache::Invalidate(const std::string& key) {
+    if (!impl_->IsCacheable(key)) return;
+    impl_->Invalidate(key, false);
+}
+
+void ClientSideCache::InvalidateAll() {
+    for (auto& way : impl_->ways) {
+        const std::lock_guard lock{way->mutex};
+        ++way->generation;
+        way->entries.Clear();
+    }
+}
+
+std::size_t ClientSideCache::GetSize() const {
+    std::size_t size = 0;
+    for (const auto& way : impl_->ways) {
+        const std::lock_guard lock{way->mutex};
+        size += way->entries.GetSize();
+    }
+    return size;
+}
+
+void ClientSideCache::OnKeyspaceNotification(const std::string& channel, const std::string& event) {
+    const auto key = ParseKeyspaceChannel(channel);
+    if (!key) {
+        LOG_LIMITED_WARNING() << "Unexpected keyspace notification channel '" << channel << "' for event '" << event
+                              << '\'';
+        return;
+    }
+
+    LOG_TRACE() << "Invalidating cached key '" << *key << "' on '" << event << "' event";
+    impl_->Invalidate(std::string{*key}, true);
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const ClientSideCache& cache) {
+    const auto& stats = cache.impl_->stats;
+    const auto hits = stats.hits.load();
+    const auto misses = stats.misses.load();
+
+    writer["hits"] = hits;
+    writer["misses"] = misses;
+    writer["hit_ratio"] = static_cast<double>(hits) / static_cast<double>(hits + misses ? hits + misses : 1);
+    writer["invalidations"] = stats.invalidations.load();
+    writer["discarded_fills"] = stats.discarded_fills.load();
+    writer["size"] = cache.GetSize();
+    writer["invalidation_lag_ms"] = stats.invalidation_lag_ms;
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,153 @@
+#include <userver/storages/redis/client_side_cache.hpp>
+
+#include <userver/storages/redis/mock_client_google.hpp>
+#include <userver/storages/redis/mock_subscribe_client.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace redis = storages::redis;
+
+using testing::_;
+
+constexpr std::string_view kPrefix = "hot:";
+
+struct CacheFixture {
+    CacheFixture() {
+        EXPECT_CALL(*subscribe_client, Psubscribe("__keyspace@*__:hot:*", _, _))
+            .WillOnce([this](std::string, redis::SubscriptionToken::OnPmessageCb cb, const redis::CommandControl&) {
+                on_pmessage = std::move(cb);
+                return redis::SubscriptionToken{};
+            });
+        cache.emplace(client, subscribe_client, redis::ClientSideCacheSettings{std::string{kPrefix}});
+    }
+
+    void Notify(const std::string& key, const std::string& event) {
+        ASSERT_TRUE(on_pmessage);
+        on_pmessage("__keyspace@*__:hot:*", "__keyspace@0__:" + key, event);
+    }
+
+    std::shared_ptr<redis::GMockClient> client = std::make_shared<redis::GMockClient>();
+    std::shared_ptr<redis::MockSubscribeClient> subscribe_client = std::make_shared<redis::MockSubscribeClient>();
+    redis::SubscriptionToken::OnPmessageCb on_pmessage;
+    std::optional<redis::ClientSideCache> cache;
+};
+
+redis::RequestGet MakeGetReply(std::optional<std::string> value) {
+    return redis::CreateMockRequest<redis::RequestGet>(std::move(value));
+}
+
+}  // namespace
+
+UTEST(RedisClientSideCache, Get) {
+    CacheFixture fixture;
+    EXPECT_CALL(*fixture.client, Get("hot:key", _)).Times(1).WillOnce([](auto, auto) { return MakeGetReply("value"); });
+
+    EXPECT_EQ(fixture.cache->Get("hot:key", {}), "value");
+    EXPECT_EQ(fixture.cache->Get("hot:key", {}), "value");
+    EXPECT_EQ(fixture.cache->GetSize(), 1);
+}
+
+UTEST(RedisClientSideCache, GetNil) {
+    CacheFixture fixture;
+    EXPECT_CALL(*fixture.client, Get("hot:key", _)).Times(1).WillOnce([](auto, auto) {
+        return MakeGetReply(std::nullopt);
+    });
+
+    EXPECT_EQ(fixture.cache->Get("hot:key", {}), std::nullopt);
+    EXPECT_EQ(fixture.cache->Get("hot:key", {}), std::nullopt);
+}
+
+UTEST(RedisClientSideCache, NotCacheable) {
+    CacheFixture fixture;
+    EXPECT_CALL(*fixture.client, Get("cold:key", _)).Times(2).WillRepeatedly([](auto, auto) {
+        return MakeGetReply("value");
+    });
+
+    EXPECT_EQ(fixture.cache->Get("cold:key", {}), "value");
+    EXPECT_EQ(fixture.cache->Get("cold:key", {}), "value");
+    EXPECT_EQ(fixture.cache->GetSize(), 0);
+}
+
+UTEST(RedisClientSideCache, KeyspaceNotification) {
+    CacheFixture fixture;
+    EXPECT_CALL(*fixture.client, Get("hot:key", _))
+        .WillOnce([](auto, auto) { return MakeGetReply("old"); })
+        .WillOnce([](auto, auto) { return MakeGetReply("new"); });
+
+    EXPECT_EQ(fixture.cache->Get("hot:key", {}), "old");
+    fixture.Notify("hot:other", "set");
+    EXPECT_EQ(fixture.cache->Get("hot:key", {}), "old");
+
+    fixture.Notify("hot:key", "set");
+    EXPECT_EQ(fixture.cache->GetSize(), 0);
+    EXPECT_EQ(fixture.cache->Get("hot:key", {}), "new");
+}
+
+UTEST(RedisClientSideCache, Hget) {
+    CacheFixture fixture;
+    EXPECT_CALL(*fixture.client, Hget("hot:hash", "a", _)).Times(2).WillRepeatedly([](auto, auto, auto) {
+        return redis::CreateMockRequest<redis::RequestHget>(std::optional<std::string>{"1"});
+    });
+    EXPECT_CALL(*fixture.client, Hget("hot:hash", "b", _)).Times(1).WillOnce([](auto, auto, auto) {
+        return redis::CreateMockRequest<redis::RequestHget>(std::optional<std::string>{"2"});
+    });
+
+    EXPECT_EQ(fixture.cache->Hget("hot:hash", "a", {}), "1");
+    EXPECT_EQ(fixture.cache->Hget("hot:hash", "b", {}), "2");
+    EXPECT_EQ(fixture.cache->Hget("hot:hash", "a", {}), "1");
+    EXPECT_EQ(fixture.cache->Hget("hot:hash", "b", {}), "2");
+
+    // Any modification of the hash drops all the fields
+    fixture.Notify("hot:hash", "hset");
+    EXPECT_EQ(fixture.cache->Hget("hot:hash", "a", {}), "1");
+}
+
+UTEST(RedisClientSideCache, Mget) {
+    CacheFixture fixture;
+    EXPECT_CALL(*fixture.client, Get("hot:a", _)).WillOnce([](auto, auto) { return MakeGetReply("a"); });
+    EXPECT_CALL(*fixture.client, Mget(std::vector<std::string>{"hot:b", "cold:c"}, _)).WillOnce([](auto, auto) {
+        return redis::CreateMockRequest<redis::RequestMget>(
+            std::vector<std::optional<std::string>>{std::string{"b"}, std::nullopt}
+        );
+    });
+
+    EXPECT_EQ(fixture.cache->Get("hot:a", {}), "a");
+    const auto values = fixture.cache->Mget({"hot:a", "hot:b", "cold:c"}, {});
+    EXPECT_EQ(values, (std::vector<std::optional<std::string>>{"a", "b", std::nullopt}));
+    EXPECT_EQ(fixture.cache->Get("hot:b", {}), "b");
+}
+
+UTEST(RedisClientSideCache, WriteInvalidates) {
+    CacheFixture fixture;
+    EXPECT_CALL(*fixture.client, Get("hot:key", _))
+        .WillOnce([](auto, auto) { return MakeGetReply("old"); })
+        .WillOnce([](auto, auto) { return MakeGetReply("new"); });
+    EXPECT_CALL(*fixture.client, Set("hot:key", "new", _)).WillOnce([](auto, auto, auto) {
+        return redis::CreateMockRequest<redis::RequestSet>();
+    });
+
+    EXPECT_EQ(fixture.cache->Get("hot:key", {}), "old");
+    fixture.cache->Set("hot:key", "new", {});
+    EXPECT_EQ(fixture.cache->Get("hot:key", {}), "new");
+
+    // Delayed notification of the own write
+    fixture.Notify("hot:key", "set");
+    EXPECT_EQ(fixture.cache->GetSize(), 0);
+}
+
+UTEST(RedisClientSideCache, InvalidateAll) {
+    CacheFixture fixture;
+    EXPECT_CALL(*fixture.client, Get("hot:key", _)).Times(2).WillRepeatedly([](auto, auto) {
+        return MakeGetReply("value");
+    });
+
+    EXPECT_EQ(fixture.cache->Get("hot:key", {}), "value");
+    fixture.cache->InvalidateAll();
+    EXPECT_EQ(fixture.cache->GetSize(), 0);
+    EXPECT_EQ(fixture.cache->Get("hot:key", {}), "value");
+}
+
+USERVER_NAMESPACE_END
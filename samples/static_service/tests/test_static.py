@@ -26,3 +26,39 @@ async def test_hidden_file(service_client, service_source_dir):
     response = await service_client.get('/dir1/.hidden_file.txt')
     assert response.status == 404
     assert response.content.decode() == 'File not found'
+
+
+async def test_file_range(service_client, service_source_dir):
+    file = service_source_dir.joinpath('public') / 'index.html'
+    content = file.open('rb').read()
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=1-4'},
+    )
+    assert response.status == 206
+    assert response.headers['Accept-Ranges'] == 'bytes'
+    assert response.headers['Content-Range'] == f'bytes 1-4/{len(content)}'
+    assert response.content == content[1:5]
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=-3'},
+    )
+    assert response.status == 206
+    assert response.content == content[-3:]
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': 'bytes=5-'},
+    )
+    assert response.status == 206
+    assert response.content == content[5:]
+
+
+async def test_file_range_not_satisfiable(service_client, service_source_dir):
+    file = service_source_dir.joinpath('public') / 'index.html'
+    size = len(file.open('rb').read())
+
+    response = await service_client.get(
+        '/index.html', headers={'Range': f'bytes={size}-'},
+    )
+    assert response.status == 416
+    assert response.headers['Content-Range'] == f'bytes */{size}'
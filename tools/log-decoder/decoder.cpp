@@ -0,0 +1,94 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <userver/logging/format.hpp>
+#include <userver/logging/impl/binary_decoder.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace {
+
+struct Config {
+    std::string format = "tskv";
+    std::string input;
+    std::size_t buffer_size = 64 * 1024;
+};
+
+Config ParseConfig(int argc, char** argv) {
+    namespace po = boost::program_options;
+
+    Config config;
+    po::options_description desc("Renders the logs written in the binary format.\nAllowed options");
+    desc.add_options()("help,h", "produce help message")(
+        "format,f",
+        po::value(&config.format)->default_value(config.format),
+        "output format (tskv, ltsv, json, json_yadeploy)"
+    )("input,i", po::value(&config.input), "binary log file (stdin by default)"
+    )("buffer,b", po::value(&config.buffer_size)->default_value(config.buffer_size), "read buffer size");
+
+    po::positional_options_description positional;
+    positional.add("input", 1);
+
+    po::variables_map vm;
+    try {
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(positional).run(), vm);
+        po::notify(vm);
+    } catch (const std::exception& ex) {
+        std::cerr << "Cannot parse command line: " << ex.what() << '\n';
+        exit(1);
+    }
+
+    if (vm.count("help")) {
+        std::cout << desc << '\n';
+        exit(0);
+    }
+
+    return config;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const auto config = ParseConfig(argc, argv);
+
+    std::ifstream file;
+    if (!config.input.empty()) {
+        file.open(config.input, std::ios::binary);
+        if (!file) {
+            std::cerr << "Cannot open " << config.input << '\n';
+            return 1;
+        }
+    }
+    std::istream& input = config.input.empty() ? std::cin : file;
+
+    try {
+        logging::impl::BinaryLogDecoder decoder{logging::FormatFromString(config.format)};
+
+        std::vector<char> buffer(config.buffer_size);
+        std::string pending;
+        std::string out;
+        while (input) {
+            input.read(buffer.data(), buffer.size());
+            pending.append(buffer.data(), input.gcount());
+
+            out.clear();
+            pending.erase(0, decoder.Decode(pending, out));
+            std::cout << out;
+        }
+
+        if (!pending.empty()) {
+            std::cerr << "The log ends with an incomplete record of " << pending.size() << " bytes\n";
+            return 1;
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << '\n';
+        return 1;
+    }
+
+    return 0;
+}
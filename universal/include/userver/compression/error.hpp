@@ -8,6 +8,11 @@ USERVER_NAMESPACE_BEGIN
 
 namespace compression {
 
+/// Failed to compress the data
+class CompressionError : public std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
 /// Base class for decompression errors
 class DecompressionError : public std::runtime_error {
     using std::runtime_error::runtime_error;
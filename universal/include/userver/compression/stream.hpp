@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression {
+
+/// What a streaming compressor should do with the data it has buffered
+enum class FlushMode {
+    /// Keep the data buffered to achieve a better compression ratio
+    kNone,
+    /// Output all the data consumed so far, so that the receiver is able to
+    /// decode it without waiting for the end of the stream
+    kFlush,
+    /// Finish the stream (zstd frame), the compressor should be Reset()
+    /// before being reused
+    kFinish,
+};
+
+/// Result of a single step of a streaming compressor or decompressor
+struct StreamResult final {
+    /// Number of bytes consumed from the input
+    std::size_t consumed{0};
+
+    /// Number of bytes written into the output buffer
+    std::size_t produced{0};
+
+    /// For compressors: all the input is consumed and flushed according to
+    /// the FlushMode. For decompressors: the end of the compressed stream
+    /// (zstd frame) is reached.
+    ///
+    /// Otherwise the step should be repeated with the rest of the input and
+    /// with more output space.
+    bool done{false};
+};
+
+}  // namespace compression
+
+USERVER_NAMESPACE_END
@@ -1,17 +1,164 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <string_view>
 
 #include <userver/compression/error.hpp>
+#include <userver/compression/stream.hpp>
+#include <userver/utils/span.hpp>
+
+// NOLINTBEGIN(bugprone-reserved-identifier)
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+// NOLINTEND(bugprone-reserved-identifier)
 
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
 
+/// Default compression level of zstd
+inline constexpr int kDefaultLevel = 3;
+
+class Dictionary;
+
 /// Decompresses the string.
 /// @throws DecompressionError
 std::string Decompress(std::string_view compressed, size_t max_size);
 
+/// Decompresses the string that was compressed with the `dictionary`.
+/// @throws DecompressionError
+std::string Decompress(std::string_view compressed, size_t max_size, const Dictionary& dictionary);
+
+/// Compresses the string into a single zstd frame.
+///
+/// Compression context is cached per thread, so calling this function does
+/// not allocate anything except the resulting string.
+/// @throws CompressionError
+std::string Compress(std::string_view data, int level = kDefaultLevel);
+
+/// Compresses the string into a single zstd frame using the `dictionary`
+/// and its compression level.
+/// @throws CompressionError
+std::string Compress(std::string_view data, const Dictionary& dictionary);
+
+/// @cond
+namespace impl {
+
+struct Deleter final {
+    void operator()(ZSTD_CCtx_s* context) const noexcept;
+    void operator()(ZSTD_DCtx_s* context) const noexcept;
+    void operator()(ZSTD_CDict_s* dictionary) const noexcept;
+    void operator()(ZSTD_DDict_s* dictionary) const noexcept;
+};
+
+}  // namespace impl
+/// @endcond
+
+/// @brief Digested zstd dictionary, e.g. trained with `zstd --train`.
+///
+/// Digesting a dictionary is expensive, so it should be done once and then
+/// shared between any number of compressors and decompressors. Small payloads
+/// of the same kind (e.g. JSON messages of some API) compressed with a
+/// dictionary are several times smaller than the ones compressed without it.
+class Dictionary final {
+public:
+    /// @param content raw dictionary content
+    /// @param level compression level to use with the dictionary
+    /// @throws CompressionError
+    explicit Dictionary(std::string_view content, int level = kDefaultLevel);
+
+    Dictionary(const Dictionary&) = delete;
+    Dictionary& operator=(const Dictionary&) = delete;
+    ~Dictionary();
+
+    /// @returns dictionary ID, that is written to the frame headers
+    unsigned GetId() const;
+
+private:
+    friend class Compressor;
+    friend class Decompressor;
+    friend std::string Compress(std::string_view data, const Dictionary& dictionary);
+    friend std::string Decompress(std::string_view compressed, size_t max_size, const Dictionary& dictionary);
+
+    std::unique_ptr<ZSTD_CDict_s, impl::Deleter> compression_dictionary_;
+    std::unique_ptr<ZSTD_DDict_s, impl::Deleter> decompression_dictionary_;
+};
+
+/// @brief Incrementally compresses the data into zstd frames.
+///
+/// The compressor may be reused for any number of frames, which saves
+/// allocation of the compression context.
+class Compressor final {
+public:
+    /// @throws CompressionError
+    explicit Compressor(int level = kDefaultLevel);
+
+    /// Compressor that uses the `dictionary` and its compression level.
+    /// @throws CompressionError
+    explicit Compressor(std::shared_ptr<const Dictionary> dictionary);
+
+    Compressor(Compressor&&) noexcept;
+    Compressor& operator=(Compressor&&) noexcept;
+    ~Compressor();
+
+    /// @brief Compresses the beginning of `input` into `output`.
+    ///
+    /// Should be called with the rest of the input and with the same `mode`
+    /// until StreamResult::done is returned. After the frame is finished with
+    /// FlushMode::kFinish, the next call starts a new frame.
+    /// @throws CompressionError
+    StreamResult Compress(std::string_view input, utils::span<char> output, FlushMode mode);
+
+    /// @returns compressed and flushed representation of `chunk`
+    /// @throws CompressionError
+    std::string Compress(std::string_view chunk);
+
+    /// @returns the end of the frame
+    /// @throws CompressionError
+    std::string Finish();
+
+    /// Discards the unfinished frame, if any
+    void Reset() noexcept;
+
+private:
+    std::unique_ptr<ZSTD_CCtx_s, impl::Deleter> context_;
+    std::shared_ptr<const Dictionary> dictionary_;
+};
+
+/// @brief Incrementally decompresses zstd frames.
+///
+/// The decompressor may be reused for any number of frames, which saves
+/// allocation of the decompression context.
+class Decompressor final {
+public:
+    /// @throws DecompressionError
+    Decompressor();
+
+    /// Decompressor of the frames compressed with the `dictionary`.
+    /// @throws DecompressionError
+    explicit Decompressor(std::shared_ptr<const Dictionary> dictionary);
+
+    Decompressor(Decompressor&&) noexcept;
+    Decompressor& operator=(Decompressor&&) noexcept;
+    ~Decompressor();
+
+    /// @brief Decompresses the beginning of `input` into `output`.
+    ///
+    /// Reports StreamResult::done at the end of each frame.
+    /// @throws DecompressionError
+    StreamResult Decompress(std::string_view input, utils::span<char> output);
+
+    /// Discards the unfinished frame, if any
+    void Reset() noexcept;
+
+private:
+    std::unique_ptr<ZSTD_DCtx_s, impl::Deleter> context_;
+    std::shared_ptr<const Dictionary> dictionary_;
+};
+
 }  // namespace compression::zstd
 
 USERVER_NAMESPACE_END
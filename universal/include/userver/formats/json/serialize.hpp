@@ -20,13 +20,35 @@ class LogHelper;
 
 }  // namespace logging
 
+namespace utils::impl {
+
+class BufferChain;
+
+}  // namespace utils::impl
+
 namespace formats::json {
 
 constexpr inline std::size_t kDepthParseLimit = 128;
 
+/// JSON parser implementation, see formats::json::FromString
+enum class ParserBackend {
+    /// rapidjson, the default one
+    kRapidJson,
+    /// SIMD-accelerated simdjson, noticeably faster on big documents. It is
+    /// available if userver is built with `USERVER_FEATURE_SIMDJSON`,
+    /// rapidjson is used otherwise.
+    kSimdJson,
+};
+
 /// Parse JSON from string
 formats::json::Value FromString(std::string_view doc);
 
+/// @brief Parse JSON from string with the specified parser implementation.
+///
+/// The resulting values and the exceptions are the same for all the
+/// implementations.
+formats::json::Value FromString(std::string_view doc, ParserBackend backend);
+
 /// Parse JSON from stream
 formats::json::Value FromStream(std::istream& is);
 
@@ -78,6 +100,10 @@ private:
     utils::FastPimpl<Impl, kSize, kAlignment> pimpl_;
 };
 
+// Appends the serialized value to the chain, for large bodies that should not
+// be reallocated on growth
+void ToBufferChain(const formats::json::Value& value, utils::impl::BufferChain& chain);
+
 }  // namespace impl
 
 }  // namespace formats::json
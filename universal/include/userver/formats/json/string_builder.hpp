@@ -67,6 +67,10 @@ public:
     std::string GetString() const;
     std::string_view GetStringView() const;
 
+    /// @return JSON string, moved out of the builder without copying. Leaves
+    /// the builder in an empty state, it should not be written to afterwards.
+    std::string ExtractString();
+
     void WriteNull();
     void WriteString(std::string_view value);
     void WriteBool(bool value);
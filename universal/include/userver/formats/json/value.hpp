@@ -24,13 +24,20 @@ namespace logging {
 class LogHelper;
 }  // namespace logging
 
+namespace utils::impl {
+class BufferChain;
+}  // namespace utils::impl
+
 namespace formats::json {
+class Value;
 namespace impl {
 class InlineObjectBuilder;
 class InlineArrayBuilder;
 class MutableValueWrapper;
 class StringBuffer;
 
+void ToBufferChain(const formats::json::Value& value, utils::impl::BufferChain& chain);
+
 // do not make a copy of string
 impl::Value MakeJsonStringViewValue(std::string_view view);
 
@@ -39,6 +46,7 @@ impl::Value MakeJsonStringViewValue(std::string_view view);
 class ValueBuilder;
 struct PrettyFormat;
 class Schema;
+enum class ParserBackend;
 
 namespace parser {
 class JsonValueParser;
@@ -325,6 +333,7 @@ private:
     friend class impl::MutableValueWrapper;
     friend class parser::JsonValueParser;
     friend class impl::StringBuffer;
+    friend void impl::ToBufferChain(const Value&, utils::impl::BufferChain&);
 
     friend bool Parse(const Value& value, parse::To<bool>);
     friend std::int64_t Parse(const Value& value, parse::To<std::int64_t>);
@@ -333,6 +342,7 @@ private:
     friend std::string Parse(const Value& value, parse::To<std::string>);
 
     friend formats::json::Value FromString(std::string_view);
+    friend formats::json::Value FromString(std::string_view, ParserBackend);
     friend formats::json::Value FromStream(std::istream&);
     friend void Serialize(const formats::json::Value&, std::ostream&);
     friend std::string ToString(const formats::json::Value&);
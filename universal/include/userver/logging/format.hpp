@@ -17,6 +17,9 @@ enum class Format {
     kStruct,
     kJson,
     kJsonYaDeploy,
+    /// Compact binary format that is cheap to write, see
+    /// logging::impl::BinaryLogDecoder to render it into a text one
+    kBinary,
 };
 
 /// Parse Format enum from string
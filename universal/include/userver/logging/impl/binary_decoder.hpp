@@ -0,0 +1,42 @@
+#pragma once
+
+/// @file userver/logging/impl/binary_decoder.hpp
+/// @brief @copybrief logging::impl::BinaryLogDecoder
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/logging/format.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+/// @brief Renders the logs written in logging::Format::kBinary into one of the
+/// text formats: kTskv, kLtsv, kJson or kJsonYaDeploy.
+///
+/// The data may be fed in arbitrary pieces, the decoder remembers the
+/// interned strings between the Decode() calls.
+class BinaryLogDecoder final {
+public:
+    explicit BinaryLogDecoder(Format format);
+
+    /// @brief Decodes the complete frames of the `data` and appends the
+    /// resulting log lines to `out`.
+    /// @returns the number of the consumed bytes, the rest of the `data` is
+    /// an incomplete frame that should be passed again with more data.
+    /// @throws std::runtime_error on malformed data
+    std::size_t Decode(std::string_view data, std::string& out);
+
+private:
+    void DecodeRecord(std::string_view payload, std::string& out) const;
+
+    const Format format_;
+    std::vector<std::string> strings_;
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,133 @@
+#pragma once
+
+/// @file userver/utils/arena.hpp
+/// @brief @copybrief utils::Arena
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Monotonic memory arena: allocations are bumps of a pointer in a
+/// chain of growing blocks, all the memory is freed at once by Reset() or on
+/// destruction.
+///
+/// Reset() keeps the biggest block, so an arena that is reused for similar
+/// workloads (e.g. for each request) stops calling the system allocator after
+/// a warm-up.
+///
+/// The arena is not thread-safe. Destructors of the objects placed into the
+/// arena are not called by the arena.
+///
+/// @snippet utils/arena_test.cpp  Sample Arena
+class Arena final {
+public:
+    static constexpr std::size_t kDefaultBlockSize = 4096;
+    static constexpr std::size_t kMaxBlockSize = 1024 * 1024;
+
+    /// Creates an arena that allocates nothing until the first Allocate()
+    Arena() noexcept : Arena(kDefaultBlockSize) {}
+
+    /// Creates an arena with the first block of `initial_block_size` bytes,
+    /// the block is allocated lazily
+    explicit Arena(std::size_t initial_block_size) noexcept;
+
+    Arena(Arena&& other) noexcept;
+    Arena& operator=(Arena&& other) noexcept;
+
+    ~Arena();
+
+    /// @returns a pointer to at least `size` bytes aligned to `alignment`,
+    /// valid until Reset() or destruction of the arena
+    /// @throws std::bad_alloc
+    void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+    /// Invalidates all the allocations, keeps the biggest block for reuse
+    void Reset() noexcept;
+
+    /// @returns the number of bytes handed out since the last Reset()
+    std::size_t GetUsedBytes() const noexcept { return used_bytes_; }
+
+    /// @returns the total size of the blocks owned by the arena
+    std::size_t GetReservedBytes() const noexcept { return reserved_bytes_; }
+
+private:
+    struct Block;
+
+    void* AllocateSlow(std::size_t size, std::size_t alignment);
+    void ReleaseBlocks(Block* first) noexcept;
+
+    Block* head_{nullptr};
+    std::uintptr_t current_{0};
+    std::uintptr_t end_{0};
+    std::size_t next_block_size_;
+    std::size_t used_bytes_{0};
+    std::size_t reserved_bytes_{0};
+};
+
+inline void* Arena::Allocate(std::size_t size, std::size_t alignment) {
+    UASSERT_MSG(alignment != 0 && (alignment & (alignment - 1)) == 0, "alignment must be a power of 2");
+
+    const auto aligned = (current_ + alignment - 1) & ~(alignment - 1);
+    if (current_ != 0 && aligned <= end_ && size <= end_ - aligned) {
+        used_bytes_ += aligned + size - current_;
+        current_ = aligned + size;
+        return reinterpret_cast<void*>(aligned);
+    }
+    return AllocateSlow(size, alignment);
+}
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Standard allocator that places the objects into utils::Arena.
+///
+/// Deallocation is a no-op, the memory is reclaimed by Arena::Reset() or on
+/// destruction of the arena. The arena must outlive the containers that use
+/// the allocator.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena& arena) noexcept : arena_(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(other.arena_) {}
+
+    T* allocate(std::size_t n) {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) throw std::bad_array_new_length();
+        return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* /*ptr*/, std::size_t /*n*/) noexcept {}
+
+    Arena& GetArena() const noexcept { return *arena_; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena_ == other.arena_;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+        return arena_ != other.arena_;
+    }
+
+private:
+    template <typename U>
+    friend class ArenaAllocator;
+
+    Arena* arena_;
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+/// @brief Chain of fixed-size buffers to accumulate large data without
+/// reallocations and copying on growth, e.g. a response body that is later
+/// sent with a single writev.
+///
+/// Buffers are taken from a thread local pool and are returned into it on
+/// destruction or Clear(). The pools keep a few megabytes for all the threads
+/// at most. All the chunks except the last one are full.
+class BufferChain final {
+public:
+    static constexpr std::size_t kChunkSize = 32 * 1024;
+
+    BufferChain() = default;
+    BufferChain(BufferChain&& other) noexcept;
+    BufferChain& operator=(BufferChain&& other) noexcept;
+    ~BufferChain();
+
+    void Append(char c) {
+        if (pos_ == end_) AddChunk();
+        *pos_++ = c;
+    }
+
+    void Append(std::string_view data);
+
+    std::size_t GetSize() const noexcept;
+    bool IsEmpty() const noexcept { return GetSize() == 0; }
+
+    std::size_t GetChunksCount() const noexcept { return chunks_.size(); }
+    std::string_view GetChunk(std::size_t index) const noexcept;
+
+    /// Concatenates all the chunks
+    std::string ToString() const;
+
+    /// Returns the buffers into the pool
+    void Clear() noexcept;
+
+private:
+    void AddChunk();
+
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    char* pos_{nullptr};
+    char* end_{nullptr};
+};
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
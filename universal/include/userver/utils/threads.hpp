@@ -4,6 +4,8 @@
 /// @brief Functions to work with OS threads.
 /// @ingroup userver_universal
 
+#include <cstddef>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
@@ -19,6 +21,10 @@ void SetCurrentThreadIdleScheduling();
 /// @throws std::system_error
 void SetCurrentThreadLowPriorityScheduling();
 
+/// @brief Pin the OS thread to the CPU
+/// @throws std::system_error, always throws on platforms other than Linux
+void SetCurrentThreadCpuAffinity(std::size_t cpu);
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
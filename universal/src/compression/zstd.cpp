@@ -5,6 +5,9 @@
 #include <zstd.h>
 #include <zstd_errors.h>
 
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace compression::zstd {
@@ -12,58 +15,113 @@ namespace compression::zstd {
 namespace {
 // The same size as in ZSTD_DStreamOutSize();
 const size_t kDecompressBufferSize = ZSTD_DStreamOutSize();
-}  // namespace
 
-std::string DecompressStream(std::string_view compressed, size_t max_size) {
-    std::string decompressed;
-    std::string buf(kDecompressBufferSize, '\0');
+// Contexts keep their workspaces between the calls, reusing them saves
+// a few allocations (and page faults) on every call.
+struct LocalContexts final {
+    std::unique_ptr<ZSTD_CCtx, impl::Deleter> compression;
+    std::unique_ptr<ZSTD_DCtx, impl::Deleter> decompression;
+};
+
+compiler::ThreadLocal local_contexts = [] { return LocalContexts{}; };
 
-    auto* stream = ZSTD_createDStream();
-    if (stream == nullptr) {
-        throw std::runtime_error("Couldn't create ZSTD decompression stream");
+std::size_t CheckCompressionError(std::size_t ret) {
+    if (ZSTD_isError(ret)) {
+        throw CompressionError(fmt::format("Compression failed: {}", ZSTD_getErrorName(ret)));
     }
-    auto stream_del = [](ZSTD_DStream* ptr) { ZSTD_freeDStream(ptr); };
-    auto stream_guard = std::unique_ptr<ZSTD_DStream, decltype(stream_del)>(stream, stream_del);
+    return ret;
+}
 
-    {
-        const auto err_code = ZSTD_DCtx_reset(stream, ZSTD_ResetDirective::ZSTD_reset_session_and_parameters);
-        if (ZSTD_isError(err_code)) {
-            throw ErrWithCode(ZSTD_getErrorName(err_code));
+std::size_t CheckDecompressionError(std::size_t ret) {
+    if (ZSTD_isError(ret)) {
+        throw ErrWithCode(ZSTD_getErrorName(ret));
+    }
+    return ret;
+}
+
+ZSTD_CCtx& GetCompressionContext(LocalContexts& contexts) {
+    if (!contexts.compression) {
+        contexts.compression.reset(ZSTD_createCCtx());
+        if (!contexts.compression) {
+            throw CompressionError("Couldn't create ZSTD compression context");
         }
     }
+    return *contexts.compression;
+}
 
-    for (size_t cur_pos(0); cur_pos < compressed.size();) {
-        ZSTD_inBuffer input{
-            compressed.data() + cur_pos, std::min(kDecompressBufferSize, compressed.size() - cur_pos), 0};
+ZSTD_DCtx& GetDecompressionContext(LocalContexts& contexts) {
+    if (!contexts.decompression) {
+        contexts.decompression.reset(ZSTD_createDCtx());
+        if (!contexts.decompression) {
+            throw DecompressionError("Couldn't create ZSTD decompression context");
+        }
+    }
+    return *contexts.decompression;
+}
 
-        while (input.pos < input.size) {
-            ZSTD_outBuffer output{buf.data(), buf.size(), 0};
+ZSTD_EndDirective ToEndDirective(FlushMode mode) {
+    switch (mode) {
+        case FlushMode::kNone:
+            return ZSTD_e_continue;
+        case FlushMode::kFlush:
+            return ZSTD_e_flush;
+        case FlushMode::kFinish:
+            return ZSTD_e_end;
+    }
 
-            if (const auto ret = ZSTD_decompressStream(stream, &output, &input); ZSTD_isError(ret)) {
-                throw ErrWithCode(ZSTD_getErrorName(ret));
-            }
+    UINVARIANT(false, "Unexpected flush mode");
+}
 
-            decompressed.append(static_cast<char*>(output.dst), output.pos);
-        }
+std::string CompressToString(Compressor& compressor, std::string_view input, FlushMode mode) {
+    std::string output;
+    while (true) {
+        const auto offset = output.size();
+        output.resize(offset + ZSTD_CStreamOutSize());
+
+        const auto result = compressor.Compress(input, utils::span<char>(output).subspan(offset), mode);
+        input.remove_prefix(result.consumed);
+        output.resize(offset + result.produced);
+
+        if (result.done) return output;
+    }
+}
+
+std::string
+DecompressStream(ZSTD_DCtx& context, std::string_view compressed, size_t max_size, const ZSTD_DDict* dictionary) {
+    if (dictionary) {
+        CheckDecompressionError(ZSTD_DCtx_refDDict(&context, dictionary));
+    }
+
+    std::string decompressed;
+    ZSTD_inBuffer input{compressed.data(), compressed.size(), 0};
+    while (input.pos < input.size) {
+        const auto offset = decompressed.size();
+        decompressed.resize(offset + kDecompressBufferSize);
+        ZSTD_outBuffer output{decompressed.data() + offset, kDecompressBufferSize, 0};
+
+        CheckDecompressionError(ZSTD_decompressStream(&context, &output, &input));
+        decompressed.resize(offset + output.pos);
 
         if (decompressed.size() > max_size) {
             throw TooBigError();
         }
-
-        cur_pos += input.size;
     }
 
     return decompressed;
 }
 
-std::string Decompress(std::string_view compressed, size_t max_size) {
+std::string DoDecompress(std::string_view compressed, size_t max_size, const ZSTD_DDict* dictionary) {
+    auto contexts = local_contexts.Use();
+    auto& context = GetDecompressionContext(*contexts);
+    CheckDecompressionError(ZSTD_DCtx_reset(&context, ZSTD_reset_session_and_parameters));
+
     const auto decompressed_size = ZSTD_getFrameContentSize(compressed.data(), compressed.size());
 
     switch (decompressed_size) {
         case ZSTD_CONTENTSIZE_UNKNOWN:
-            return DecompressStream(compressed, max_size);
+            return DecompressStream(context, compressed, max_size, dictionary);
         case ZSTD_CONTENTSIZE_ERROR:
-            throw std::runtime_error("Error while getting size");
+            throw DecompressionError("Error while getting size");
         default:
             if (decompressed_size > max_size) {
                 throw TooBigError();
@@ -71,14 +129,191 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
     }
 
     std::string decompressed(decompressed_size, '\0');
-    if (const auto ret =
-            ZSTD_decompress(decompressed.data(), decompressed.capacity(), compressed.data(), compressed.size());
-        ZSTD_isError(ret)) {
-        throw ErrWithCode(ZSTD_getErrorName(ret));
+    if (dictionary) {
+        CheckDecompressionError(ZSTD_decompress_usingDDict(
+            &context, decompressed.data(), decompressed.size(), compressed.data(), compressed.size(), dictionary
+        ));
+    } else {
+        CheckDecompressionError(ZSTD_decompressDCtx(
+            &context, decompressed.data(), decompressed.size(), compressed.data(), compressed.size()
+        ));
     }
 
     return decompressed;
 }
 
+}  // namespace
+
+namespace impl {
+
+void Deleter::operator()(ZSTD_CCtx* context) const noexcept { ZSTD_freeCCtx(context); }
+
+void Deleter::operator()(ZSTD_DCtx* context) const noexcept { ZSTD_freeDCtx(context); }
+
+void Deleter::operator()(ZSTD_CDict* dictionary) const noexcept { ZSTD_freeCDict(dictionary); }
+
+void Deleter::operator()(ZSTD_DDict* dictionary) const noexcept { ZSTD_freeDDict(dictionary); }
+
+}  // namespace impl
+
+std::string Decompress(std::string_view compressed, size_t max_size) {
+    return DoDecompress(compressed, max_size, nullptr);
+}
+
+std::string Decompress(std::string_view compressed, size_t max_size, const Dictionary& dictionary) {
+    return DoDecompress(compressed, max_size, dictionary.decompression_dictionary_.get());
+}
+
+std::string Compress(std::string_view data, int level) {
+    auto contexts = local_contexts.Use();
+    auto& context = GetCompressionContext(*contexts);
+
+    std::string compressed(ZSTD_compressBound(data.size()), '\0');
+    const auto ret = CheckCompressionError(
+        ZSTD_compressCCtx(&context, compressed.data(), compressed.size(), data.data(), data.size(), level)
+    );
+
+    compressed.resize(ret);
+    return compressed;
+}
+
+std::string Compress(std::string_view data, const Dictionary& dictionary) {
+    auto contexts = local_contexts.Use();
+    auto& context = GetCompressionContext(*contexts);
+
+    std::string compressed(ZSTD_compressBound(data.size()), '\0');
+    const auto ret = CheckCompressionError(ZSTD_compress_usingCDict(
+        &context,
+        compressed.data(),
+        compressed.size(),
+        data.data(),
+        data.size(),
+        dictionary.compression_dictionary_.get()
+    ));
+
+    compressed.resize(ret);
+    return compressed;
+}
+
+Dictionary::Dictionary(std::string_view content, int level)
+    : compression_dictionary_(ZSTD_createCDict(content.data(), content.size(), level)),
+      decompression_dictionary_(ZSTD_createDDict(content.data(), content.size())) {
+    if (!compression_dictionary_ || !decompression_dictionary_) {
+        throw CompressionError("Couldn't create ZSTD dictionary");
+    }
+}
+
+Dictionary::~Dictionary() = default;
+
+unsigned Dictionary::GetId() const { return ZSTD_getDictID_fromDDict(decompression_dictionary_.get()); }
+
+Compressor::Compressor(int level) : context_(ZSTD_createCCtx()) {
+    if (!context_) {
+        throw CompressionError("Couldn't create ZSTD compression context");
+    }
+
+    CheckCompressionError(ZSTD_CCtx_setParameter(context_.get(), ZSTD_c_compressionLevel, level));
+}
+
+Compressor::Compressor(std::shared_ptr<const Dictionary> dictionary)
+    : context_(ZSTD_createCCtx()), dictionary_(std::move(dictionary)) {
+    UINVARIANT(dictionary_, "Dictionary should not be null");
+    if (!context_) {
+        throw CompressionError("Couldn't create ZSTD compression context");
+    }
+
+    CheckCompressionError(ZSTD_CCtx_refCDict(context_.get(), dictionary_->compression_dictionary_.get()));
+}
+
+Compressor::Compressor(Compressor&&) noexcept = default;
+
+Compressor& Compressor::operator=(Compressor&&) noexcept = default;
+
+Compressor::~Compressor() = default;
+
+StreamResult Compressor::Compress(std::string_view input, utils::span<char> output, FlushMode mode) {
+    UASSERT(context_);
+    const auto directive = ToEndDirective(mode);
+
+    ZSTD_inBuffer input_buffer{input.data(), input.size(), 0};
+    ZSTD_outBuffer output_buffer{output.data(), output.size(), 0};
+
+    bool done = false;
+    while (true) {
+        const auto input_pos = input_buffer.pos;
+        const auto output_pos = output_buffer.pos;
+
+        const auto remaining =
+            CheckCompressionError(ZSTD_compressStream2(context_.get(), &output_buffer, &input_buffer, directive));
+        done = (mode == FlushMode::kNone) ? input_buffer.pos == input_buffer.size : remaining == 0;
+
+        const bool no_progress = input_buffer.pos == input_pos && output_buffer.pos == output_pos;
+        if (done || output_buffer.pos == output_buffer.size || no_progress) break;
+    }
+
+    return {input_buffer.pos, output_buffer.pos, done};
+}
+
+std::string Compressor::Compress(std::string_view chunk) { return CompressToString(*this, chunk, FlushMode::kFlush); }
+
+std::string Compressor::Finish() { return CompressToString(*this, {}, FlushMode::kFinish); }
+
+void Compressor::Reset() noexcept {
+    UASSERT(context_);
+    // Keeps the parameters and the dictionary
+    ZSTD_CCtx_reset(context_.get(), ZSTD_reset_session_only);
+}
+
+Decompressor::Decompressor() : context_(ZSTD_createDCtx()) {
+    if (!context_) {
+        throw DecompressionError("Couldn't create ZSTD decompression context");
+    }
+}
+
+Decompressor::Decompressor(std::shared_ptr<const Dictionary> dictionary)
+    : context_(ZSTD_createDCtx()), dictionary_(std::move(dictionary)) {
+    UINVARIANT(dictionary_, "Dictionary should not be null");
+    if (!context_) {
+        throw DecompressionError("Couldn't create ZSTD decompression context");
+    }
+
+    CheckDecompressionError(ZSTD_DCtx_refDDict(context_.get(), dictionary_->decompression_dictionary_.get()));
+}
+
+Decompressor::Decompressor(Decompressor&&) noexcept = default;
+
+Decompressor& Decompressor::operator=(Decompressor&&) noexcept = default;
+
+Decompressor::~Decompressor() = default;
+
+StreamResult Decompressor::Decompress(std::string_view input, utils::span<char> output) {
+    UASSERT(context_);
+
+    ZSTD_inBuffer input_buffer{input.data(), input.size(), 0};
+    ZSTD_outBuffer output_buffer{output.data(), output.size(), 0};
+
+    bool done = false;
+    while (true) {
+        const auto input_pos = input_buffer.pos;
+        const auto output_pos = output_buffer.pos;
+
+        // 0 means that the frame is completely decoded and flushed
+        done = CheckDecompressionError(ZSTD_decompressStream(context_.get(), &output_buffer, &input_buffer)) == 0;
+
+        const bool no_progress = input_buffer.pos == input_pos && output_buffer.pos == output_pos;
+        if (done || input_buffer.pos == input_buffer.size || output_buffer.pos == output_buffer.size || no_progress) {
+            break;
+        }
+    }
+
+    return {input_buffer.pos, output_buffer.pos, done};
+}
+
+void Decompressor::Reset() noexcept {
+    UASSERT(context_);
+    // Keeps the parameters and the dictionary
+    ZSTD_DCtx_reset(context_.get(), ZSTD_reset_session_only);
+}
+
 }  // namespace compression::zstd
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 
+#include <array>
 #include <chrono>
 #include <random>
 
@@ -44,4 +45,61 @@ static void ZstdDecompress(benchmark::State& state) {
 }
 BENCHMARK(ZstdDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
 
+static void ZstdCompress(benchmark::State& state) {
+    const auto data = GenerateRandomData(state.range(0));
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(compression::zstd::Compress(data));
+    }
+}
+BENCHMARK(ZstdCompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
+
+static void ZstdStreamCompress(benchmark::State& state) {
+    const auto data = GenerateRandomData(state.range(0));
+    compression::zstd::Compressor compressor;
+    std::array<char, 4096> buffer{};
+
+    for ([[maybe_unused]] auto _ : state) {
+        std::string_view input = data;
+        while (true) {
+            const auto result = compressor.Compress(input, buffer, compression::FlushMode::kFinish);
+            input.remove_prefix(result.consumed);
+            if (result.done) break;
+        }
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+BENCHMARK(ZstdStreamCompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
+
+static void ZstdStreamDecompress(benchmark::State& state) {
+    const auto compressed = compression::zstd::Compress(GenerateRandomData(state.range(0)));
+    compression::zstd::Decompressor decompressor;
+    std::array<char, 4096> buffer{};
+
+    for ([[maybe_unused]] auto _ : state) {
+        std::string_view input = compressed;
+        while (true) {
+            const auto result = decompressor.Decompress(input, buffer);
+            input.remove_prefix(result.consumed);
+            if (result.done) break;
+        }
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+BENCHMARK(ZstdStreamDecompress)->RangeMultiplier(2)->Range(1 << 10, 1 << 15);
+
+static void ZstdDictionaryCompress(benchmark::State& state) {
+    // Small messages of the same kind is the main use case for dictionaries
+    const std::string message = R"({"id":42,"name":"some-user","active":true,"roles":["reader","writer"]})";
+    std::string dictionary_content;
+    for (int i = 0; i < 100; ++i) {
+        dictionary_content += message;
+    }
+    const compression::zstd::Dictionary dictionary{dictionary_content};
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(compression::zstd::Compress(message, dictionary));
+    }
+}
+BENCHMARK(ZstdDictionaryCompress);
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <zdict.h>
 #include <zstd.h>
 #include <userver/compression/zstd.hpp>
 
@@ -60,4 +67,156 @@ TEST(Zstd, TestOverflow) {
     );
 }
 
+TEST(Zstd, CompressRoundtrip) {
+    const std::string str = std::string(10'000, 'a') + "abcdefgh" + std::string(10'000, 'b');
+
+    for (const int level : {1, compression::zstd::kDefaultLevel, 19}) {
+        const auto compressed = compression::zstd::Compress(str, level);
+        EXPECT_LT(compressed.size(), str.size());
+        EXPECT_EQ(compression::zstd::Decompress(compressed, str.size()), str);
+    }
+}
+
+TEST(Zstd, CompressEmpty) {
+    const auto compressed = compression::zstd::Compress({});
+    EXPECT_FALSE(compressed.empty());
+    EXPECT_EQ(compression::zstd::Decompress(compressed, 0), "");
+}
+
+TEST(Zstd, CompressorRoundtrip) {
+    compression::zstd::Compressor compressor{1};
+
+    std::string expected;
+    std::string compressed;
+    for (int i = 0; i < 10; ++i) {
+        const auto chunk = std::to_string(i) + std::string(1000, 'a' + i);
+        compressed += compressor.Compress(chunk);
+        expected += chunk;
+
+        // Everything pushed so far is flushed
+        EXPECT_EQ(compression::zstd::Decompress(compressed, expected.size()), expected);
+    }
+    compressed += compressor.Finish();
+
+    EXPECT_EQ(compression::zstd::Decompress(compressed, expected.size()), expected);
+}
+
+namespace {
+
+constexpr std::size_t kSmallBufferSize = 7;
+
+std::string StreamCompress(compression::zstd::Compressor& compressor, std::string_view data) {
+    std::string compressed;
+    char buffer[kSmallBufferSize];
+    // Push the data in small chunks and pull the output into a small buffer
+    for (std::size_t pos = 0; pos < data.size(); pos += kSmallBufferSize) {
+        auto chunk = data.substr(pos, kSmallBufferSize);
+        while (true) {
+            const auto result = compressor.Compress(chunk, buffer, compression::FlushMode::kNone);
+            chunk.remove_prefix(result.consumed);
+            compressed.append(buffer, result.produced);
+            if (result.done) break;
+        }
+    }
+    while (true) {
+        const auto result = compressor.Compress({}, buffer, compression::FlushMode::kFinish);
+        compressed.append(buffer, result.produced);
+        if (result.done) break;
+    }
+    return compressed;
+}
+
+std::string StreamDecompress(compression::zstd::Decompressor& decompressor, std::string_view compressed) {
+    std::string decompressed;
+    char buffer[kSmallBufferSize];
+    while (true) {
+        const auto result = decompressor.Decompress(compressed, buffer);
+        compressed.remove_prefix(result.consumed);
+        decompressed.append(buffer, result.produced);
+        if (result.done) break;
+        EXPECT_TRUE(result.consumed != 0 || result.produced != 0) << "No progress";
+    }
+    EXPECT_TRUE(compressed.empty());
+    return decompressed;
+}
+
+std::string MakeJsonLikeData(int seed) {
+    std::string result = "[";
+    for (int i = 0; i < 10; ++i) {
+        result += fmt::format(
+            R"({{"id":{},"name":"user-{}","active":true,"roles":["reader","writer"]}},)", seed + i, i
+        );
+    }
+    result.back() = ']';
+    return result;
+}
+
+}  // namespace
+
+TEST(Zstd, StreamRoundtrip) {
+    const std::string str = std::string(10'000, 'a') + "abcdefgh" + std::string(10'000, 'b');
+
+    compression::zstd::Compressor compressor;
+    compression::zstd::Decompressor decompressor;
+    for (int i = 0; i < 3; ++i) {
+        // Contexts are reused for the next frame
+        const auto compressed = StreamCompress(compressor, str);
+        EXPECT_LT(compressed.size(), str.size());
+        EXPECT_EQ(StreamDecompress(decompressor, compressed), str);
+        EXPECT_EQ(compression::zstd::Decompress(compressed, str.size()), str);
+    }
+}
+
+TEST(Zstd, DecompressorReset) {
+    const std::string str(1000, 'a');
+    const auto compressed = compression::zstd::Compress(str);
+
+    compression::zstd::Decompressor decompressor;
+    char buffer[100];
+    const auto result = decompressor.Decompress(compressed.substr(0, compressed.size() / 2), buffer);
+    EXPECT_FALSE(result.done);
+
+    decompressor.Reset();
+    EXPECT_EQ(StreamDecompress(decompressor, compressed), str);
+}
+
+TEST(Zstd, DecompressorCorrupted) {
+    compression::zstd::Decompressor decompressor;
+    char buffer[100];
+    EXPECT_THROW(decompressor.Decompress("definitely not a zstd frame", buffer), compression::DecompressionError);
+}
+
+TEST(Zstd, Dictionary) {
+    std::string samples;
+    std::vector<std::size_t> sample_sizes;
+    for (int i = 0; i < 1000; ++i) {
+        const auto sample = MakeJsonLikeData(i * 10);
+        samples += sample;
+        sample_sizes.push_back(sample.size());
+    }
+
+    std::string dictionary_content(16 * 1024, '\0');
+    const auto dictionary_size = ZDICT_trainFromBuffer(
+        dictionary_content.data(), dictionary_content.size(), samples.data(), sample_sizes.data(), sample_sizes.size()
+    );
+    ASSERT_FALSE(ZDICT_isError(dictionary_size)) << ZDICT_getErrorName(dictionary_size);
+    dictionary_content.resize(dictionary_size);
+
+    const auto dictionary = std::make_shared<const compression::zstd::Dictionary>(dictionary_content);
+    EXPECT_NE(dictionary->GetId(), 0);
+
+    const auto data = MakeJsonLikeData(100'500);
+    const auto compressed = compression::zstd::Compress(data, *dictionary);
+    EXPECT_LT(compressed.size(), compression::zstd::Compress(data).size());
+    EXPECT_EQ(compression::zstd::Decompress(compressed, data.size(), *dictionary), data);
+
+    compression::zstd::Compressor compressor{dictionary};
+    compression::zstd::Decompressor decompressor{dictionary};
+    const auto stream_compressed = StreamCompress(compressor, data);
+    EXPECT_EQ(StreamDecompress(decompressor, stream_compressed), data);
+    EXPECT_EQ(compression::zstd::Decompress(stream_compressed, data.size(), *dictionary), data);
+
+    EXPECT_THROW(compression::zstd::Decompress(compressed, data.size()), compression::DecompressionError);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,107 @@
+#include <formats/json/impl/simdjson_parse.hpp>
+
+#include <rapidjson/document.h>
+
+#ifdef USERVER_FEATURE_SIMDJSON
+#include <simdjson.h>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+#ifdef USERVER_FEATURE_SIMDJSON
+
+namespace {
+
+// The parser reuses its internal buffers between the documents
+compiler::ThreadLocal local_parser = [] { return simdjson::dom::parser{}; };
+
+using Allocator = Document::AllocatorType;
+
+void Convert(simdjson::dom::element element, Value& out, Allocator& allocator, std::size_t depth) {
+    switch (element.type()) {
+        case simdjson::dom::element_type::ARRAY: {
+            const auto array = element.get_array().value_unsafe();
+            out.SetArray();
+            if (array.size() == 0) return;
+
+            if (++depth >= kDepthParseLimit) {
+                throw ParseException("Exceeded maximum allowed JSON depth of: " + std::to_string(kDepthParseLimit));
+            }
+            out.Reserve(static_cast<::rapidjson::SizeType>(array.size()), allocator);
+            for (const auto child : array) {
+                Value value;
+                Convert(child, value, allocator, depth);
+                out.PushBack(value, allocator);
+            }
+            return;
+        }
+        case simdjson::dom::element_type::OBJECT: {
+            const auto object = element.get_object().value_unsafe();
+            out.SetObject();
+            if (object.size() == 0) return;
+
+            if (++depth >= kDepthParseLimit) {
+                throw ParseException("Exceeded maximum allowed JSON depth of: " + std::to_string(kDepthParseLimit));
+            }
+            out.MemberReserve(static_cast<::rapidjson::SizeType>(object.size()), allocator);
+            for (const auto field : object) {
+                Value name{field.key.data(), static_cast<::rapidjson::SizeType>(field.key.size()), allocator};
+                Value value;
+                Convert(field.value, value, allocator, depth);
+                out.AddMember(name, value, allocator);
+            }
+            return;
+        }
+        case simdjson::dom::element_type::STRING: {
+            const auto string = element.get_string().value_unsafe();
+            out.SetString(string.data(), static_cast<::rapidjson::SizeType>(string.size()), allocator);
+            return;
+        }
+        case simdjson::dom::element_type::INT64:
+            out.SetInt64(element.get_int64().value_unsafe());
+            return;
+        case simdjson::dom::element_type::UINT64:
+            out.SetUint64(element.get_uint64().value_unsafe());
+            return;
+        case simdjson::dom::element_type::DOUBLE:
+            out.SetDouble(element.get_double().value_unsafe());
+            return;
+        case simdjson::dom::element_type::BOOL:
+            out.SetBool(element.get_bool().value_unsafe());
+            return;
+        case simdjson::dom::element_type::NULL_VALUE:
+            out.SetNull();
+            return;
+    }
+}
+
+}  // namespace
+
+bool ParseWithSimdjson(std::string_view doc, Document& json) {
+    auto parser = local_parser.Use();
+
+    simdjson::dom::element root;
+    // The document is copied into a padded buffer of the parser
+    if (parser->parse(doc.data(), doc.size()).get(root) != simdjson::SUCCESS) {
+        return false;
+    }
+
+    Convert(root, json, json.GetAllocator(), 0);
+    return true;
+}
+
+#else
+
+bool ParseWithSimdjson(std::string_view /*doc*/, Document& /*json*/) { return false; }
+
+#endif
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
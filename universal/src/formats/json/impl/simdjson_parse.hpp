@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string_view>
+
+#include <userver/formats/json/impl/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// @brief Parses the document with simdjson into the rapidjson DOM.
+///
+/// @returns false if userver is built without simdjson or simdjson fails to
+/// parse the document. The caller falls back to rapidjson to report the same
+/// errors and to handle the numbers that simdjson does not support.
+bool ParseWithSimdjson(std::string_view doc, Document& json);
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,31 @@
+#include <formats/json/impl/string_output_stream.hpp>
+
+#include <algorithm>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+namespace {
+
+constexpr std::size_t kInitialCapacity = 256;
+
+}  // namespace
+
+std::string StringOutputStream::Extract() {
+    data_.resize(size_);
+    // Do not hold up to twice the memory in a long living response body
+    if (data_.capacity() / 2 > size_) data_.shrink_to_fit();
+
+    size_ = 0;
+    return std::exchange(data_, {});
+}
+
+void StringOutputStream::Grow(std::size_t count) {
+    data_.resize(std::max({size_ + count, data_.size() * 2, kInitialCapacity}));
+}
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
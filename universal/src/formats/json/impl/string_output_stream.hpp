@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include <rapidjson/writer.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// rapidjson output stream that writes right into std::string, so that the
+/// result may be moved out without a copy, unlike rapidjson::StringBuffer.
+class StringOutputStream final {
+public:
+    using Ch = char;
+
+    StringOutputStream() = default;
+    StringOutputStream(const StringOutputStream&) = delete;
+    StringOutputStream& operator=(const StringOutputStream&) = delete;
+
+    void Put(char c) {
+        Reserve(1);
+        PutUnsafe(c);
+    }
+
+    void PutUnsafe(char c) { data_[size_++] = c; }
+
+    void Reserve(std::size_t count) {
+        if (data_.size() - size_ < count) Grow(count);
+    }
+
+    char* Push(std::size_t count) {
+        Reserve(count);
+        auto* result = data_.data() + size_;
+        size_ += count;
+        return result;
+    }
+
+    void Pop(std::size_t count) { size_ -= count; }
+
+    void Flush() {}
+
+    std::string_view GetStringView() const { return {data_.data(), size_}; }
+
+    /// Moves the written data out, the stream becomes empty
+    std::string Extract();
+
+private:
+    void Grow(std::size_t count);
+
+    // data_.size() is the capacity of the stream, size_ is the written size
+    std::string data_;
+    std::size_t size_{0};
+};
+
+// Found by ADL from rapidjson::Writer, preferred over the generic templates
+inline void PutReserve(StringOutputStream& stream, std::size_t count) { stream.Reserve(count); }
+
+inline void PutUnsafe(StringOutputStream& stream, char c) { stream.PutUnsafe(c); }
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
+
+namespace rapidjson {
+
+// Numbers are written in place, as rapidjson does for StringBuffer
+
+template <>
+inline bool Writer<USERVER_NAMESPACE::formats::json::impl::StringOutputStream>::WriteInt(int i) {
+    char* buffer = os_->Push(11);
+    const char* end = internal::i32toa(i, buffer);
+    os_->Pop(static_cast<size_t>(11 - (end - buffer)));
+    return true;
+}
+
+template <>
+inline bool Writer<USERVER_NAMESPACE::formats::json::impl::StringOutputStream>::WriteUint(unsigned u) {
+    char* buffer = os_->Push(10);
+    const char* end = internal::u32toa(u, buffer);
+    os_->Pop(static_cast<size_t>(10 - (end - buffer)));
+    return true;
+}
+
+template <>
+inline bool Writer<USERVER_NAMESPACE::formats::json::impl::StringOutputStream>::WriteInt64(int64_t i64) {
+    char* buffer = os_->Push(21);
+    const char* end = internal::i64toa(i64, buffer);
+    os_->Pop(static_cast<size_t>(21 - (end - buffer)));
+    return true;
+}
+
+template <>
+inline bool Writer<USERVER_NAMESPACE::formats::json::impl::StringOutputStream>::WriteUint64(uint64_t u) {
+    char* buffer = os_->Push(20);
+    const char* end = internal::u64toa(u, buffer);
+    os_->Pop(static_cast<size_t>(20 - (end - buffer)));
+    return true;
+}
+
+template <>
+inline bool Writer<USERVER_NAMESPACE::formats::json::impl::StringOutputStream>::WriteDouble(double d) {
+    // NaN and Inf are rejected by the default write flags
+    if (internal::Double(d).IsNanOrInf()) return false;
+
+    char* buffer = os_->Push(25);
+    char* end = internal::dtoa(d, buffer, maxDecimalPlaces_);
+    os_->Pop(static_cast<size_t>(25 - (end - buffer)));
+    return true;
+}
+
+}  // namespace rapidjson
@@ -4,6 +4,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/parse/common_containers.hpp>
@@ -70,4 +71,60 @@ TEST(FormatsJson, ParseHours) {
     UEXPECT_THROW(formats::json::FromString(R"( "42h" )").As<std::chrono::hours>(), formats::json::Exception);
 }
 
+TEST(FormatsJson, ParserBackendsAreEquivalent) {
+    using formats::json::ParserBackend;
+
+    for (const std::string_view doc : {
+             R"({})",
+             R"([])",
+             R"( [ {}, [], "" ] )",
+             R"(42)",
+             R"(-42)",
+             R"(1.5)",
+             R"([0, -0, 0.0, 1e3, -1.25e-3])",
+             R"([9223372036854775807, 9223372036854775808, -9223372036854775808, 18446744073709551615])",
+             R"(18446744073709551616)",
+             R"("A\n\"\\😀 привет")",
+             R"({"a": [1, 2, {"b": null, "c": true, "d": false}], "e": "x", "": {}})",
+         }) {
+        const auto rapidjson_value = formats::json::FromString(doc, ParserBackend::kRapidJson);
+        const auto simdjson_value = formats::json::FromString(doc, ParserBackend::kSimdJson);
+        EXPECT_EQ(rapidjson_value, simdjson_value) << doc;
+        EXPECT_EQ(ToString(rapidjson_value), ToString(simdjson_value)) << doc;
+    }
+
+    const auto numbers = formats::json::FromString("[1, -1, 18446744073709551615, 1.0]", ParserBackend::kSimdJson);
+    EXPECT_TRUE(numbers[0].IsInt());
+    EXPECT_TRUE(numbers[1].IsInt64());
+    EXPECT_TRUE(numbers[2].IsUInt64());
+    EXPECT_FALSE(numbers[2].IsInt64());
+    EXPECT_TRUE(numbers[3].IsDouble());
+}
+
+TEST(FormatsJson, ParserBackendsErrors) {
+    using formats::json::ParserBackend;
+
+    std::string deep(formats::json::kDepthParseLimit + 1, '[');
+    deep.append(formats::json::kDepthParseLimit + 1, ']');
+
+    for (const std::string_view doc : {
+             std::string_view{},
+             std::string_view{"[1,"},
+             std::string_view{R"({"a": 1, "a": 2})"},
+             std::string_view{R"({"a": {"b": 1, "b": 2}})"},
+             std::string_view{deep},
+         }) {
+        std::string rapidjson_error;
+        try {
+            formats::json::FromString(doc, ParserBackend::kRapidJson);
+        } catch (const formats::json::ParseException& e) {
+            rapidjson_error = e.what();
+        }
+        EXPECT_FALSE(rapidjson_error.empty()) << doc;
+        UEXPECT_THROW_MSG(
+            formats::json::FromString(doc, ParserBackend::kSimdJson), formats::json::ParseException, rapidjson_error
+        );
+    }
+}
+
 USERVER_NAMESPACE_END
@@ -17,11 +17,14 @@
 
 #include <formats/json/impl/accept.hpp>
 #include <formats/json/impl/json_tree.hpp>
+#include <formats/json/impl/simdjson_parse.hpp>
+#include <formats/json/impl/string_output_stream.hpp>
 #include <formats/json/impl/types_impl.hpp>
 #include <userver/formats/json/exception.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/impl/buffer_chain.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -97,12 +100,18 @@ impl::VersionedValuePtr EnsureValid(impl::Document&& json) {
 
 }  // namespace
 
-Value FromString(std::string_view doc) {
+Value FromString(std::string_view doc) { return FromString(doc, ParserBackend::kRapidJson); }
+
+Value FromString(std::string_view doc, ParserBackend backend) {
     if (doc.empty()) {
         throw ParseException("JSON document is empty");
     }
 
     impl::Document json{&g_allocator};
+    if (backend == ParserBackend::kSimdJson && impl::ParseWithSimdjson(doc, json)) {
+        return Value{EnsureValid(std::move(json))};
+    }
+
     rapidjson::ParseResult ok =
         json.Parse<rapidjson::kParseDefaultFlags | rapidjson::kParseIterativeFlag | rapidjson::kParseFullPrecisionFlag>(
             doc.data(), doc.size()
@@ -151,10 +160,10 @@ void Serialize(const Value& doc, std::ostream& os) {
 }
 
 std::string ToString(const Value& doc) {
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer writer(buffer);
+    impl::StringOutputStream stream;
+    rapidjson::Writer writer(stream);
     AcceptNoRecursion(doc.GetNative(), writer);
-    return std::string{buffer.GetString(), buffer.GetLength()};
+    return stream.Extract();
 }
 
 std::string ToStableString(const Value& doc) { return ToStableString(doc.Clone()); }
@@ -163,10 +172,10 @@ std::string ToStableString(Value&& doc) {
     if (doc.IsUniqueReference()) {
         Value value = std::move(doc);
 
-        rapidjson::StringBuffer buffer;
-        rapidjson::Writer writer(buffer);
+        impl::StringOutputStream stream;
+        rapidjson::Writer writer(stream);
         AcceptNoRecursion<ObjectProcessing::kInplaceSorting>(value.GetNative(), writer);
-        return std::string{buffer.GetString(), buffer.GetLength()};
+        return stream.Extract();
     }
     return ToStableString(doc.Clone());
 }
@@ -217,6 +226,29 @@ std::string_view StringBuffer::GetStringView() const {
     return std::string_view{pimpl_->buffer.GetString(), pimpl_->buffer.GetLength()};
 }
 
+namespace {
+
+class BufferChainOutputStream final {
+public:
+    using Ch = char;
+
+    explicit BufferChainOutputStream(utils::impl::BufferChain& chain) : chain_(chain) {}
+
+    void Put(char c) { chain_.Append(c); }
+    void Flush() {}
+
+private:
+    utils::impl::BufferChain& chain_;
+};
+
+}  // namespace
+
+void ToBufferChain(const formats::json::Value& value, utils::impl::BufferChain& chain) {
+    BufferChainOutputStream stream{chain};
+    rapidjson::Writer writer(stream);
+    AcceptNoRecursion(value.GetNative(), writer);
+}
+
 }  // namespace impl
 
 }  // namespace formats::json
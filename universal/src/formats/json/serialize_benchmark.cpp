@@ -1,5 +1,7 @@
+#include <string>
 #include <string_view>
 #include <variant>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 #include <rapidjson/document.h>
@@ -1174,6 +1176,14 @@ void DeepWidthJson(benchmark::State& state) {
     }
 }
 
+// same as DeepWidthJson, but with ParserBackend::kSimdJson
+void DeepWidthJsonSimdJson(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        auto json = formats::json::FromString(str_deep_width_json, formats::json::ParserBackend::kSimdJson);
+        benchmark::DoNotOptimize(json);
+    }
+}
+
 BENCHMARK(SmallJson);
 
 BENCHMARK(MiddleJson);
@@ -1184,6 +1194,8 @@ BENCHMARK(DeepJson);
 
 BENCHMARK(DeepWidthJson);
 
+BENCHMARK(DeepWidthJsonSimdJson);
+
 namespace {
 
 struct InnerObject final {
@@ -1251,6 +1263,31 @@ void JsonArrayToVariantParseBenchmark(benchmark::State& state) {
 }
 BENCHMARK(JsonArrayToVariantParseBenchmark)->Range(16, 4096);
 
+void JsonToStringLargeResponse(benchmark::State& state) {
+    const std::size_t data_size = state.range(0);
+
+    formats::json::ValueBuilder builder{formats::common::Type::kArray};
+    for (std::size_t i = 0; i < data_size; ++i) {
+        formats::json::ValueBuilder item;
+        item["id"] = i;
+        item["name"] = "some reasonably long item name " + std::to_string(i);
+        item["price"] = i * 0.25;
+        item["tags"] = std::vector<std::string>{"first", "second", "third"};
+        builder.PushBack(std::move(item));
+    }
+    const auto json = builder.ExtractValue();
+
+    std::size_t size = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        auto result = formats::json::ToString(json);
+        size = result.size();
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+// 100KB to 6MB of JSON
+BENCHMARK(JsonToStringLargeResponse)->RangeMultiplier(4)->Range(1 << 10, 1 << 16);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -10,6 +10,7 @@
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/formats/parse/common_containers.hpp>
 #include <userver/utils/fmt_compat.hpp>
+#include <userver/utils/impl/buffer_chain.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -27,7 +28,8 @@ struct Serialization<formats::json::Value> : public ::testing::Test {
     using MemberMissingException = formats::json::MemberMissingException;
     using BadStreamException = formats::json::BadStreamException;
 
-    constexpr static auto FromString = formats::json::FromString;
+    constexpr static auto FromString =
+        static_cast<formats::json::Value (*)(std::string_view)>(formats::json::FromString);
     constexpr static auto FromStream = formats::json::FromStream;
 };
 
@@ -100,6 +102,20 @@ INSTANTIATE_TEST_SUITE_P(
     testing::Values(R"({"field":123})", "null", "12345", "123.45", R"(["abc","def"])")
 );
 
+TEST(FormatsJson, ToBufferChain) {
+    formats::json::ValueBuilder builder{formats::common::Type::kArray};
+    for (int i = 0; i < 10'000; ++i) {
+        builder.PushBack(fmt::format("item \"{}\"", i));
+        builder.PushBack(i * 1.5);
+    }
+    const auto value = builder.ExtractValue();
+
+    utils::impl::BufferChain chain;
+    formats::json::impl::ToBufferChain(value, chain);
+    EXPECT_GT(chain.GetChunksCount(), 1);
+    EXPECT_EQ(chain.ToString(), formats::json::ToString(value));
+}
+
 TEST(JsonToSortedString, Null) {
     const formats::json::Value example = formats::json::FromString("null");
     ASSERT_EQ(formats::json::ToStableString(example), "null");
@@ -4,10 +4,10 @@
 #include <stdexcept>
 
 #include <rapidjson/document.h>
-#include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/string_output_stream.hpp>
 #include <userver/formats/common/validations.hpp>
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/formats/json/value.hpp>
@@ -19,8 +19,8 @@ USERVER_NAMESPACE_BEGIN
 namespace formats::json {
 
 struct StringBuilder::Impl {
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer{buffer};
+    impl::StringOutputStream buffer;
+    rapidjson::Writer<impl::StringOutputStream> writer{buffer};
 
     Impl() = default;
 };
@@ -29,13 +29,12 @@ StringBuilder::StringBuilder() = default;
 
 StringBuilder::~StringBuilder() = default;
 
-std::string_view StringBuilder::GetStringView() const {
-    const auto& buffer = impl_->buffer;
-    return {buffer.GetString(), buffer.GetLength()};
-}
+std::string_view StringBuilder::GetStringView() const { return impl_->buffer.GetStringView(); }
 
 std::string StringBuilder::GetString() const { return std::string{GetStringView()}; }
 
+std::string StringBuilder::ExtractString() { return impl_->buffer.Extract(); }
+
 void StringBuilder::WriteNull() { impl_->writer.Null(); }
 
 void StringBuilder::WriteString(std::string_view value) { impl_->writer.String(value.data(), value.size()); }
@@ -74,4 +74,41 @@ void JsonStringBuilder(benchmark::State& state) {
 }
 BENCHMARK(JsonStringBuilder)->RangeMultiplier(4)->Range(1, 1024);
 
+void WriteLargeResponse(std::size_t items_count, StringBuilder& sw) {
+    StringBuilder::ArrayGuard guard(sw);
+    for (std::size_t i = 0; i < items_count; ++i) {
+        StringBuilder::ObjectGuard item_guard(sw);
+
+        sw.Key("id");
+        sw.WriteUInt64(i);
+
+        sw.Key("name");
+        sw.WriteString("some reasonably long item name");
+
+        sw.Key("price");
+        sw.WriteDouble(i * 0.25);
+    }
+}
+
+void JsonStringBuilderLargeGetString(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        StringBuilder sw;
+        WriteLargeResponse(state.range(0), sw);
+        auto str = sw.GetString();
+        benchmark::DoNotOptimize(str);
+    }
+}
+// 70KB to 4.5MB of JSON
+BENCHMARK(JsonStringBuilderLargeGetString)->RangeMultiplier(4)->Range(1 << 10, 1 << 16);
+
+void JsonStringBuilderLargeExtractString(benchmark::State& state) {
+    for ([[maybe_unused]] auto _ : state) {
+        StringBuilder sw;
+        WriteLargeResponse(state.range(0), sw);
+        auto str = sw.ExtractString();
+        benchmark::DoNotOptimize(str);
+    }
+}
+BENCHMARK(JsonStringBuilderLargeExtractString)->RangeMultiplier(4)->Range(1 << 10, 1 << 16);
+
 USERVER_NAMESPACE_END
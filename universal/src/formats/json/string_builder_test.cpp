@@ -224,6 +224,25 @@ TEST(JsonStringBuilder, FilledOptional) {
     EXPECT_EQ(sw.GetString(), "42");
 }
 
+TEST(JsonStringBuilder, ExtractString) {
+    const std::string long_string(100'000, 'x');
+    StringBuilder sw;
+    {
+        const StringBuilder::ArrayGuard guard{sw};
+        for (int i = 0; i < 100; ++i) {
+            WriteToStream(i, sw);
+            WriteToStream(1.5, sw);
+            WriteToStream(long_string, sw);
+        }
+    }
+
+    const auto expected = sw.GetString();
+    const auto result = sw.ExtractString();
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(FromString(result).GetSize(), 300);
+    EXPECT_EQ(FromString(result)[299].As<std::string>(), long_string);
+}
+
 template <typename T>
 class JsonStringBuilderIntegralTypes : public ::testing::Test {};
 
@@ -13,7 +13,8 @@ USERVER_NAMESPACE_BEGIN
 
 template <>
 struct Parsing<formats::json::Value> : public ::testing::Test {
-    constexpr static auto FromString = formats::json::FromString;
+    constexpr static auto FromString =
+        static_cast<formats::json::Value (*)(std::string_view)>(formats::json::FromString);
     using ParseException = formats::json::Value::ParseException;
 };
 
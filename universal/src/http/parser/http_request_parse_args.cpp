@@ -1,10 +1,12 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 
-#include <cstring>
+#include <algorithm>
 #include <stdexcept>
 
 #include <userver/utils/encoding/hex.hpp>
 
+#include <utils/impl/simd_find.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace http::parser {
@@ -18,70 +20,67 @@ void ParseArgs(
     });
 }
 
+namespace {
+
+[[noreturn]] void ThrowInvalidPercentEncoding(std::string_view url, const char* ptr) {
+    static constexpr std::size_t kMaxOutputLength = 100;
+    std::string data_short{url};
+    if (data_short.size() > kMaxOutputLength) {
+        data_short = data_short.substr(0, kMaxOutputLength);
+        data_short += "<...>";
+    }
+    const auto percent_encoded_len =
+        std::min(static_cast<std::size_t>(url.data() + url.size() - ptr), std::size_t{3});
+
+    throw std::runtime_error(
+        "invalid percent-encoding sequence '" + std::string(ptr, percent_encoded_len) + "\' in input '" +
+        std::move(data_short) + '\''
+    );
+}
+
+}  // namespace
+
 std::string UrlDecode(std::string_view url) {
-    const auto* data = url.data();
-    const auto* data_end = url.data() + url.size();
+    const char* ptr = url.data();
+    const char* const data_end = url.data() + url.size();
+    const char* special = utils::impl::FindFirstOf<'%', '+'>(ptr, data_end);
     // Fast path: no %, just id
-    if (!memchr(data, '%', data_end - data) && !memchr(data, '+', data_end - data)) {
-        return {data, data_end};
-    }
+    if (special == data_end) return std::string{url};
 
     std::string res;
-    for (const char* ptr = data; ptr < data_end; ++ptr) {
-        if (*ptr == '%') {
-            if (ptr + 2 < data_end && utils::encoding::FromHex({ptr + 1, 2}, res) == 2) {
-                ptr += 2;
-            } else {
-                static constexpr std::size_t kMaxOutputLength = 100;
-                std::string data_short(data, data_end - data);
-                if (data_short.size() > kMaxOutputLength) {
-                    data_short = data_short.substr(0, kMaxOutputLength);
-                    data_short += "<...>";
-                }
-                const auto percent_encoded_len = std::min(static_cast<std::size_t>(data_end - ptr), std::size_t{3});
-
-                throw std::runtime_error(
-                    "invalid percent-encoding sequence '" + std::string(ptr, percent_encoded_len) + "\' in input '" +
-                    std::move(data_short) + '\''
-                );
-            }
-        } else if (*ptr == '+') {
+    res.reserve(url.size());
+    while (true) {
+        // Copy the plain characters up to the next '%' or '+' at once
+        res.append(ptr, special);
+        if (special == data_end) break;
+
+        if (*special == '+') {
             res += ' ';
+            ptr = special + 1;
+        } else if (special + 2 < data_end && utils::encoding::FromHex({special + 1, 2}, res) == 2) {
+            ptr = special + 3;
         } else {
-            res += *ptr;
+            ThrowInvalidPercentEncoding(url, special);
         }
+        special = utils::impl::FindFirstOf<'%', '+'>(ptr, data_end);
     }
     return res;
 }
 
 void ParseAndConsumeArgs(std::string_view args, ArgsConsumer handler) {
-    const char* end = args.data() + args.size();
+    const char* const end = args.data() + args.size();
     const char* key_begin = args.data();
-    const char* key_end = args.data();
-    bool parse_key = true;
-    for (const char* ptr = args.data(); ptr <= end; ++ptr) {
-        if (ptr == end || *ptr == '&') {
-            if (!parse_key) {
-                const char* value_begin = key_end + 1;
-                const char* value_end = ptr;
-                if (key_begin < key_end && value_begin <= value_end) {
-                    std::string_view key(key_begin, key_end - key_begin);
-                    std::string_view value(value_begin, value_end - value_begin);
-                    handler(
-                        USERVER_NAMESPACE::http::parser::UrlDecode(key),
-                        USERVER_NAMESPACE::http::parser::UrlDecode(value)
-                    );
-                }
-            }
-            parse_key = true;
-            key_begin = ptr + 1;
-            continue;
-        }
-        if (*ptr == '=' && parse_key) {
-            parse_key = false;
-            key_end = ptr;
-            continue;
+    while (true) {
+        const char* const arg_end = utils::impl::FindFirstOf<'&'>(key_begin, end);
+        const char* const key_end = utils::impl::FindFirstOf<'='>(key_begin, arg_end);
+        // Arguments without '=' and with empty names are skipped
+        if (key_end != arg_end && key_begin < key_end) {
+            const std::string_view key(key_begin, key_end - key_begin);
+            const std::string_view value(key_end + 1, arg_end - key_end - 1);
+            handler(USERVER_NAMESPACE::http::parser::UrlDecode(key), USERVER_NAMESPACE::http::parser::UrlDecode(value));
         }
+        if (arg_end == end) break;
+        key_begin = arg_end + 1;
     }
 }
 
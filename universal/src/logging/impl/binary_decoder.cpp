@@ -0,0 +1,264 @@
+#include <userver/logging/impl/binary_decoder.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <optional>
+#include <stdexcept>
+
+#include <fmt/chrono.h>
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <logging/impl/binary_format.hpp>
+
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/logging/level.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+[[noreturn]] void ThrowMalformed(std::string_view what) {
+    throw std::runtime_error(fmt::format("Malformed binary log: {}", what));
+}
+
+std::uint64_t ReadVarintOrThrow(std::string_view& data) {
+    const auto result = binary::ReadVarint(data);
+    if (!result) ThrowMalformed("truncated varint");
+    return *result;
+}
+
+std::string_view ReadBytesOrThrow(std::string_view& data, std::uint64_t size) {
+    if (size > data.size()) ThrowMalformed("truncated string");
+    const auto result = data.substr(0, size);
+    data.remove_prefix(size);
+    return result;
+}
+
+char ReadByteOrThrow(std::string_view& data) { return ReadBytesOrThrow(data, 1)[0]; }
+
+/// Receives the decoded record
+class RecordWriter {
+public:
+    virtual ~RecordWriter() = default;
+
+    virtual void Begin(std::chrono::system_clock::time_point timestamp, Level level, std::string_view module) = 0;
+    virtual void String(std::string_view key, std::string_view value) = 0;
+    virtual void Signed(std::string_view key, std::int64_t value) = 0;
+    virtual void Unsigned(std::string_view key, std::uint64_t value) = 0;
+    virtual void Double(std::string_view key, double value) = 0;
+    virtual void End() = 0;
+};
+
+std::string FormatTimestamp(std::chrono::system_clock::time_point timestamp) {
+    const auto micros =
+        std::chrono::time_point_cast<std::chrono::microseconds>(timestamp).time_since_epoch().count() % 1'000'000;
+    return fmt::format(
+        FMT_COMPILE("{:%FT%T}.{:06}"), fmt::localtime(std::chrono::system_clock::to_time_t(timestamp)), micros
+    );
+}
+
+class TskvWriter final : public RecordWriter {
+public:
+    TskvWriter(Format format, std::string& out) : out_(out), is_ltsv_(format == Format::kLtsv) {}
+
+    void Begin(std::chrono::system_clock::time_point timestamp, Level level, std::string_view module) override {
+        if (!is_ltsv_) out_ += "tskv\t";
+        DoAdd("timestamp", FormatTimestamp(timestamp), true);
+        DoAdd("level", ToUpperCaseString(level), true);
+        DoAdd("module", module, true);
+    }
+
+    void String(std::string_view key, std::string_view value) override { DoAdd(key, value, false); }
+    void Signed(std::string_view key, std::int64_t value) override { DoAdd(key, fmt::to_string(value), true); }
+    void Unsigned(std::string_view key, std::uint64_t value) override { DoAdd(key, fmt::to_string(value), true); }
+    void Double(std::string_view key, double value) override { DoAdd(key, fmt::to_string(value), true); }
+
+    void End() override { out_.back() = '\n'; }
+
+private:
+    void DoAdd(std::string_view key, std::string_view value, bool value_is_escaped) {
+        if (!utils::encoding::ShouldKeyBeEscaped(key)) {
+            out_ += key;
+        } else {
+            utils::encoding::EncodeTskv(out_, key, utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+        }
+        out_ += is_ltsv_ ? ':' : '=';
+        if (value_is_escaped) {
+            out_ += value;
+        } else {
+            utils::encoding::EncodeTskv(out_, value, utils::encoding::EncodeTskvMode::kValue);
+        }
+        out_ += utils::encoding::kTskvPairsSeparator;
+    }
+
+    std::string& out_;
+    const bool is_ltsv_;
+};
+
+class JsonWriter final : public RecordWriter {
+public:
+    JsonWriter(Format format, std::string& out) : out_(out), is_ya_deploy_(format == Format::kJsonYaDeploy) {}
+
+    void Begin(std::chrono::system_clock::time_point timestamp, Level level, std::string_view module) override {
+        object_.emplace(sb_);
+        sb_.Key(is_ya_deploy_ ? "@timestamp" : "timestamp");
+        sb_.WriteString(FormatTimestamp(timestamp));
+        sb_.Key(is_ya_deploy_ ? "levelStr" : "level");
+        sb_.WriteString(ToUpperCaseString(level));
+        sb_.Key("module");
+        sb_.WriteString(module);
+    }
+
+    void String(std::string_view key, std::string_view value) override {
+        sb_.Key((is_ya_deploy_ && key == "text") ? "message" : key);
+        sb_.WriteString(value);
+    }
+
+    void Signed(std::string_view key, std::int64_t value) override {
+        sb_.Key(key);
+        sb_.WriteInt64(value);
+    }
+
+    void Unsigned(std::string_view key, std::uint64_t value) override {
+        sb_.Key(key);
+        sb_.WriteUInt64(value);
+    }
+
+    void Double(std::string_view key, double value) override {
+        sb_.Key(key);
+        sb_.WriteDouble(value);
+    }
+
+    void End() override {
+        object_.reset();
+        out_ += sb_.GetStringView();
+        out_ += '\n';
+    }
+
+private:
+    std::string& out_;
+    const bool is_ya_deploy_;
+    formats::json::StringBuilder sb_;
+    std::optional<formats::json::StringBuilder::ObjectGuard> object_;
+};
+
+}  // namespace
+
+BinaryLogDecoder::BinaryLogDecoder(Format format) : format_(format) {
+    switch (format_) {
+        case Format::kTskv:
+        case Format::kLtsv:
+        case Format::kJson:
+        case Format::kJsonYaDeploy:
+            return;
+        default:
+            throw std::runtime_error("Binary log may be decoded only into tskv, ltsv or json formats");
+    }
+}
+
+std::size_t BinaryLogDecoder::Decode(std::string_view data, std::string& out) {
+    const auto initial_size = data.size();
+
+    while (!data.empty()) {
+        auto frame = data;
+        const auto type = static_cast<binary::FrameType>(frame[0]);
+        frame.remove_prefix(1);
+        const auto payload_size = binary::ReadVarint(frame);
+        if (!payload_size || *payload_size > frame.size()) break;
+        auto payload = frame.substr(0, *payload_size);
+        frame.remove_prefix(*payload_size);
+
+        switch (type) {
+            case binary::FrameType::kStart:
+                if (payload != binary::kMagic) ThrowMalformed("unknown format version");
+                strings_.clear();
+                break;
+            case binary::FrameType::kString: {
+                const auto id = ReadVarintOrThrow(payload);
+                if (id > strings_.size()) ThrowMalformed("missing interned strings");
+                if (id == strings_.size()) strings_.emplace_back();
+                strings_[id].assign(payload);
+                break;
+            }
+            case binary::FrameType::kRecord:
+                DecodeRecord(payload, out);
+                break;
+            default:
+                ThrowMalformed(fmt::format("unknown frame type {:#x}", static_cast<unsigned char>(type)));
+        }
+        data = frame;
+    }
+
+    return initial_size - data.size();
+}
+
+void BinaryLogDecoder::DecodeRecord(std::string_view payload, std::string& out) const {
+    const auto read_string_ref = [this](std::string_view& data) -> std::string_view {
+        const auto ref = ReadVarintOrThrow(data);
+        if (ref == 0) return ReadBytesOrThrow(data, ReadVarintOrThrow(data));
+        if (ref > strings_.size()) ThrowMalformed("unknown interned string");
+        return strings_[ref - 1];
+    };
+
+    const auto strings_used = ReadVarintOrThrow(payload);
+    if (strings_used > strings_.size()) ThrowMalformed("record precedes its interned strings");
+
+    const std::chrono::system_clock::time_point timestamp{std::chrono::duration_cast<std::chrono::system_clock::duration>(
+        std::chrono::microseconds{ReadVarintOrThrow(payload)}
+    )};
+    const auto level = static_cast<Level>(ReadByteOrThrow(payload));
+    if (level > Level::kNone) ThrowMalformed("unknown level");
+    const auto function_name = read_string_ref(payload);
+    const auto file_name = read_string_ref(payload);
+    const auto line = ReadVarintOrThrow(payload);
+    const auto module = fmt::format(FMT_COMPILE("{} ( {}:{} )"), function_name, file_name, line);
+
+    const auto write = [&](RecordWriter& writer) {
+        writer.Begin(timestamp, level, module);
+        while (!payload.empty()) {
+            const auto key = read_string_ref(payload);
+            switch (static_cast<binary::ValueType>(ReadByteOrThrow(payload))) {
+                case binary::ValueType::kString:
+                    writer.String(key, ReadBytesOrThrow(payload, ReadVarintOrThrow(payload)));
+                    break;
+                case binary::ValueType::kSigned:
+                    writer.Signed(key, binary::ZigZagDecode(ReadVarintOrThrow(payload)));
+                    break;
+                case binary::ValueType::kUnsigned:
+                    writer.Unsigned(key, ReadVarintOrThrow(payload));
+                    break;
+                case binary::ValueType::kDouble: {
+                    const auto bytes = ReadBytesOrThrow(payload, sizeof(std::uint64_t));
+                    std::uint64_t bits = 0;
+                    for (std::size_t i = 0; i < bytes.size(); ++i) {
+                        bits |= std::uint64_t{static_cast<unsigned char>(bytes[i])} << (8 * i);
+                    }
+                    double value = 0;
+                    std::memcpy(&value, &bits, sizeof(value));
+                    writer.Double(key, value);
+                    break;
+                }
+                default:
+                    ThrowMalformed("unknown value type");
+            }
+        }
+        writer.End();
+    };
+
+    if (format_ == Format::kTskv || format_ == Format::kLtsv) {
+        TskvWriter writer{format_, out};
+        write(writer);
+    } else {
+        JsonWriter writer{format_, out};
+        write(writer);
+    }
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
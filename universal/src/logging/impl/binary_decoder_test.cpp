@@ -0,0 +1,114 @@
+#include <userver/logging/impl/binary_decoder.hpp>
+
+#include <gtest/gtest.h>
+
+#include <logging/impl/binary_format.hpp>
+#include <logging/impl/formatters/binary.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string MakeRecord(logging::Level level, std::string_view text) {
+    logging::impl::formatters::Binary formatter{level, utils::impl::SourceLocation::Current()};
+    formatter.AddTag("signed", logging::LogExtra::Value{-42});
+    formatter.AddTag("unsigned", logging::LogExtra::Value{42ULL});
+    formatter.AddTag("double", logging::LogExtra::Value{1.5});
+    formatter.AddTag("string", std::string_view{"tab\tinside"});
+    formatter.SetText(text);
+
+    auto& item = formatter.ExtractLoggerItem();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    return std::string{static_cast<logging::impl::TextLogItem&>(item).log_line};
+}
+
+// Does what logging::impl::BinaryFileSink does
+std::string MakeLog(const std::vector<std::string>& records) {
+    std::string result;
+    logging::impl::binary::AppendStartFrame(result);
+
+    std::uint32_t strings_written = 0;
+    for (const auto& record : records) {
+        auto strings_used_data = std::string_view{record}.substr(
+            1 + logging::impl::binary::kPaddedVarintSize, logging::impl::binary::kPaddedVarintSize
+        );
+        const auto strings_used = logging::impl::binary::ReadVarint(strings_used_data).value();
+        if (strings_used > strings_written) {
+            logging::impl::binary::AppendStringFrames(result, strings_written, strings_used);
+            strings_written = strings_used;
+        }
+        result += record;
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(BinaryLogDecoder, Tskv) {
+    const auto log = MakeLog({MakeRecord(logging::Level::kWarning, "first"), MakeRecord(logging::Level::kInfo, "2")});
+
+    logging::impl::BinaryLogDecoder decoder{logging::Format::kTskv};
+    std::string out;
+    EXPECT_EQ(decoder.Decode(log, out), log.size());
+
+    const auto first_end = out.find('\n');
+    ASSERT_NE(first_end, std::string::npos) << out;
+    const auto first = out.substr(0, first_end + 1);
+    EXPECT_EQ(first.rfind("tskv\ttimestamp=", 0), 0) << first;
+    EXPECT_NE(first.find("\tlevel=WARNING\tmodule=MakeRecord ( "), std::string::npos) << first;
+    EXPECT_NE(
+        first.find("\tsigned=-42\tunsigned=42\tdouble=1.5\tstring=tab\\tinside\ttext=first\n"), std::string::npos
+    ) << first;
+
+    const auto second = out.substr(first_end + 1);
+    EXPECT_NE(second.find("\tlevel=INFO\t"), std::string::npos) << second;
+    EXPECT_NE(second.find("\ttext=2\n"), std::string::npos) << second;
+}
+
+TEST(BinaryLogDecoder, Json) {
+    const auto log = MakeLog({MakeRecord(logging::Level::kError, "text")});
+
+    logging::impl::BinaryLogDecoder decoder{logging::Format::kJson};
+    std::string out;
+    EXPECT_EQ(decoder.Decode(log, out), log.size());
+    ASSERT_EQ(out.back(), '\n');
+
+    const auto json = formats::json::FromString(out);
+    EXPECT_EQ(json["level"].As<std::string>(), "ERROR");
+    EXPECT_EQ(json["signed"].As<int>(), -42);
+    EXPECT_EQ(json["unsigned"].As<unsigned>(), 42);
+    EXPECT_EQ(json["double"].As<double>(), 1.5);
+    EXPECT_EQ(json["string"].As<std::string>(), "tab\tinside");
+    EXPECT_EQ(json["text"].As<std::string>(), "text");
+}
+
+TEST(BinaryLogDecoder, Partial) {
+    const auto log = MakeLog({MakeRecord(logging::Level::kInfo, "a"), MakeRecord(logging::Level::kInfo, "b")});
+
+    logging::impl::BinaryLogDecoder expected_decoder{logging::Format::kLtsv};
+    std::string expected;
+    expected_decoder.Decode(log, expected);
+
+    logging::impl::BinaryLogDecoder decoder{logging::Format::kLtsv};
+    std::string out;
+    std::string pending;
+    for (const char c : log) {
+        pending += c;
+        pending.erase(0, decoder.Decode(pending, out));
+    }
+    EXPECT_TRUE(pending.empty());
+    EXPECT_EQ(out, expected);
+}
+
+TEST(BinaryLogDecoder, Malformed) {
+    logging::impl::BinaryLogDecoder decoder{logging::Format::kTskv};
+    std::string out;
+
+    // Record without the preceding interned strings
+    EXPECT_THROW(decoder.Decode(MakeRecord(logging::Level::kInfo, "text"), out), std::runtime_error);
+    EXPECT_THROW(decoder.Decode("X\x01X", out), std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
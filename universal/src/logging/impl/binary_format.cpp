@@ -0,0 +1,94 @@
+#include <logging/impl/binary_format.hpp>
+
+#include <deque>
+#include <mutex>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::binary {
+
+namespace {
+
+// Keys of LogExtra may be built at runtime, do not let them eat all the memory
+constexpr std::size_t kMaxInternedStrings = 1 << 16;
+
+class InternTable final {
+public:
+    std::optional<std::uint32_t> Intern(std::string_view str) {
+        const std::lock_guard lock{mutex_};
+        if (const auto* id = utils::impl::FindTransparentOrNullptr(ids_, str)) return *id;
+        if (strings_.size() >= kMaxInternedStrings) return std::nullopt;
+
+        const auto id = static_cast<std::uint32_t>(strings_.size());
+        strings_.emplace_back(str);
+        ids_.emplace(strings_.back(), id);
+        return id;
+    }
+
+    void AppendStringFrames(std::string& out, std::uint32_t from, std::uint32_t to) const {
+        const std::lock_guard lock{mutex_};
+        UASSERT(to <= strings_.size());
+        for (auto id = from; id < to; ++id) {
+            std::string payload;
+            WriteVarint(payload, id);
+            payload += strings_[id];
+
+            out.push_back(static_cast<char>(FrameType::kString));
+            WriteVarint(out, payload.size());
+            out += payload;
+        }
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::deque<std::string> strings_;
+    utils::impl::TransparentMap<std::string, std::uint32_t> ids_;
+};
+
+InternTable& GetInternTable() {
+    static InternTable table;
+    return table;
+}
+
+}  // namespace
+
+void WritePaddedVarint(char* out, std::uint32_t value) noexcept {
+    UASSERT(value <= kMaxPaddedVarint);
+    for (std::size_t i = 0; i + 1 < kPaddedVarintSize; ++i) {
+        out[i] = static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    out[kPaddedVarintSize - 1] = static_cast<char>(value);
+}
+
+std::optional<std::uint64_t> ReadVarint(std::string_view& data) noexcept {
+    std::uint64_t result = 0;
+    for (std::size_t i = 0; i < data.size() && i < 10; ++i) {
+        const auto byte = static_cast<unsigned char>(data[i]);
+        result |= static_cast<std::uint64_t>(byte & 0x7F) << (7 * i);
+        if (!(byte & 0x80)) {
+            data.remove_prefix(i + 1);
+            return result;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<std::uint32_t> Intern(std::string_view str) { return GetInternTable().Intern(str); }
+
+void AppendStringFrames(std::string& out, std::uint32_t from, std::uint32_t to) {
+    GetInternTable().AppendStringFrames(out, from, to);
+}
+
+void AppendStartFrame(std::string& out) {
+    out.push_back(static_cast<char>(FrameType::kStart));
+    WriteVarint(out, kMagic.size());
+    out += kMagic;
+}
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,87 @@
+#pragma once
+
+/// Binary log format, see logging::Format::kBinary.
+///
+/// The log is a sequence of frames: frame type byte, varint payload size and
+/// the payload. Integers are LEB128 varints, signed values are zigzag encoded.
+///
+/// * FrameType::kStart - kMagic, resets the strings table of the decoder;
+/// * FrameType::kString - varint id and the bytes of an interned string;
+/// * FrameType::kRecord - padded varint count of the interned strings the
+///   record depends on, varint microseconds since epoch, level byte, string
+///   references to the function and file names, varint line, then the tags
+///   till the end of the payload: string reference to the key, ValueType byte
+///   and the value.
+///
+/// String reference is a varint of the interned string id + 1, or 0 followed
+/// by the varint size and the bytes of a not interned string.
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::binary {
+
+enum class FrameType : char {
+    kStart = 'S',
+    kString = 'D',
+    kRecord = 'R',
+};
+
+enum class ValueType : char {
+    kString = 's',
+    kSigned = 'i',
+    kUnsigned = 'u',
+    kDouble = 'd',
+};
+
+inline constexpr std::string_view kMagic = "userver-binary-log-1";
+
+/// Padded varints are used for the values that are known only after the
+/// frame is written, they always take kPaddedVarintSize bytes
+inline constexpr std::size_t kPaddedVarintSize = 4;
+inline constexpr std::uint32_t kMaxPaddedVarint = (1U << (7 * kPaddedVarintSize)) - 1;
+
+/// Frame type, padded payload size and padded strings count
+inline constexpr std::size_t kRecordHeaderSize = 1 + 2 * kPaddedVarintSize;
+
+template <typename Buffer>
+void WriteVarint(Buffer& buffer, std::uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+void WritePaddedVarint(char* out, std::uint32_t value) noexcept;
+
+/// Reads a varint and advances the `data`, std::nullopt if the data ends
+/// before the varint does
+std::optional<std::uint64_t> ReadVarint(std::string_view& data) noexcept;
+
+constexpr std::uint64_t ZigZagEncode(std::int64_t value) noexcept {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+constexpr std::int64_t ZigZagDecode(std::uint64_t value) noexcept {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+/// Returns the id of the string in the process wide append-only table of
+/// interned strings, std::nullopt if the table is full
+std::optional<std::uint32_t> Intern(std::string_view str);
+
+/// Appends FrameType::kString frames for the interned strings with ids
+/// in [from, to)
+void AppendStringFrames(std::string& out, std::uint32_t from, std::uint32_t to);
+
+void AppendStartFrame(std::string& out);
+
+}  // namespace logging::impl::binary
+
+USERVER_NAMESPACE_END
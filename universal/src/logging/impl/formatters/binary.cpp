@@ -0,0 +1,123 @@
+#include <logging/impl/formatters/binary.hpp>
+
+#include <chrono>
+#include <cstring>
+
+#include <logging/impl/binary_format.hpp>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::formatters {
+
+namespace {
+
+// Per-thread cache of the process wide intern table, so that interning does
+// not take the table lock on the hot path
+using InternCache = utils::impl::TransparentMap<std::string, std::uint32_t>;
+
+compiler::ThreadLocal local_intern_cache = [] { return InternCache{}; };
+
+// Beyond that the strings are written inline
+constexpr std::size_t kMaxInternedSize = 256;
+
+}  // namespace
+
+Binary::Binary(Level level, const utils::impl::SourceLocation& location) {
+    const auto now = std::chrono::system_clock::now();
+
+    // Payload size and strings count are written in ExtractLoggerItem()
+    item_.log_line.resize(binary::kRecordHeaderSize);
+    item_.log_line.data()[0] = static_cast<char>(binary::FrameType::kRecord);
+
+    binary::WriteVarint(
+        item_.log_line,
+        std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count()
+    );
+    item_.log_line.push_back(static_cast<char>(level));
+    WriteModuleRef(location);
+}
+
+void Binary::AddTag(std::string_view key, const LogExtra::Value& value) {
+    WriteStringRef(key);
+    std::visit(
+        [this](const auto& x) {
+            using T = std::decay_t<decltype(x)>;
+            if constexpr (std::is_same_v<T, std::string>) {
+                item_.log_line.push_back(static_cast<char>(binary::ValueType::kString));
+                binary::WriteVarint(item_.log_line, x.size());
+                item_.log_line.append(x);
+            } else if constexpr (std::is_floating_point_v<T>) {
+                item_.log_line.push_back(static_cast<char>(binary::ValueType::kDouble));
+                const double as_double = x;
+                std::uint64_t bits = 0;
+                std::memcpy(&bits, &as_double, sizeof(bits));
+                for (std::size_t i = 0; i < sizeof(bits); ++i) {
+                    item_.log_line.push_back(static_cast<char>(bits >> (8 * i)));
+                }
+            } else if constexpr (std::is_signed_v<T>) {
+                item_.log_line.push_back(static_cast<char>(binary::ValueType::kSigned));
+                binary::WriteVarint(item_.log_line, binary::ZigZagEncode(x));
+            } else {
+                item_.log_line.push_back(static_cast<char>(binary::ValueType::kUnsigned));
+                binary::WriteVarint(item_.log_line, x);
+            }
+        },
+        value
+    );
+}
+
+void Binary::AddTag(std::string_view key, std::string_view value) {
+    WriteStringRef(key);
+    item_.log_line.push_back(static_cast<char>(binary::ValueType::kString));
+    binary::WriteVarint(item_.log_line, value.size());
+    item_.log_line.append(value);
+}
+
+void Binary::SetText(std::string_view text) { AddTag("text", text); }
+
+LoggerItemBase& Binary::ExtractLoggerItem() {
+    const auto payload_size = item_.log_line.size() - 1 - binary::kPaddedVarintSize;
+    UINVARIANT(payload_size <= binary::kMaxPaddedVarint, "Log record is too big for the binary log format");
+
+    binary::WritePaddedVarint(item_.log_line.data() + 1, payload_size);
+    binary::WritePaddedVarint(item_.log_line.data() + 1 + binary::kPaddedVarintSize, strings_used_);
+    return item_;
+}
+
+void Binary::WriteStringRef(std::string_view str) {
+    if (str.size() <= kMaxInternedSize) {
+        auto cache = local_intern_cache.Use();
+        if (const auto* id = utils::impl::FindTransparentOrNullptr(*cache, str)) {
+            WriteInternedRef(*id);
+            return;
+        }
+        if (const auto id = binary::Intern(str)) {
+            cache->emplace(str, *id);
+            WriteInternedRef(*id);
+            return;
+        }
+    }
+
+    item_.log_line.push_back('\0');
+    binary::WriteVarint(item_.log_line, str.size());
+    item_.log_line.append(str);
+}
+
+void Binary::WriteModuleRef(const utils::impl::SourceLocation& location) {
+    WriteStringRef(location.GetFunctionName());
+    WriteStringRef(location.GetFileName());
+    binary::WriteVarint(item_.log_line, location.GetLine());
+}
+
+void Binary::WriteInternedRef(std::uint32_t id) {
+    binary::WriteVarint(item_.log_line, std::uint64_t{id} + 1);
+    strings_used_ = std::max(strings_used_, id + 1);
+}
+
+}  // namespace logging::impl::formatters
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+#include <userver/logging/impl/formatters/base.hpp>
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl::formatters {
+
+/// Writes the records of the binary log format, see logging/impl/binary_format.hpp
+class Binary final : public Base {
+public:
+    Binary(Level level, const utils::impl::SourceLocation& location);
+
+    void AddTag(std::string_view key, const LogExtra::Value& value) override;
+
+    void AddTag(std::string_view key, std::string_view value) override;
+
+    void SetText(std::string_view text) override;
+
+    LoggerItemBase& ExtractLoggerItem() override;
+
+private:
+    void WriteStringRef(std::string_view str);
+    void WriteModuleRef(const utils::impl::SourceLocation& location);
+    void WriteInternedRef(std::uint32_t id);
+
+    TextLogItem item_;
+    std::uint32_t strings_used_{0};
+};
+
+}  // namespace logging::impl::formatters
+
+USERVER_NAMESPACE_END
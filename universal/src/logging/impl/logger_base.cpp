@@ -1,5 +1,6 @@
 #include <userver/logging/impl/logger_base.hpp>
 
+#include <logging/impl/formatters/binary.hpp>
 #include <logging/impl/formatters/json.hpp>
 #include <logging/impl/formatters/tskv.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
@@ -38,6 +39,9 @@ formatters::BasePtr TextLogger::MakeFormatter(Level level, LogClass, const utils
         case Format::kJsonYaDeploy:
             return std::make_unique<formatters::Json>(level, format, location);
 
+        case Format::kBinary:
+            return std::make_unique<formatters::Binary>(level, location);
+
         case Format::kStruct:
             UINVARIANT(false, "Invalid logger type");
             break;
@@ -0,0 +1,109 @@
+#include <userver/utils/arena.hpp>
+
+#include <algorithm>
+#include <utility>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+struct alignas(std::max_align_t) Arena::Block final {
+    Block* next;
+    std::size_t size;
+
+    std::uintptr_t Begin() noexcept { return reinterpret_cast<std::uintptr_t>(this + 1); }
+    std::uintptr_t End() noexcept { return Begin() + size; }
+
+    static Block* Create(std::size_t size, Block* next) {
+        auto* block = static_cast<Block*>(::operator new(sizeof(Block) + size));
+        return new (block) Block{next, size};
+    }
+
+    static void Destroy(Block* block) noexcept { ::operator delete(block); }
+};
+
+Arena::Arena(std::size_t initial_block_size) noexcept
+    : next_block_size_(std::clamp<std::size_t>(initial_block_size, sizeof(Block), kMaxBlockSize)) {}
+
+Arena::Arena(Arena&& other) noexcept
+    : head_(std::exchange(other.head_, nullptr)),
+      current_(std::exchange(other.current_, 0)),
+      end_(std::exchange(other.end_, 0)),
+      next_block_size_(other.next_block_size_),
+      used_bytes_(std::exchange(other.used_bytes_, 0)),
+      reserved_bytes_(std::exchange(other.reserved_bytes_, 0)) {}
+
+Arena& Arena::operator=(Arena&& other) noexcept {
+    if (this == &other) return *this;
+
+    ReleaseBlocks(head_);
+    head_ = std::exchange(other.head_, nullptr);
+    current_ = std::exchange(other.current_, 0);
+    end_ = std::exchange(other.end_, 0);
+    next_block_size_ = other.next_block_size_;
+    used_bytes_ = std::exchange(other.used_bytes_, 0);
+    reserved_bytes_ = std::exchange(other.reserved_bytes_, 0);
+    return *this;
+}
+
+Arena::~Arena() { ReleaseBlocks(head_); }
+
+void* Arena::AllocateSlow(std::size_t size, std::size_t alignment) {
+    // Blocks are aligned to max_align_t, over-aligned requests need a margin
+    const auto margin = alignment > alignof(Block) ? alignment - alignof(Block) : 0;
+    const auto required = size + margin;
+    if (required < size) throw std::bad_alloc();
+
+    if (head_ && required > next_block_size_ / 2) {
+        // Big allocations get a block of their own behind the current one, so
+        // the rest of the current block stays in use
+        head_->next = Block::Create(required, head_->next);
+        reserved_bytes_ += required;
+        used_bytes_ += size;
+
+        const auto begin = head_->next->Begin();
+        return reinterpret_cast<void*>((begin + alignment - 1) & ~(alignment - 1));
+    }
+
+    const auto block_size = std::max(next_block_size_, required);
+    head_ = Block::Create(block_size, head_);
+    reserved_bytes_ += block_size;
+    next_block_size_ = std::min(next_block_size_ * 2, kMaxBlockSize);
+
+    current_ = head_->Begin();
+    end_ = head_->End();
+    return Allocate(size, alignment);
+}
+
+void Arena::Reset() noexcept {
+    if (!head_) return;
+
+    Block* biggest = head_;
+    for (Block* block = head_->next; block; block = block->next) {
+        if (block->size > biggest->size) biggest = block;
+    }
+
+    Block* block = head_;
+    while (block) {
+        Block* next = block->next;
+        if (block != biggest) Block::Destroy(block);
+        block = next;
+    }
+
+    biggest->next = nullptr;
+    head_ = biggest;
+    current_ = head_->Begin();
+    end_ = head_->End();
+    used_bytes_ = 0;
+    reserved_bytes_ = head_->size;
+}
+
+void Arena::ReleaseBlocks(Block* first) noexcept {
+    while (first) {
+        Block::Destroy(std::exchange(first, first->next));
+    }
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,94 @@
+#include <userver/utils/arena.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+bool IsAligned(const void* ptr, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+}  // namespace
+
+TEST(Arena, Sample) {
+    /// [Sample Arena]
+    utils::Arena arena;
+    std::vector<int, utils::ArenaAllocator<int>> values{utils::ArenaAllocator<int>{arena}};
+    for (int i = 0; i < 100; ++i) values.push_back(i);
+
+    EXPECT_EQ(values.back(), 99);
+    EXPECT_GE(arena.GetUsedBytes(), 100 * sizeof(int));
+    /// [Sample Arena]
+}
+
+TEST(Arena, Alignment) {
+    utils::Arena arena{64};
+    for (std::size_t alignment : {1, 2, 4, 8, 16, 32, 64, 128}) {
+        arena.Allocate(1, 1);
+        EXPECT_TRUE(IsAligned(arena.Allocate(3, alignment), alignment)) << alignment;
+    }
+    EXPECT_TRUE(IsAligned(arena.Allocate(1000, 256), 256));
+}
+
+TEST(Arena, ResetKeepsBiggestBlock) {
+    utils::Arena arena{128};
+    EXPECT_EQ(arena.GetReservedBytes(), 0);
+
+    for (int i = 0; i < 100; ++i) arena.Allocate(50);
+    const auto reserved = arena.GetReservedBytes();
+    EXPECT_GE(reserved, 5000);
+    EXPECT_GE(arena.GetUsedBytes(), 5000);
+
+    arena.Reset();
+    EXPECT_EQ(arena.GetUsedBytes(), 0);
+    EXPECT_LT(arena.GetReservedBytes(), reserved);
+
+    const auto kept = arena.GetReservedBytes();
+    arena.Allocate(kept / 2);
+    EXPECT_EQ(arena.GetReservedBytes(), kept);
+}
+
+TEST(Arena, BigAllocation) {
+    utils::Arena arena{128};
+    auto* small = static_cast<char*>(arena.Allocate(8));
+    arena.Allocate(10000);
+    auto* next_small = static_cast<char*>(arena.Allocate(8));
+
+    // The current block keeps serving small allocations
+    EXPECT_EQ(next_small - small, alignof(std::max_align_t));
+}
+
+TEST(Arena, Move) {
+    utils::Arena arena;
+    auto* ptr = static_cast<int*>(arena.Allocate(sizeof(int), alignof(int)));
+    *ptr = 42;
+
+    utils::Arena other = std::move(arena);
+    EXPECT_EQ(*ptr, 42);
+    EXPECT_EQ(arena.GetReservedBytes(), 0);  // NOLINT(bugprone-use-after-move)
+    EXPECT_GT(other.GetReservedBytes(), 0);
+
+    arena = std::move(other);
+    EXPECT_EQ(*ptr, 42);
+}
+
+TEST(Arena, Containers) {
+    using Allocator = utils::ArenaAllocator<std::pair<const std::string, int>>;
+
+    utils::Arena arena;
+    std::map<std::string, int, std::less<>, Allocator> map{Allocator{arena}};
+    for (int i = 0; i < 1000; ++i) map.emplace(std::to_string(i), i);
+
+    EXPECT_EQ(map.size(), 1000);
+    EXPECT_EQ(map.at("500"), 500);
+    EXPECT_EQ(map.get_allocator(), Allocator{arena});
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,134 @@
+#include <userver/utils/impl/buffer_chain.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <utility>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+namespace {
+
+using Chunk = std::unique_ptr<char[]>;
+
+// 1MiB per thread and 4MiB for all the threads at most, the rest is freed.
+// Chunks may be returned on another thread than the one they were taken on,
+// the limits keep the pools from growing unboundedly.
+constexpr std::size_t kMaxPooledChunksPerThread = 32;
+constexpr std::size_t kMaxPooledChunksTotal = 128;
+
+std::atomic<std::size_t> total_pooled_chunks{0};
+
+bool TryReserveTotal() noexcept {
+    if (total_pooled_chunks.fetch_add(1, std::memory_order_relaxed) < kMaxPooledChunksTotal) return true;
+
+    total_pooled_chunks.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+}
+
+struct ChunksPool final {
+    ChunksPool() = default;
+    ChunksPool(ChunksPool&&) = default;
+    ~ChunksPool() { total_pooled_chunks.fetch_sub(size, std::memory_order_relaxed); }
+
+    std::array<Chunk, kMaxPooledChunksPerThread> chunks;
+    std::size_t size{0};
+};
+
+compiler::ThreadLocal local_chunks_pool = [] { return ChunksPool{}; };
+
+Chunk PopChunk() {
+    auto pool = local_chunks_pool.Use();
+    if (pool->size == 0) {
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        return Chunk{new char[BufferChain::kChunkSize]};
+    }
+    total_pooled_chunks.fetch_sub(1, std::memory_order_relaxed);
+    return std::move(pool->chunks[--pool->size]);
+}
+
+void PushChunks(std::vector<Chunk>& chunks) noexcept {
+    auto pool = local_chunks_pool.Use();
+    for (auto& chunk : chunks) {
+        if (pool->size == kMaxPooledChunksPerThread || !TryReserveTotal()) break;
+        pool->chunks[pool->size++] = std::move(chunk);
+    }
+    chunks.clear();
+}
+
+}  // namespace
+
+BufferChain::BufferChain(BufferChain&& other) noexcept
+    : chunks_(std::move(other.chunks_)),
+      pos_(std::exchange(other.pos_, nullptr)),
+      end_(std::exchange(other.end_, nullptr)) {
+    other.chunks_.clear();
+}
+
+BufferChain& BufferChain::operator=(BufferChain&& other) noexcept {
+    if (this != &other) {
+        Clear();
+        chunks_ = std::move(other.chunks_);
+        other.chunks_.clear();
+        pos_ = std::exchange(other.pos_, nullptr);
+        end_ = std::exchange(other.end_, nullptr);
+    }
+    return *this;
+}
+
+BufferChain::~BufferChain() { Clear(); }
+
+void BufferChain::Append(std::string_view data) {
+    while (!data.empty()) {
+        if (pos_ == end_) AddChunk();
+
+        const auto size = std::min(data.size(), static_cast<std::size_t>(end_ - pos_));
+        std::memcpy(pos_, data.data(), size);
+        pos_ += size;
+        data.remove_prefix(size);
+    }
+}
+
+std::size_t BufferChain::GetSize() const noexcept {
+    if (chunks_.empty()) return 0;
+    return (chunks_.size() - 1) * kChunkSize + (pos_ - chunks_.back().get());
+}
+
+std::string_view BufferChain::GetChunk(std::size_t index) const noexcept {
+    UASSERT(index < chunks_.size());
+    const char* data = chunks_[index].get();
+    if (index + 1 == chunks_.size()) return {data, static_cast<std::size_t>(pos_ - data)};
+    return {data, kChunkSize};
+}
+
+std::string BufferChain::ToString() const {
+    std::string result;
+    result.reserve(GetSize());
+    for (std::size_t i = 0; i < chunks_.size(); ++i) {
+        result += GetChunk(i);
+    }
+    return result;
+}
+
+void BufferChain::Clear() noexcept {
+    PushChunks(chunks_);
+    pos_ = nullptr;
+    end_ = nullptr;
+}
+
+void BufferChain::AddChunk() {
+    UASSERT(pos_ == end_);
+    chunks_.push_back(PopChunk());
+    pos_ = chunks_.back().get();
+    end_ = pos_ + kChunkSize;
+}
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,56 @@
+#include <userver/utils/impl/buffer_chain.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(BufferChain, Empty) {
+    const utils::impl::BufferChain chain;
+    EXPECT_TRUE(chain.IsEmpty());
+    EXPECT_EQ(chain.GetSize(), 0);
+    EXPECT_EQ(chain.GetChunksCount(), 0);
+    EXPECT_EQ(chain.ToString(), "");
+}
+
+TEST(BufferChain, Append) {
+    constexpr auto kChunkSize = utils::impl::BufferChain::kChunkSize;
+
+    std::string expected;
+    utils::impl::BufferChain chain;
+    for (std::size_t i = 0; expected.size() < kChunkSize * 2; ++i) {
+        const auto part = std::to_string(i);
+        chain.Append(part);
+        chain.Append(',');
+        expected += part;
+        expected += ',';
+    }
+    chain.Append(std::string(kChunkSize * 3, 'x'));
+    expected.append(kChunkSize * 3, 'x');
+
+    EXPECT_EQ(chain.GetSize(), expected.size());
+    ASSERT_EQ(chain.GetChunksCount(), expected.size() / kChunkSize + 1);
+    for (std::size_t i = 0; i + 1 < chain.GetChunksCount(); ++i) {
+        EXPECT_EQ(chain.GetChunk(i), std::string_view{expected}.substr(i * kChunkSize, kChunkSize));
+    }
+    EXPECT_EQ(chain.ToString(), expected);
+}
+
+TEST(BufferChain, MoveAndClear) {
+    utils::impl::BufferChain chain;
+    chain.Append(std::string(utils::impl::BufferChain::kChunkSize + 1, 'a'));
+
+    utils::impl::BufferChain other{std::move(chain)};
+    // NOLINTNEXTLINE(bugprone-use-after-move)
+    EXPECT_TRUE(chain.IsEmpty());
+    EXPECT_EQ(other.GetChunksCount(), 2);
+
+    chain = std::move(other);
+    EXPECT_EQ(chain.GetSize(), utils::impl::BufferChain::kChunkSize + 1);
+
+    chain.Clear();
+    EXPECT_TRUE(chain.IsEmpty());
+    chain.Append("reused");
+    EXPECT_EQ(chain.ToString(), "reused");
+}
+
+USERVER_NAMESPACE_END
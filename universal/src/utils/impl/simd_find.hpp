@@ -0,0 +1,112 @@
+#pragma once
+
+// Vectorized byte search for the text protocol parsers. Uses AVX2 or SSE2 if
+// the target supports them, the scalar fallback is used for the tails and on
+// other platforms.
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+namespace simd_find {
+
+template <char... Chars>
+constexpr bool IsAnyOf(char c) noexcept {
+    return ((c == Chars) || ...);
+}
+
+// Bytes outside of [0x20, 0x7E]: control characters, DEL and non-ASCII
+constexpr bool IsNonPrintable(char c) noexcept {
+    const auto byte = static_cast<unsigned char>(c);
+    return byte < 0x20 || byte >= 0x7F;
+}
+
+#ifdef __AVX2__
+constexpr std::ptrdiff_t kBlockSize = 32;
+using Block = __m256i;
+
+inline Block Load(const char* data) noexcept { return _mm256_loadu_si256(reinterpret_cast<const Block*>(data)); }
+
+inline std::uint32_t ToMask(Block matches) noexcept {
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(matches));
+}
+
+template <char... Chars>
+Block MatchAnyOf(Block block) noexcept {
+    Block result = _mm256_setzero_si256();
+    ((result = _mm256_or_si256(result, _mm256_cmpeq_epi8(block, _mm256_set1_epi8(Chars)))), ...);
+    return result;
+}
+
+inline Block MatchNonPrintable(Block block) noexcept {
+    // Signed comparison also matches the bytes >= 0x80
+    return _mm256_or_si256(
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(0x20), block), _mm256_cmpeq_epi8(block, _mm256_set1_epi8(0x7F))
+    );
+}
+#elif defined(__SSE2__)
+constexpr std::ptrdiff_t kBlockSize = 16;
+using Block = __m128i;
+
+inline Block Load(const char* data) noexcept { return _mm_loadu_si128(reinterpret_cast<const Block*>(data)); }
+
+inline std::uint32_t ToMask(Block matches) noexcept { return static_cast<std::uint32_t>(_mm_movemask_epi8(matches)); }
+
+template <char... Chars>
+Block MatchAnyOf(Block block) noexcept {
+    Block result = _mm_setzero_si128();
+    ((result = _mm_or_si128(result, _mm_cmpeq_epi8(block, _mm_set1_epi8(Chars)))), ...);
+    return result;
+}
+
+inline Block MatchNonPrintable(Block block) noexcept {
+    // Signed comparison also matches the bytes >= 0x80
+    return _mm_or_si128(_mm_cmplt_epi8(block, _mm_set1_epi8(0x20)), _mm_cmpeq_epi8(block, _mm_set1_epi8(0x7F)));
+}
+#endif
+
+}  // namespace simd_find
+
+/// Returns the first byte of [begin, end) equal to any of `Chars`, or `end`
+template <char... Chars>
+const char* FindFirstOf(const char* begin, const char* end) noexcept {
+    static_assert(sizeof...(Chars) > 0);
+#if defined(__AVX2__) || defined(__SSE2__)
+    for (; end - begin >= simd_find::kBlockSize; begin += simd_find::kBlockSize) {
+        const auto mask = simd_find::ToMask(simd_find::MatchAnyOf<Chars...>(simd_find::Load(begin)));
+        if (mask) return begin + __builtin_ctz(mask);
+    }
+#endif
+    for (; begin != end; ++begin) {
+        if (simd_find::IsAnyOf<Chars...>(*begin)) return begin;
+    }
+    return end;
+}
+
+/// Returns the first byte of [begin, end) outside of the printable ASCII
+/// range [0x20, 0x7E], or `end`
+inline const char* FindFirstNonPrintable(const char* begin, const char* end) noexcept {
+#if defined(__AVX2__) || defined(__SSE2__)
+    for (; end - begin >= simd_find::kBlockSize; begin += simd_find::kBlockSize) {
+        const auto mask = simd_find::ToMask(simd_find::MatchNonPrintable(simd_find::Load(begin)));
+        if (mask) return begin + __builtin_ctz(mask);
+    }
+#endif
+    for (; begin != end; ++begin) {
+        if (simd_find::IsNonPrintable(*begin)) return begin;
+    }
+    return end;
+}
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
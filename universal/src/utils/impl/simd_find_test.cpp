@@ -0,0 +1,71 @@
+#include <utils/impl/simd_find.hpp>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const char* FindFirstOfReference(std::string_view data, std::string_view chars) {
+    const auto pos = data.find_first_of(chars);
+    return pos == std::string_view::npos ? data.data() + data.size() : data.data() + pos;
+}
+
+const char* FindFirstNonPrintableReference(std::string_view data) {
+    return std::find_if(data.data(), data.data() + data.size(), [](char c) {
+        const auto byte = static_cast<unsigned char>(c);
+        return byte < 0x20 || byte >= 0x7F;
+    });
+}
+
+}  // namespace
+
+TEST(SimdFind, FindFirstOf) {
+    std::string data(100, 'a');
+    const auto* begin = data.data();
+    const auto* end = begin + data.size();
+    EXPECT_EQ((utils::impl::FindFirstOf<'%', '+'>(begin, end)), end);
+    EXPECT_EQ((utils::impl::FindFirstOf<'%', '+'>(begin, begin)), begin);
+
+    // All the positions within and after the vectorized blocks
+    for (std::size_t pos = 0; pos < data.size(); ++pos) {
+        for (const char c : {'%', '+'}) {
+            data[pos] = c;
+            for (std::size_t offset = 0; offset <= pos; offset += 7) {
+                const std::string_view view{data.data() + offset, data.size() - offset};
+                EXPECT_EQ(
+                    (utils::impl::FindFirstOf<'%', '+'>(view.data(), view.data() + view.size())),
+                    FindFirstOfReference(view, "%+")
+                ) << pos
+                  << ' ' << offset;
+            }
+            data[pos] = 'a';
+        }
+    }
+}
+
+TEST(SimdFind, FindFirstNonPrintable) {
+    std::string data(100, 'x');
+    const auto* begin = data.data();
+    const auto* end = begin + data.size();
+    EXPECT_EQ(utils::impl::FindFirstNonPrintable(begin, end), end);
+
+    for (std::size_t pos = 0; pos < data.size(); ++pos) {
+        for (const char c : {'\0', '\t', '\r', '\x1f', '\x7f', '\x80', '\xff', ' ', '~'}) {
+            data[pos] = c;
+            const std::string_view view{data};
+            EXPECT_EQ(
+                utils::impl::FindFirstNonPrintable(view.data(), view.data() + view.size()),
+                FindFirstNonPrintableReference(view)
+            ) << pos
+              << ' ' << static_cast<int>(c);
+        }
+        data[pos] = 'x';
+    }
+}
+
+USERVER_NAMESPACE_END
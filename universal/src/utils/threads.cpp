@@ -17,6 +17,7 @@
 #endif
 
 #include <algorithm>
+#include <system_error>
 
 #include <fmt/format.h>
 
@@ -74,6 +75,27 @@ void SetCurrentThreadLowPriorityScheduling() {
     utils::CheckSyscall(::setpriority(PRIO_PROCESS, 0, kLowPriority), "setting thread scheduling parameters");
 }
 
+void SetCurrentThreadCpuAffinity(std::size_t cpu) {
+#ifdef __linux__
+    if (cpu >= CPU_SETSIZE) {
+        throw std::system_error(
+            std::make_error_code(std::errc::invalid_argument), fmt::format("CPU {} is too big", cpu)
+        );
+    }
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu, &cpu_set);
+    static constexpr ::pid_t kThisThreadPid = 0;
+    utils::CheckSyscall(::sched_setaffinity(kThisThreadPid, sizeof(cpu_set), &cpu_set), "setting CPU affinity");
+#else
+    throw std::system_error(
+        std::make_error_code(std::errc::not_supported),
+        fmt::format("Setting CPU affinity to {} is not supported on this platform", cpu)
+    );
+#endif
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END